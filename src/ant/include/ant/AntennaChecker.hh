@@ -32,6 +32,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 
@@ -50,6 +51,9 @@ using utl::Logger;
 struct PARinfo;
 struct ARinfo;
 struct AntennaModel;
+struct NetGraph;
+struct NetSignature;
+class AntennaDbCbk;
 
 ///////////////////////////////////////
 struct GraphNode;
@@ -153,6 +157,9 @@ class AntennaChecker
                                   float ratio_margin);
   void initAntennaRules();
   void setReportFileName(const char* file_name);
+  // Nets with more wire entries than wire_length are checked one at a
+  // time with all threads working on the net.
+  void setLargeNetWireLength(int wire_length);
 
  private:
   bool haveRoutedNets();
@@ -167,8 +174,22 @@ class AntennaChecker
   std::vector<std::pair<double, std::vector<odb::dbITerm*>>>
   getViolatedWireLength(odb::dbNet* net, int routing_level);
   bool isValidGate(odb::dbMTerm* mterm);
-  void buildLayerMaps(odb::dbNet* net, LayerToGraphNodes& node_by_layer_map);
+  bool isLargeNet(odb::dbNet* net);
+  void watchBlock();
+  void invalidateNetGraph(odb::dbNet* net, bool renamed);
+  void netSignature(odb::dbNet* db_net, NetSignature& signature);
+  bool updateNetGraph(odb::dbNet* db_net, NetGraph& graph, int num_threads);
+  void buildNetGraph(odb::dbNet* db_net, NetGraph& graph, int num_threads);
+  void buildLayerMaps(odb::dbNet* net,
+                      LayerToGraphNodes& node_by_layer_map,
+                      int num_threads);
+  void checkNetCached(odb::dbNet* net,
+                      bool verbose,
+                      int num_threads,
+                      int& net_violation_count,
+                      int& pin_violation_count);
   void checkNet(odb::dbNet* net,
+                const NetGraph& graph,
                 bool verbose,
                 bool report_if_no_violation,
                 std::ofstream& report_file,
@@ -179,9 +200,9 @@ class AntennaChecker
                 Violations& antenna_violations);
   void saveGates(odb::dbNet* db_net,
                  LayerToGraphNodes& node_by_layer_map,
-                 int node_count);
-  void calculateAreas(const LayerToGraphNodes& node_by_layer_map,
-                      GateToLayerToNodeInfo& gate_info);
+                 int node_count,
+                 int num_threads);
+  void calculateAreas(const NetGraph& graph, GateToLayerToNodeInfo& gate_info);
   void calculatePAR(GateToLayerToNodeInfo& gate_info);
   void calculateCAR(GateToLayerToNodeInfo& gate_info);
   bool checkRatioViolations(odb::dbNet* db_net,
@@ -234,8 +255,16 @@ class AntennaChecker
   std::string report_file_name_;
   std::vector<odb::dbNet*> nets_;
   std::map<odb::dbNet*, ViolationReport> net_to_report_;
+  // Wire graphs and check results of the nets, kept between checks.
+  std::map<odb::dbNet*, NetGraph> net_graphs_;
+  std::unique_ptr<AntennaDbCbk> db_cbk_;
+  // Nets with more wire entries than this are checked one at a time
+  // with all threads working on the net.
+  int large_net_wire_length_{20000};
   // consts
   static constexpr int max_diode_count_per_gate = 10;
+
+  friend class AntennaDbCbk;
 };
 
 }  // namespace ant
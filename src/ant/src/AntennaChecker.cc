@@ -40,10 +40,12 @@
 #include <fstream>
 #include <iostream>
 #include <queue>
+#include <unordered_map>
 #include <utility>
 
 #include "Polygon.hh"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbShape.h"
 #include "odb/dbTypes.h"
 #include "utl/Logger.h"
@@ -78,10 +80,138 @@ struct AntennaModel
   double diff_metal_reduce_factor;
 };
 
+// Wire or via polygon of a net with the gates connected to it.
+struct NetGraphNode
+{
+  odb::dbTechLayer* layer;
+  double area;
+  double side_area;
+  std::vector<odb::dbITerm*> gates;
+};
+
+// Placement of a gate or pin connected to a net.
+struct PinPlacement
+{
+  odb::dbITerm* iterm;
+  odb::dbMaster* master;
+  odb::dbTransform transform;
+
+  bool operator==(const PinPlacement& other) const
+  {
+    return iterm == other.iterm && master == other.master
+           && transform == other.transform;
+  }
+};
+
+// Wire and pin placements a net graph is built from.
+struct NetSignature
+{
+  std::vector<int> wire_data;
+  std::vector<unsigned char> wire_opcodes;
+  std::vector<PinPlacement> pins;
+
+  bool operator==(const NetSignature& other) const
+  {
+    return wire_data == other.wire_data && wire_opcodes == other.wire_opcodes
+           && pins == other.pins;
+  }
+};
+
+// Flattened wire graph of a net. It only keeps the polygons connected to
+// gates and is rebuilt when the wire or the pins of the net change.
+struct NetGraph
+{
+  bool valid = false;
+  // Set by AntennaDbCbk when the wire or the pins of the net may have
+  // changed. The graph is then rebuilt if the signature differs.
+  bool dirty = true;
+  NetSignature signature;
+  std::vector<NetGraphNode> nodes;
+
+  // Result of the last checkAntennas on the net.
+  bool checked = false;
+  int pin_violations = 0;
+  ViolationReport report;
+};
+
 extern "C" {
 extern int Ant_Init(Tcl_Interp* interp);
 }
 
+// Marks the cached graphs of the nets changed in the block as stale.
+class AntennaDbCbk : public odb::dbBlockCallBackObj
+{
+ public:
+  explicit AntennaDbCbk(AntennaChecker* checker) : checker_(checker) {}
+
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override
+  {
+    invalidateInstNets(inst, false);
+  }
+  void inDbPostMoveInst(odb::dbInst* inst) override
+  {
+    invalidateInstNets(inst, false);
+  }
+  void inDbInstPostRename(odb::dbInst* inst) override
+  {
+    invalidateInstNets(inst, true);
+  }
+  void inDbNetDestroy(odb::dbNet* net) override
+  {
+    checker_->net_graphs_.erase(net);
+  }
+  void inDbNetPostRename(odb::dbNet* net) override
+  {
+    checker_->invalidateNetGraph(net, true);
+  }
+  void inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet* net) override
+  {
+    checker_->invalidateNetGraph(net, false);
+  }
+  void inDbITermPostConnect(odb::dbITerm* iterm) override
+  {
+    checker_->invalidateNetGraph(iterm->getNet(), false);
+  }
+  void inDbWireCreate(odb::dbWire* wire) override
+  {
+    checker_->invalidateNetGraph(wire->getNet(), false);
+  }
+  void inDbWireDestroy(odb::dbWire* wire) override
+  {
+    checker_->invalidateNetGraph(wire->getNet(), false);
+  }
+  void inDbWirePostModify(odb::dbWire* wire) override
+  {
+    checker_->invalidateNetGraph(wire->getNet(), false);
+  }
+  void inDbWirePostAttach(odb::dbWire* wire) override
+  {
+    checker_->invalidateNetGraph(wire->getNet(), false);
+  }
+  void inDbWirePostDetach(odb::dbWire*, odb::dbNet* net) override
+  {
+    checker_->invalidateNetGraph(net, false);
+  }
+  void inDbWirePostAppend(odb::dbWire*, odb::dbWire* dst) override
+  {
+    checker_->invalidateNetGraph(dst->getNet(), false);
+  }
+  void inDbWirePostCopy(odb::dbWire*, odb::dbWire* dst) override
+  {
+    checker_->invalidateNetGraph(dst->getNet(), false);
+  }
+
+ private:
+  void invalidateInstNets(odb::dbInst* inst, const bool renamed)
+  {
+    for (odb::dbITerm* iterm : inst->getITerms()) {
+      checker_->invalidateNetGraph(iterm->getNet(), renamed);
+    }
+  }
+
+  AntennaChecker* checker_;
+};
+
 AntennaChecker::AntennaChecker() = default;
 AntennaChecker::~AntennaChecker() = default;
 
@@ -92,19 +222,47 @@ void AntennaChecker::init(odb::dbDatabase* db,
   db_ = db;
   global_route_source_ = global_route_source;
   logger_ = logger;
+  db_cbk_ = std::make_unique<AntennaDbCbk>(this);
+}
+
+void AntennaChecker::watchBlock()
+{
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  if (block != block_ || !db_cbk_->hasOwner()) {
+    // The cached graphs belong to another block or missed its changes.
+    net_graphs_.clear();
+    db_cbk_->addOwner(block);
+  }
+  block_ = block;
+}
+
+void AntennaChecker::invalidateNetGraph(odb::dbNet* net, const bool renamed)
+{
+  if (net == nullptr) {
+    return;
+  }
+  auto graph_itr = net_graphs_.find(net);
+  if (graph_itr != net_graphs_.end()) {
+    NetGraph& graph = graph_itr->second;
+    graph.dirty = true;
+    // The reports hold the net and instance names.
+    if (renamed) {
+      graph.checked = false;
+    }
+  }
 }
 
 void AntennaChecker::initAntennaRules()
 {
-  block_ = db_->getChip()->getBlock();
+  watchBlock();
   odb::dbTech* tech = db_->getTech();
-  // initialize nets_to_report_ with all nets to avoid issues with
-  // multithreading
-  if (net_to_report_.empty()) {
-    for (odb::dbNet* net : block_->getNets()) {
-      if (!net->isSpecial()) {
-        net_to_report_[net];
-      }
+  // initialize nets_to_report_ and net_graphs_ with all nets to avoid
+  // issues with multithreading. Graphs of deleted nets are dropped by
+  // AntennaDbCbk.
+  for (odb::dbNet* net : block_->getNets()) {
+    if (!net->isSpecial()) {
+      net_to_report_[net];
+      net_graphs_[net];
     }
   }
 
@@ -232,18 +390,38 @@ double AntennaChecker::getPwlFactor(
 
 void AntennaChecker::saveGates(odb::dbNet* db_net,
                                LayerToGraphNodes& node_by_layer_map,
-                               const int node_count)
+                               const int node_count,
+                               const int num_threads)
 {
-  std::map<PinType, std::vector<int>, PinTypeCmp> pin_nbrs;
-  std::vector<int> ids;
-  // iterate all instance pins
+  auto layer_nodes
+      = [&node_by_layer_map](odb::dbTechLayer* layer) -> const GraphNodes* {
+    auto layer_itr = node_by_layer_map.find(layer);
+    return layer_itr != node_by_layer_map.end() ? &layer_itr->second
+                                                : nullptr;
+  };
+
+  std::vector<odb::dbITerm*> iterms;
   for (odb::dbITerm* iterm : db_net->getITerms()) {
+    iterms.push_back(iterm);
+  }
+
+  // find the nodes connected to each instance pin
+  std::vector<std::vector<int>> iterm_nbrs(iterms.size());
+  const int iterm_count = iterms.size();
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic) \
+    if (num_threads > 1)
+  for (int i = 0; i < iterm_count; i++) {
+    odb::dbITerm* iterm = iterms[i];
+    std::vector<int>& nbrs = iterm_nbrs[i];
+    auto add_nbrs = [&](odb::dbTechLayer* layer, const Polygon& pin_pol) {
+      const GraphNodes* nodes = layer_nodes(layer);
+      if (nodes) {
+        for (const int& index : findNodesWithIntersection(*nodes, pin_pol)) {
+          nbrs.push_back((*nodes)[index]->id);
+        }
+      }
+    };
     odb::dbMTerm* mterm = iterm->getMTerm();
-    std::string pin_name = fmt::format("  {}/{} ({})",
-                                       iterm->getInst()->getConstName(),
-                                       mterm->getConstName(),
-                                       mterm->getMaster()->getConstName());
-    PinType pin = PinType(std::move(pin_name), iterm);
     odb::dbInst* inst = iterm->getInst();
     const odb::dbTransform transform = inst->getTransform();
     for (odb::dbMPin* mterm : mterm->getMPins()) {
@@ -261,29 +439,34 @@ void AntennaChecker::saveGates(odb::dbNet* db_net,
         // convert rect -> polygon
         Polygon pin_pol = rectToPolygon(pin_rect);
         // if has wire on same layer connect to pin
-        ids = findNodesWithIntersection(node_by_layer_map[tech_layer], pin_pol);
-        for (const int& index : ids) {
-          pin_nbrs[pin].push_back(node_by_layer_map[tech_layer][index]->id);
-        }
+        add_nbrs(tech_layer, pin_pol);
         // if has via on upper layer connected to pin
         if (upper_layer) {
-          ids = findNodesWithIntersection(node_by_layer_map[upper_layer],
-                                          pin_pol);
-          for (const int& index : ids) {
-            pin_nbrs[pin].push_back(node_by_layer_map[upper_layer][index]->id);
-          }
+          add_nbrs(upper_layer, pin_pol);
         }
         // if has via on lower layer connected to pin
         if (lower_layer) {
-          ids = findNodesWithIntersection(node_by_layer_map[lower_layer],
-                                          pin_pol);
-          for (const int& index : ids) {
-            pin_nbrs[pin].push_back(node_by_layer_map[lower_layer][index]->id);
-          }
+          add_nbrs(lower_layer, pin_pol);
         }
       }
     }
   }
+
+  std::map<PinType, std::vector<int>, PinTypeCmp> pin_nbrs;
+  for (int i = 0; i < iterm_count; i++) {
+    if (iterm_nbrs[i].empty()) {
+      continue;
+    }
+    odb::dbITerm* iterm = iterms[i];
+    odb::dbMTerm* mterm = iterm->getMTerm();
+    std::string pin_name = fmt::format("  {}/{} ({})",
+                                       iterm->getInst()->getConstName(),
+                                       mterm->getConstName(),
+                                       mterm->getMaster()->getConstName());
+    std::vector<int>& nbrs = pin_nbrs[PinType(std::move(pin_name), iterm)];
+    nbrs.insert(nbrs.end(), iterm_nbrs[i].begin(), iterm_nbrs[i].end());
+  }
+
   // run DSU from min_layer to max_layer
   std::vector<int> dsu_parent(node_count);
   std::vector<int> dsu_size(node_count);
@@ -314,15 +497,21 @@ void AntennaChecker::saveGates(odb::dbNet* db_net,
         }
       }
     }
+    // gates reached by each set, so every node only looks up its own set
+    std::unordered_map<int, std::vector<const PinType*>> set_gates;
+    for (const auto& [gate, nbrs] : pin_nbrs) {
+      for (const int& nbr_id : nbrs) {
+        std::vector<const PinType*>& gates = set_gates[dsu.find_set(nbr_id)];
+        if (gates.empty() || gates.back() != &gate) {
+          gates.push_back(&gate);
+        }
+      }
+    }
     for (auto& node_it : node_by_layer_map[iter]) {
-      int id_u = node_it->id;
-      // check gates in same set (first Nodes x gates)
-      for (const auto& gate_it : pin_nbrs) {
-        for (const int& nbr_id : gate_it.second) {
-          if (dsu.find_set(id_u) == dsu.find_set(nbr_id)) {
-            node_it->gates.insert(gate_it.first);
-            break;
-          }
+      auto gates_itr = set_gates.find(dsu.find_set(node_it->id));
+      if (gates_itr != set_gates.end()) {
+        for (const PinType* gate : gates_itr->second) {
+          node_it->gates.insert(*gate);
         }
       }
     }
@@ -418,58 +607,29 @@ void AntennaChecker::calculateViaPar(odb::dbTechLayer* tech_layer,
   }
 }
 
-void AntennaChecker::calculateAreas(const LayerToGraphNodes& node_by_layer_map,
+void AntennaChecker::calculateAreas(const NetGraph& graph,
                                     GateToLayerToNodeInfo& gate_info)
 {
-  for (const auto& it : node_by_layer_map) {
-    for (const auto& node_it : it.second) {
-      NodeInfo info;
-      double area = gtl::area(node_it->pol);
-      // convert from dbu^2 to microns^2
-      area = block_->dbuToMicrons(area);
-      area = block_->dbuToMicrons(area);
-      info.area = area;
-      int gates_count = 0;
-      std::vector<odb::dbITerm*> iterms;
-      for (const auto& gate : node_it->gates) {
-        if (!gate.isITerm) {
-          continue;
-        }
-
-        if (isValidGate(gate.iterm->getMTerm())) {
-          info.iterms.push_back(gate.iterm);
-        }
-        info.iterm_gate_area += gateArea(gate.iterm->getMTerm());
-        info.iterm_diff_area += diffArea(gate.iterm->getMTerm());
-        gates_count++;
+  for (const NetGraphNode& node : graph.nodes) {
+    NodeInfo info;
+    info.area = node.area;
+    info.side_area = node.side_area;
+    for (odb::dbITerm* gate : node.gates) {
+      if (isValidGate(gate->getMTerm())) {
+        info.iterms.push_back(gate);
       }
-      if (gates_count == 0) {
+      info.iterm_gate_area += gateArea(gate->getMTerm());
+      info.iterm_diff_area += diffArea(gate->getMTerm());
+    }
+    // put values on struct
+    for (odb::dbITerm* gate : node.gates) {
+      if (!isValidGate(gate->getMTerm())) {
         continue;
       }
-
-      if (it.first->getRoutingLevel() != 0) {
-        // Calculate side area of wire
-        uint wire_thickness_dbu = 0;
-        it.first->getThickness(wire_thickness_dbu);
-        double wire_thickness = block_->dbuToMicrons(wire_thickness_dbu);
-        info.side_area = block_->dbuToMicrons(gtl::perimeter(node_it->pol)
-                                              * wire_thickness);
-      }
-      // put values on struct
-      for (const auto& gate : node_it->gates) {
-        if (!gate.isITerm) {
-          continue;
-        }
-        if (!isValidGate(gate.iterm->getMTerm())) {
-          continue;
-        }
-        // check if has another node with gate in the layer, then merge area
-        if (gate_info[gate.iterm].find(it.first)
-            != gate_info[gate.iterm].end()) {
-          gate_info[gate.iterm][it.first] += info;
-        } else {
-          gate_info[gate.iterm][it.first] = info;
-        }
+      // check if has another node with gate in the layer, then merge area
+      auto [info_itr, inserted] = gate_info[gate].try_emplace(node.layer, info);
+      if (!inserted) {
+        info_itr->second += info;
       }
     }
   }
@@ -907,7 +1067,8 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
 }
 
 void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
-                                    LayerToGraphNodes& node_by_layer_map)
+                                    LayerToGraphNodes& node_by_layer_map,
+                                    const int num_threads)
 {
   odb::dbWire* wires = db_net->getWire();
 
@@ -931,12 +1092,26 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
   for (const auto& layer_it : set_by_layer) {
     // iterate only via layers
     if (layer_it.first->getRoutingLevel() == 0) {
-      int via_index = 0;
-      for (const auto& via_it : layer_it.second) {
-        lower_index = findNodesWithIntersection(
-            node_by_layer_map[layer_it.first->getLowerLayer()], via_it);
-        upper_index = findNodesWithIntersection(
-            node_by_layer_map[layer_it.first->getUpperLayer()], via_it);
+      // find the wires touching each via in parallel, then connect them in
+      // via order
+      const GraphNodes& lower_nodes
+          = node_by_layer_map[layer_it.first->getLowerLayer()];
+      const GraphNodes& upper_nodes
+          = node_by_layer_map[layer_it.first->getUpperLayer()];
+      const PolygonSet& vias = layer_it.second;
+      const int via_count = vias.size();
+      std::vector<std::vector<int>> lower_indices(via_count);
+      std::vector<std::vector<int>> upper_indices(via_count);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic) \
+    if (num_threads > 1)
+      for (int i = 0; i < via_count; i++) {
+        lower_indices[i] = findNodesWithIntersection(lower_nodes, vias[i]);
+        upper_indices[i] = findNodesWithIntersection(upper_nodes, vias[i]);
+      }
+
+      for (int via_index = 0; via_index < via_count; via_index++) {
+        lower_index = std::move(lower_indices[via_index]);
+        upper_index = std::move(upper_indices[via_index]);
 
         if (upper_index.size() <= 2) {
           // connect upper -> via
@@ -968,14 +1143,110 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
               layer_it.first->getLowerLayer()->getName());
           logger_->report("{}", log_error);
         }
-        via_index++;
       }
     }
   }
-  saveGates(db_net, node_by_layer_map, node_count);
+  saveGates(db_net, node_by_layer_map, node_count, num_threads);
+}
+
+bool AntennaChecker::isLargeNet(odb::dbNet* net)
+{
+  odb::dbWire* wire = net->getWire();
+  return wire && wire->length() > large_net_wire_length_;
+}
+
+void AntennaChecker::setLargeNetWireLength(const int wire_length)
+{
+  large_net_wire_length_ = wire_length;
+}
+
+// Copy of the wire and of the pin placements of db_net.
+void AntennaChecker::netSignature(odb::dbNet* db_net, NetSignature& signature)
+{
+  odb::dbWire* wire = db_net->getWire();
+  const int wire_length = wire->length();
+  signature.wire_data.resize(wire_length);
+  signature.wire_opcodes.resize(wire_length);
+  for (int i = 0; i < wire_length; i++) {
+    signature.wire_data[i] = wire->getData(i);
+    signature.wire_opcodes[i] = wire->getOpcode(i);
+  }
+
+  signature.pins.clear();
+  for (odb::dbITerm* iterm : db_net->getITerms()) {
+    odb::dbInst* inst = iterm->getInst();
+    signature.pins.push_back({iterm, inst->getMaster(), inst->getTransform()});
+  }
+}
+
+// Rebuild the graph of db_net if its wire or its pins changed since the
+// graph was built. Only the nets marked dirty by AntennaDbCbk are
+// compared; a wire recreated with the same content keeps its graph.
+// Returns true if the graph was rebuilt.
+bool AntennaChecker::updateNetGraph(odb::dbNet* db_net,
+                                    NetGraph& graph,
+                                    const int num_threads)
+{
+  if (graph.valid && !graph.dirty && db_cbk_->hasOwner()) {
+    return false;
+  }
+
+  NetSignature signature;
+  netSignature(db_net, signature);
+  graph.dirty = false;
+  if (graph.valid && graph.signature == signature) {
+    return false;
+  }
+
+  graph.signature = std::move(signature);
+  graph.checked = false;
+  buildNetGraph(db_net, graph, num_threads);
+  graph.valid = true;
+  return true;
+}
+
+void AntennaChecker::buildNetGraph(odb::dbNet* db_net,
+                                   NetGraph& graph,
+                                   const int num_threads)
+{
+  LayerToGraphNodes node_by_layer_map;
+  buildLayerMaps(db_net, node_by_layer_map, num_threads);
+
+  // only the nodes connected to gates are needed for the ratios
+  graph.nodes.clear();
+  for (const auto& [layer, nodes] : node_by_layer_map) {
+    for (const auto& node : nodes) {
+      NetGraphNode graph_node{layer, 0.0, 0.0, {}};
+      for (const PinType& gate : node->gates) {
+        if (gate.isITerm) {
+          graph_node.gates.push_back(gate.iterm);
+        }
+      }
+      if (graph_node.gates.empty()) {
+        continue;
+      }
+
+      double area = gtl::area(node->pol);
+      // convert from dbu^2 to microns^2
+      area = block_->dbuToMicrons(area);
+      area = block_->dbuToMicrons(area);
+      graph_node.area = area;
+
+      if (layer->getRoutingLevel() != 0) {
+        // Calculate side area of wire
+        uint wire_thickness_dbu = 0;
+        layer->getThickness(wire_thickness_dbu);
+        double wire_thickness = block_->dbuToMicrons(wire_thickness_dbu);
+        graph_node.side_area = block_->dbuToMicrons(gtl::perimeter(node->pol)
+                                                    * wire_thickness);
+      }
+      graph.nodes.push_back(std::move(graph_node));
+    }
+  }
 }
 
 void AntennaChecker::checkNet(odb::dbNet* db_net,
+                              const NetGraph& graph,
                               bool verbose,
                               bool report_if_no_violation,
                               std::ofstream& report_file,
@@ -985,30 +1256,67 @@ void AntennaChecker::checkNet(odb::dbNet* db_net,
                               int& pin_violation_count,
                               Violations& antenna_violations)
 {
-  odb::dbWire* wire = db_net->getWire();
-  if (wire) {
-    LayerToGraphNodes node_by_layer_map;
-    GateToLayerToNodeInfo gate_info;
-    buildLayerMaps(db_net, node_by_layer_map);
-
-    calculateAreas(node_by_layer_map, gate_info);
-
-    calculatePAR(gate_info);
-    calculateCAR(gate_info);
-
-    int pin_violations = checkGates(db_net,
-                                    verbose,
-                                    report_if_no_violation,
-                                    report_file,
-                                    diode_mterm,
-                                    ratio_margin,
-                                    gate_info,
-                                    antenna_violations);
-
-    if (pin_violations > 0) {
-      net_violation_count++;
-      pin_violation_count += pin_violations;
-    }
+  GateToLayerToNodeInfo gate_info;
+  calculateAreas(graph, gate_info);
+
+  calculatePAR(gate_info);
+  calculateCAR(gate_info);
+
+  int pin_violations = checkGates(db_net,
+                                  verbose,
+                                  report_if_no_violation,
+                                  report_file,
+                                  diode_mterm,
+                                  ratio_margin,
+                                  gate_info,
+                                  antenna_violations);
+
+  if (pin_violations > 0) {
+    net_violation_count++;
+    pin_violation_count += pin_violations;
+  }
+}
+
+// Check db_net for checkAntennas, reusing the result of the previous check
+// if the net graph did not change.
+void AntennaChecker::checkNetCached(odb::dbNet* db_net,
+                                    bool verbose,
+                                    const int num_threads,
+                                    int& net_violation_count,
+                                    int& pin_violation_count)
+{
+  if (!db_net->getWire()) {
+    return;
+  }
+
+  NetGraph& graph = net_graphs_.at(db_net);
+  ViolationReport& violation_report = net_to_report_.at(db_net);
+  const bool rebuilt = updateNetGraph(db_net, graph, num_threads);
+  if (rebuilt || !graph.checked) {
+    int net_violations = 0;
+    int pin_violations = 0;
+    std::ofstream report_file;
+    Violations antenna_violations;
+    checkNet(db_net,
+             graph,
+             verbose,
+             false,
+             report_file,
+             nullptr,
+             0,
+             net_violations,
+             pin_violations,
+             antenna_violations);
+    graph.checked = true;
+    graph.pin_violations = pin_violations;
+    graph.report = violation_report;
+  } else {
+    violation_report = graph.report;
+  }
+
+  if (graph.pin_violations > 0) {
+    net_violation_count++;
+    pin_violation_count += graph.pin_violations;
   }
 }
 
@@ -1025,12 +1333,22 @@ Violations AntennaChecker::getAntennaViolations(odb::dbNet* net,
   if (net_to_report_.find(net) == net_to_report_.end()) {
     net_to_report_[net];
   }
+  if (net_graphs_.find(net) == net_graphs_.end()) {
+    net_graphs_[net];
+  }
+
+  if (!net->getWire()) {
+    return antenna_violations;
+  }
+  NetGraph& graph = net_graphs_.at(net);
+  updateNetGraph(net, graph, 1);
 
   int net_violation_count, pin_violation_count;
   net_violation_count = 0;
   pin_violation_count = 0;
   std::ofstream report_file;
   checkNet(net,
+           graph,
            false,
            false,
            report_file,
@@ -1076,26 +1394,23 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
   int pin_violation_count = 0;
 
   if (net) {
-    Violations antenna_violations;
     if (!net->isSpecial()) {
-      checkNet(net,
-               verbose,
-               true,
-               report_file,
-               nullptr,
-               0,
-               net_violation_count,
-               pin_violation_count,
-               antenna_violations);
+      checkNetCached(
+          net, verbose, num_threads, net_violation_count, pin_violation_count);
     } else {
       logger_->error(
           ANT, 14, "Skipped net {} because it is special.", net->getName());
     }
   } else {
     nets_.clear();
+    std::vector<odb::dbNet*> large_nets;
     for (odb::dbNet* net : block_->getNets()) {
       if (!net->isSpecial()) {
-        nets_.push_back(net);
+        if (isLargeNet(net)) {
+          large_nets.push_back(net);
+        } else {
+          nets_.push_back(net);
+        }
       }
     }
     omp_set_num_threads(num_threads);
@@ -1103,16 +1418,14 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
     reduction(+ : net_violation_count, pin_violation_count)
     for (int i = 0; i < nets_.size(); i++) {
       odb::dbNet* net = nets_[i];
-      Violations antenna_violations;
-      checkNet(net,
-               verbose,
-               false,
-               report_file,
-               nullptr,
-               0,
-               net_violation_count,
-               pin_violation_count,
-               antenna_violations);
+      checkNetCached(
+          net, verbose, 1, net_violation_count, pin_violation_count);
+    }
+    // A few nets like resets and scan enables dominate the runtime, so
+    // each of them uses all the threads.
+    for (odb::dbNet* net : large_nets) {
+      checkNetCached(
+          net, verbose, num_threads, net_violation_count, pin_violation_count);
     }
   }
 
@@ -95,6 +95,13 @@ set_report_file_name(char* file_name)
   getAntennaChecker()->setReportFileName(file_name);
 }
 
+// For the tests of the large net path.
+void
+set_large_net_wire_length(int wire_length)
+{
+  getAntennaChecker()->setLargeNetWireLength(wire_length);
+}
+
 } // namespace
 
 %} // inline
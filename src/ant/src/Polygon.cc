@@ -69,12 +69,12 @@ std::vector<int> findNodesWithIntersection(const GraphNodes& graph_nodes,
 void wiresToPolygonSetMap(odb::dbWire* wires,
                           std::map<odb::dbTechLayer*, PolygonSet>& set_by_layer)
 {
-  odb::dbShape shape;
-  odb::dbWireShapeItr shapes_it;
+  std::vector<odb::dbShape> shapes;
   std::vector<odb::dbShape> via_boxes;
+  wires->getShapes(shapes);
 
   // Add information on polygon sets
-  for (shapes_it.begin(wires); shapes_it.next(shape);) {
+  for (const odb::dbShape& shape : shapes) {
     odb::dbTechLayer* layer;
 
     // Get rect of the wire
@@ -0,0 +1,20 @@
+# check_antennas after ECOs reuses the results of unchanged nets
+read_lef ant_check.lef
+read_def ant_check.def
+
+check_antennas
+check_antennas
+
+# renaming an instance changes the report of its nets
+set block [ord::get_db_block]
+[$block findInst output50] rename output50_eco
+check_antennas -verbose
+
+# disconnecting a gate changes the net graph
+set iterm [$block findITerm _264_/B2]
+set net [$iterm getNet]
+$iterm disconnect
+check_antennas
+
+$iterm connect $net
+check_antennas
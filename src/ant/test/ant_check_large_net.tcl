@@ -0,0 +1,8 @@
+# check_antennas with every routed net on the large net path
+source "helpers.tcl"
+read_lef merged_spacing.lef
+read_def sw130_random.def
+
+set_thread_count 4
+ant::set_large_net_wire_length 0
+check_antennas -verbose
@@ -3,6 +3,8 @@ record_tests {
   check_drt1
   check_grt1
   ant_check
+  ant_check_eco
+  ant_check_large_net
   ant_report
   #ant_readme_msgs_check
   #ant_man_tcl_check
@@ -114,6 +114,7 @@ class TritonCTS
   void checkCharacterization();
   void findClockRoots();
   void buildClockTrees();
+  void buildClockTreesParallel(int thread_count);
   void writeDataToDb();
 
   // db functions
@@ -81,10 +81,13 @@ Clustering::Clustering(const std::vector<std::pair<float, float>>& sinks,
     : logger_(logger), branching_point_(xBranch, yBranch)
 {
   sinks_.reserve(sinks.size());
+  sinks_x_.reserve(sinks.size());
+  sinks_y_.reserve(sinks.size());
   for (size_t i = 0; i < sinks.size(); ++i) {
     sinks_.emplace_back(sinks[i].first, sinks[i].second, i);
+    sinks_x_.push_back(sinks[i].first);
+    sinks_y_.push_back(sinks[i].second);
   }
-  srand(56);
 }
 
 Clustering::~Clustering() = default;
@@ -175,6 +178,7 @@ float Clustering::Kmeans(const unsigned n,
   unsigned iter = 1;
   while (!stop) {
     fixSegmentLengths(means);
+    computeDistances(means, dists_);
 
     // sink to cluster matching based on min-cost flow
     minCostFlow(means, cap, 5200, power);
@@ -183,6 +187,7 @@ float Clustering::Kmeans(const unsigned n,
     clusters.clear();
     clusters.resize(n);
     for (Sink& sink : sinks_) {
+      const float* sinkDists = &dists_[sink.sink_idx * means.size()];
       int position = 0;
       if (sink.cluster_idx >= 0 && sink.cluster_idx < n) {
         position = sink.cluster_idx;
@@ -196,8 +201,7 @@ float Clustering::Kmeans(const unsigned n,
         // with size < cap
         for (size_t j = 0; j < means.size(); ++j) {
           if (clusters[j].size() < cap) {
-            minimumDist = calcDist(
-                std::make_pair(means[j].first, means[j].second), &sink);
+            minimumDist = sinkDists[j];
             minimumDistClusterIndex = j;
             break;
           }
@@ -210,8 +214,7 @@ float Clustering::Kmeans(const unsigned n,
           // Nearest Cluster with size < cap
           for (size_t j = 0; j < means.size(); ++j) {
             if (clusters[j].size() < cap) {
-              const float currentDist = calcDist(
-                  std::make_pair(means[j].first, means[j].second), &sink);
+              const float currentDist = sinkDists[j];
               if (currentDist < minimumDist) {
                 minimumDist = currentDist;
                 minimumDistClusterIndex = j;
@@ -260,19 +263,19 @@ float Clustering::Kmeans(const unsigned n,
 float Clustering::calcSilh(
     const std::vector<std::pair<float, float>>& means) const
 {
+  std::vector<float> dists;
+  computeDistances(means, dists);
   float sum_silh = 0;
   for (const Sink& sink : sinks_) {
+    const float* sinkDists = &dists[sink.sink_idx * means.size()];
     float in_d = 0, out_d = FLT_MAX;
     for (size_t j = 0; j < means.size(); ++j) {
-      const float x = means[j].first;
-      const float y = means[j].second;
       if (sink.cluster_idx == j) {
         // within the cluster
-        in_d = calcDist({x, y}, &sink);
+        in_d = sinkDists[j];
       } else {
         // outside of the cluster
-        const float d = calcDist({x, y}, &sink);
-        out_d = std::min(d, out_d);
+        out_d = std::min(sinkDists[j], out_d);
       }
     }
     const float temp = std::max(out_d, in_d);
@@ -328,7 +331,7 @@ void Clustering::minCostFlow(const std::vector<std::pair<float, float>>& means,
   std::vector<float> costs;
   for (size_t i = 0; i < sinks_.size(); ++i) {
     for (size_t j = 0; j < means.size(); ++j) {
-      float d = calcDist(means[j], &sinks_[i]);
+      float d = dists_[i * means.size() + j];
       if (d <= dist) {
         d = std::pow(d, power);
         if (d < std::numeric_limits<int>::max()) {
@@ -425,6 +428,25 @@ void Clustering::minCostFlow(const std::vector<std::pair<float, float>>& means,
   }
 }
 
+// Distances from every sink to every mean, indexed by sink * means + mean.
+// The loop runs over the flat sink arrays so it vectorizes.
+void Clustering::computeDistances(
+    const std::vector<std::pair<float, float>>& means,
+    std::vector<float>& dists) const
+{
+  const size_t numMeans = means.size();
+  dists.resize(sinks_.size() * numMeans);
+  for (size_t j = 0; j < numMeans; ++j) {
+    const float x = means[j].first;
+    const float y = means[j].second;
+    const size_t numSinks = sinks_x_.size();
+    for (size_t i = 0; i < numSinks; ++i) {
+      dists[i * numMeans + j]
+          = std::abs(x - sinks_x_[i]) + std::abs(y - sinks_y_[i]);
+    }
+  }
+}
+
 void Clustering::getClusters(
     std::vector<std::vector<unsigned>>& newClusters) const
 {
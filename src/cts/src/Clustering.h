@@ -76,6 +76,8 @@ class Clustering
                    unsigned cap,
                    float dist,
                    unsigned power);
+  void computeDistances(const std::vector<std::pair<float, float>>& means,
+                        std::vector<float>& dists) const;
   void fixSegmentLengths(std::vector<std::pair<float, float>>& means);
   void fixSegment(const std::pair<float, float>& fixedPoint,
                   float targetDist,
@@ -87,6 +89,11 @@ class Clustering
 
   Logger* logger_;
   std::vector<Sink> sinks_;
+  // Sink locations kept apart for computeDistances.
+  std::vector<float> sinks_x_;
+  std::vector<float> sinks_y_;
+  // Distances to the current means.
+  std::vector<float> dists_;
   std::vector<std::vector<Sink*>> clusters_;
 
   float segment_length_ = 0.0;
@@ -35,11 +35,13 @@
 
 #include "HTreeBuilder.h"
 
+#include <atomic>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <thread>
 
 #include "Clustering.h"
 #include "SinkClustering.h"
@@ -1159,6 +1161,7 @@ void HTreeBuilder::run()
         const unsigned minIndex = 1;
         techChar_->createFakeEntries(minLengthSinkRegion_, minIndex);
         minLengthSinkRegion_ = 1;
+        useFakeEntries_ = true;
       } else {
         logger_->info(
             CTS,
@@ -1454,7 +1457,8 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length) const
           minKey = key;
           minDelay = seg.getDelay();
         }
-      });
+      },
+      withFakeEntries());
 
   return minKey;
 }
@@ -1491,7 +1495,8 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
               minBufDelay = seg.getDelay();
               minBufKey = key;
             }
-          });
+          },
+          withFakeEntries());
     }
   }
 
@@ -1584,7 +1589,8 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
                 minBufKeyFallback = key;
               }
             }
-          });
+          },
+          withFakeEntries());
     }
   }
 
@@ -1604,6 +1610,9 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
 void HTreeBuilder::computeBranchingPoints(const unsigned level,
                                           LevelTopology& topology)
 {
+  // Each branching point of the parent level splits its own sinks, so the
+  // branches are clustered independently and then added in order.
+  std::vector<BranchClustering> branches;
   if (level == 1) {
     const Point<double> clockRoot(sinkRegion_.getCenter());
     Point<double> low(clockRoot);
@@ -1615,40 +1624,67 @@ void HTreeBuilder::computeBranchingPoints(const unsigned level,
       low.setY(low.getY() - topology.getLength());
       high.setY(high.getY() + topology.getLength());
     }
-    const unsigned branchPtIdx1
+    BranchClustering& branch = branches.emplace_back();
+    branch.branchPtIdx1
         = topology.addBranchingPoint(low, LevelTopology::NO_PARENT);
-    const unsigned branchPtIdx2
+    branch.branchPtIdx2
         = topology.addBranchingPoint(high, LevelTopology::NO_PARENT);
+    branch.rootLocation = clockRoot;
+    branch.sinks = topLevelSinksClustered_;
+  } else {
+    LevelTopology& parentTopology = topologyForEachLevel_[level - 2];
+    parentTopology.forEachBranchingPoint(
+        [&](unsigned idx, Point<double> clockRoot) {
+          Point<double> low(clockRoot);
+          Point<double> high(clockRoot);
+          if (isHorizontal(level)) {
+            low.setX(low.getX() - topology.getLength());
+            high.setX(high.getX() + topology.getLength());
+          } else {
+            low.setY(low.getY() - topology.getLength());
+            high.setY(high.getY() + topology.getLength());
+          }
+          BranchClustering& branch = branches.emplace_back();
+          branch.branchPtIdx1 = topology.addBranchingPoint(low, idx);
+          branch.branchPtIdx2 = topology.addBranchingPoint(high, idx);
+          branch.rootLocation = clockRoot;
+          computeBranchSinks(parentTopology, idx, branch.sinks);
+        });
+  }
 
-    refineBranchingPointsWithClustering(topology,
-                                        level,
-                                        branchPtIdx1,
-                                        branchPtIdx2,
-                                        clockRoot,
-                                        topLevelSinksClustered_);
-    return;
+  for (BranchClustering& branch : branches) {
+    const Point<double>& branchPt1
+        = topology.getBranchingPoint(branch.branchPtIdx1);
+    const Point<double>& branchPt2
+        = topology.getBranchingPoint(branch.branchPtIdx2);
+    branch.means.emplace_back(branchPt1.getX(), branchPt1.getY());
+    branch.means.emplace_back(branchPt2.getX(), branchPt2.getY());
   }
 
-  LevelTopology& parentTopology = topologyForEachLevel_[level - 2];
-  parentTopology.forEachBranchingPoint(
-      [&](unsigned idx, Point<double> clockRoot) {
-        Point<double> low(clockRoot);
-        Point<double> high(clockRoot);
-        if (isHorizontal(level)) {
-          low.setX(low.getX() - topology.getLength());
-          high.setX(high.getX() + topology.getLength());
-        } else {
-          low.setY(low.getY() - topology.getLength());
-          high.setY(high.getY() + topology.getLength());
-        }
-        const unsigned branchPtIdx1 = topology.addBranchingPoint(low, idx);
-        const unsigned branchPtIdx2 = topology.addBranchingPoint(high, idx);
+  const int threads = std::min<int>(threadCount_, branches.size());
+  if (threads > 1 && !logger_->debugCheck(CTS, "clustering", 1)) {
+    std::atomic<size_t> next_branch{0};
+    auto cluster = [&]() {
+      for (size_t i = next_branch++; i < branches.size(); i = next_branch++) {
+        clusterBranchSinks(branches[i]);
+      }
+    };
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+      workers.emplace_back(cluster);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  } else {
+    for (BranchClustering& branch : branches) {
+      clusterBranchSinks(branch);
+    }
+  }
 
-        std::vector<std::pair<float, float>> sinks;
-        computeBranchSinks(parentTopology, idx, sinks);
-        refineBranchingPointsWithClustering(
-            topology, level, branchPtIdx1, branchPtIdx2, clockRoot, sinks);
-      });
+  for (const BranchClustering& branch : branches) {
+    refineBranchingPointsWithClustering(topology, level, branch);
+  }
 }
 
 void HTreeBuilder::initTopLevelSinks(
@@ -1687,38 +1723,46 @@ void HTreeBuilder::computeBranchSinks(
   }
 }
 
+void HTreeBuilder::clusterBranchSinks(BranchClustering& branch) const
+{
+  CKMeans::Clustering clusteringEngine(branch.sinks,
+                                       branch.rootLocation.getX(),
+                                       branch.rootLocation.getY(),
+                                       logger_);
+
+  const std::vector<std::pair<float, float>>& sinks = branch.sinks;
+  const unsigned cap
+      = options_->getMaxFanout()
+            ? (unsigned) (sinks.size() * 0.5)
+            : (unsigned) (sinks.size() * options_->getClusteringCapacity());
+  clusteringEngine.iterKmeans(1,
+                              branch.means.size(),
+                              cap,
+                              5,
+                              options_->getClusteringPower(),
+                              branch.means);
+  clusteringEngine.getClusters(branch.clusters);
+}
+
 void HTreeBuilder::refineBranchingPointsWithClustering(
     LevelTopology& topology,
     const unsigned level,
-    const unsigned branchPtIdx1,
-    const unsigned branchPtIdx2,
-    const Point<double>& rootLocation,
-    const std::vector<std::pair<float, float>>& sinks)
+    const BranchClustering& branch)
 {
-  CKMeans::Clustering clusteringEngine(
-      sinks, rootLocation.getX(), rootLocation.getY(), logger_);
+  const unsigned branchPtIdx1 = branch.branchPtIdx1;
+  const unsigned branchPtIdx2 = branch.branchPtIdx2;
+  const std::vector<std::pair<float, float>>& sinks = branch.sinks;
+  const std::vector<std::pair<float, float>>& means = branch.means;
+  const std::vector<std::vector<unsigned>>& clusters = branch.clusters;
 
   Point<double>& branchPt1 = topology.getBranchingPoint(branchPtIdx1);
   Point<double>& branchPt2 = topology.getBranchingPoint(branchPtIdx2);
 
-  std::vector<std::pair<float, float>> means;
-  means.emplace_back(branchPt1.getX(), branchPt1.getY());
-  means.emplace_back(branchPt2.getX(), branchPt2.getY());
-
-  const unsigned cap
-      = options_->getMaxFanout()
-            ? (unsigned) (sinks.size() * 0.5)
-            : (unsigned) (sinks.size() * options_->getClusteringCapacity());
-  clusteringEngine.iterKmeans(
-      1, means.size(), cap, 5, options_->getClusteringPower(), means);
-
   if (((int) options_->getNumStaticLayers() - (int) level) < 0) {
     branchPt1 = Point<double>(means[0].first, means[0].second);
     branchPt2 = Point<double>(means[1].first, means[1].second);
   }
 
-  std::vector<std::vector<unsigned>> clusters;
-  clusteringEngine.getClusters(clusters);
   unsigned movedSinks = 0;
   const double errorFactor = 1.2;
   for (int clusterIdx = 0; clusterIdx < clusters.size(); ++clusterIdx) {
@@ -340,13 +340,21 @@ class HTreeBuilder : public TreeBuilder
   }
 
   void computeBranchingPoints(unsigned level, LevelTopology& topology);
-  void refineBranchingPointsWithClustering(
-      LevelTopology& topology,
-      unsigned level,
-      unsigned branchPtIdx1,
-      unsigned branchPtIdx2,
-      const Point<double>& rootLocation,
-      const std::vector<std::pair<float, float>>& sinks);
+  // Split of the sinks of one parent branch between its two branching
+  // points.
+  struct BranchClustering
+  {
+    unsigned branchPtIdx1 = 0;
+    unsigned branchPtIdx2 = 0;
+    Point<double> rootLocation{0, 0};
+    std::vector<std::pair<float, float>> sinks;
+    std::vector<std::pair<float, float>> means;
+    std::vector<std::vector<unsigned>> clusters;
+  };
+  void clusterBranchSinks(BranchClustering& branch) const;
+  void refineBranchingPointsWithClustering(LevelTopology& topology,
+                                           unsigned level,
+                                           const BranchClustering& branch);
   void preClusteringOpt(const std::vector<std::pair<float, float>>& sinks,
                         std::vector<std::pair<float, float>>& points,
                         std::vector<unsigned>& mapSinkToPoint);
@@ -371,6 +379,13 @@ class HTreeBuilder : public TreeBuilder
 
   bool isNumberOfSinksTooSmall(unsigned numSinksPerSubRegion) const;
 
+  // A serial build also sees the fake entries an earlier tree created.
+  bool withFakeEntries() const
+  {
+    return useFakeEntries_
+           || (shareFakeLutEntries_ && techChar_->hasFakeEntries());
+  }
+
   double weightedDistance(const Point<double>& newLoc,
                           const Point<double>& oldLoc,
                           const std::vector<Point<double>>& sinks);
@@ -394,6 +409,8 @@ class HTreeBuilder : public TreeBuilder
   unsigned minInputCap_ = 0;
   unsigned numMaxLeafSinks_ = 0;
   unsigned minLengthSinkRegion_ = 0;
+  // Set once this tree needs the fake LUT entries.
+  bool useFakeEntries_ = false;
   unsigned clockTreeMaxDepth_ = 0;
   static constexpr int min_clustering_sinks_ = 200;
   std::vector<unsigned> clusterDiameters_ = {50, 100, 200};
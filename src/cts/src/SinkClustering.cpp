@@ -90,6 +90,13 @@ void SinkClustering::normalizePoints(float maxDiameter)
       const double yNorm = (y - yMin) / ySpan;
       p = Point<double>(xNorm, yNorm);
     }
+    // The matching runs for every cluster size and diameter compare each
+    // point with its cluster, so look the insertion delays up only once.
+    pointsInsDelay_.clear();
+    pointsInsDelay_.reserve(points_.size());
+    for (const Point<double>& p : points_) {
+      pointsInsDelay_.push_back(HTree_->getSinkInsertionDelay(p));
+    }
   }
   maxInternalDiameter_ = maxDiameter / std::min(xSpan_, ySpan_);
   capPerUnit_
@@ -217,13 +224,9 @@ bool SinkClustering::findBestMatching(const unsigned groupSize)
   // Keeps track of the total cost of each solution.
   vector<double> costs(groupSize, 0);
   vector<double> previousCosts(groupSize, 0);
-  // Has the points for each cluster of each solution.
-  vector<vector<vector<Point<double>>>> solutionPoints;
-  // Has the points index for each cluster of each solution.
-  // example: solutionsPointsIdx[solutionId][clusterIdx][pointIdx]
-  vector<vector<vector<unsigned>>> solutionPointsIdx;
   // Has the sink indexes for each cluster of each solution.
-  vector<vector<vector<unsigned>>> solutions;
+  // example: solutions[solutionId][clusterIdx][pointIdx]
+  vector<vector<vector<unsigned>>> solutions(groupSize);
 
   if (useMaxCapLimit_) {
     debugPrint(logger_,
@@ -233,88 +236,69 @@ bool SinkClustering::findBestMatching(const unsigned groupSize)
                "Clustering with max cap limit of {:.3e}",
                options_->getSinkBufferInputCap() * max_cap__factor_);
   }
+
+  // Adds the point to the current cluster of solution j, or starts a new
+  // cluster if it does not fit.
+  auto addPoint = [&](const unsigned j, const unsigned idx) {
+    vector<vector<unsigned>>& solution = solutions[j];
+    if (solution.size() < (clusters[j] + 1)) {
+      solution.emplace_back();
+    }
+    double distanceCost = 0;
+    double capCost = pointsCap_[idx];
+    // Check the distance from the current point to others in the cluster,
+    // if there are any.
+    for (const unsigned otherIdx : solution[clusters[j]]) {
+      const double cost = computeDist(idx, otherIdx);
+      if (useMaxCapLimit_) {
+        capCost += cost * capPerUnit_ + pointsCap_[otherIdx];
+      }
+      if (cost > distanceCost) {
+        distanceCost = cost;
+      }
+    }
+    // If the cluster size is higher than groupSize,
+    // or the distance is higher than maxInternalDiameter_
+    //-> start another cluster and save the cost of the current one.
+    if (isLimitExceeded(
+            solution[clusters[j]].size(), distanceCost, capCost, groupSize)) {
+      debugPrint(logger_,
+                 CTS,
+                 "Stree",
+                 4,
+                 "Created cluster of size {}, dia {:.3}, cap {:.3e}",
+                 solution[clusters[j]].size(),
+                 distanceCost,
+                 capCost);
+      // The cost is computed as the highest cost found on the current
+      // cluster
+      if (previousCosts[j] == 0) {
+        previousCosts[j] = maxInternalDiameter_;
+      }
+      costs[j] += previousCosts[j];
+      // A new cluster is defined
+      clusters[j] = clusters[j] + 1;
+      // The cost was already saved, so the same structure can be used for
+      // the next cluster.
+      previousCosts[j] = 0;
+      solution.emplace_back();
+    } else {
+      // Node will be a part of the current cluster, thus, save the highest
+      // cost.
+      if (distanceCost > previousCosts[j]) {
+        previousCosts[j] = distanceCost;
+      }
+    }
+    solution[clusters[j]].push_back(idx);
+  };
+
   // Iterates over the theta vector.
   for (unsigned i = 0; i < thetaIndexVector_.size(); ++i) {
     // The - groupSize is because each solution will start on a different index.
     // There is groupSize solutions.
     for (unsigned j = 0; j < groupSize; ++j) {
       if ((i + j) < thetaIndexVector_.size()) {
-        // Add vectors in case they are no allocated yet.
-        if (solutions.size() < (j + 1)) {
-          solutions.emplace_back();
-          solutionPoints.emplace_back();
-          solutionPointsIdx.emplace_back();
-        }
-        if (solutions[j].size() < (clusters[j] + 1)) {
-          solutions[j].emplace_back();
-          solutionPoints[j].emplace_back();
-          solutionPointsIdx[j].emplace_back();
-        }
-        // Get the current point
-        const unsigned idx = thetaIndexVector_[i + j].second;
-        const Point<double>& p = points_[idx];
-        double distanceCost = 0;
-        double capCost = pointsCap_[idx];
-        unsigned pointIdx = 0;
-        // Check the distance from the current point to others in the cluster,
-        // if there are any.
-        for (Point<double> comparisonPoint : solutionPoints[j][clusters[j]]) {
-          const double cost = HTree_->computeDist(p, comparisonPoint);
-          if (useMaxCapLimit_) {
-            capCost
-                += cost * capPerUnit_
-                   + pointsCap_[solutionPointsIdx[j][clusters[j]][pointIdx]];
-          }
-          pointIdx++;
-          if (cost > distanceCost) {
-            distanceCost = cost;
-          }
-        }
-        // If the cluster size is higher than groupSize,
-        // or the distance is higher than maxInternalDiameter_
-        //-> start another cluster and save the cost of the current one.
-        if (isLimitExceeded(solutionPoints[j][clusters[j]].size(),
-                            distanceCost,
-                            capCost,
-                            groupSize)) {
-          debugPrint(logger_,
-                     CTS,
-                     "Stree",
-                     4,
-                     "Created cluster of size {}, dia {:.3}, cap {:.3e}",
-                     solutionPoints[j][clusters[j]].size(),
-                     distanceCost,
-                     capCost);
-          // The cost is computed as the highest cost found on the current
-          // cluster
-          if (previousCosts[j] == 0) {
-            previousCosts[j] = maxInternalDiameter_;
-          }
-          costs[j] += previousCosts[j];
-          // A new cluster is defined
-          clusters[j] = clusters[j] + 1;
-          // The cost was already saved, so the same structure can be used for
-          // the next cluster.
-          previousCosts[j] = 0;
-        } else {
-          // Node will be a part of the current cluster, thus, save the highest
-          // cost.
-          if (distanceCost > previousCosts[j]) {
-            previousCosts[j] = distanceCost;
-          }
-        }
-        // Add vectors in case they are no allocated yet. (Depends if a new
-        // cluster was defined above)
-        if (solutions[j].size() < (clusters[j] + 1)) {
-          solutions[j].push_back({});
-          solutionPoints[j].push_back({});
-          solutionPointsIdx[j].push_back({});
-        }
-        // Save the current Point in it's respective cluster. (Depends if a new
-        // cluster was defined above)
-        solutionPoints[j][clusters[j]].push_back(p);
-        solutionPointsIdx[j][clusters[j]].push_back(idx);
-        solutions[j][clusters[j]].push_back(idx);
+        addPoint(j, thetaIndexVector_[i + j].second);
       }
     }
   }
@@ -322,62 +306,10 @@ bool SinkClustering::findBestMatching(const unsigned groupSize)
   // Same computation as above, however, only for the first groupSize Points.
   for (unsigned i = 0; i < groupSize; ++i) {
     // This is because every solution after the first one skips a Point (starts
-    // one late).
+    // one late).  Thus here we will assign the Points missing from those
+    // solutions.
     for (unsigned j = (i + 1); j < groupSize; ++j) {
-      if (solutions[j].size() < (clusters[j] + 1)) {
-        solutions[j].push_back({});
-        solutionPoints[j].push_back({});
-        solutionPointsIdx[j].push_back({});
-      }
-      // Thus here we will assign the Points missing from those solutions.
-      const unsigned idx = thetaIndexVector_[i].second;
-      const Point<double>& p = points_[idx];
-      unsigned pointIdx = 0;
-      double distanceCost = 0;
-      double capCost = pointsCap_[idx];
-      for (Point<double> comparisonPoint : solutionPoints[j][clusters[j]]) {
-        const double cost = HTree_->computeDist(p, comparisonPoint);
-        if (useMaxCapLimit_) {
-          capCost += cost * capPerUnit_
-                     + pointsCap_[solutionPointsIdx[j][clusters[j]][pointIdx]];
-        }
-        pointIdx++;
-        if (cost > distanceCost) {
-          distanceCost = cost;
-        }
-      }
-
-      if (isLimitExceeded(solutionPoints[j][clusters[j]].size(),
-                          distanceCost,
-                          capCost,
-                          groupSize)) {
-        debugPrint(logger_,
-                   CTS,
-                   "Stree",
-                   4,
-                   "Created cluster of size {}, dia {:.3}, cap {:.3e}",
-                   solutionPoints[j][clusters[j]].size(),
-                   distanceCost,
-                   capCost);
-        if (previousCosts[j] == 0) {
-          previousCosts[j] = maxInternalDiameter_;
-        }
-        costs[j] += previousCosts[j];
-        clusters[j] = clusters[j] + 1;
-        previousCosts[j] = 0;
-      } else {
-        if (distanceCost > previousCosts[j]) {
-          previousCosts[j] = distanceCost;
-        }
-      }
-      if (solutions[j].size() < (clusters[j] + 1)) {
-        solutions[j].push_back({});
-        solutionPoints[j].push_back({});
-        solutionPointsIdx[j].push_back({});
-      }
-      solutionPoints[j][clusters[j]].push_back(p);
-      solutionPointsIdx[j][clusters[j]].push_back(idx);
-      solutions[j][clusters[j]].push_back(idx);
+      addPoint(j, thetaIndexVector_[i].second);
     }
   }
 
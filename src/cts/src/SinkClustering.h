@@ -100,6 +100,12 @@ class SinkClustering
   bool findBestMatching(unsigned groupSize);
   void writePlotFile(unsigned groupSize);
 
+  // Same as TreeBuilder::computeDist with the cached insertion delays.
+  double computeDist(unsigned idx1, unsigned idx2) const
+  {
+    return points_[idx1].computeDist(points_[idx2]) + pointsInsDelay_[idx1]
+           + pointsInsDelay_[idx2];
+  }
   double computeTheta(double x, double y) const;
   unsigned numVertex(unsigned x, unsigned y) const;
 
@@ -115,6 +121,7 @@ class SinkClustering
   const TechChar* techChar_;
   std::vector<Point<double>> points_;
   std::vector<float> pointsCap_;
+  std::vector<double> pointsInsDelay_;
   std::vector<std::pair<double, unsigned>> thetaIndexVector_;
   std::vector<Matching> matchings_;
   std::map<unsigned, std::vector<Point<double>>> sinkClusters_;
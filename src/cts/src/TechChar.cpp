@@ -36,10 +36,13 @@
 #include "TechChar.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <map>
 #include <ostream>
 #include <sstream>
+#include <thread>
 
 #include "db_sta/dbSta.hh"
 #include "rsz/Resizer.hh"
@@ -57,6 +60,28 @@ namespace cts {
 
 using utl::CTS;
 
+namespace {
+
+// FNV-1a hash of the file contents, 0 when the file cannot be read.
+uint64_t hashFile(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) {
+    return 0;
+  }
+  uint64_t hash = 14695981039346656037ULL;
+  std::vector<char> buffer(1 << 16);
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+    for (std::streamsize i = 0; i < file.gcount(); i++) {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+}  // namespace
+
 TechChar::TechChar(CtsOptions* options,
                    odb::dbDatabase* db,
                    sta::dbSta* sta,
@@ -67,7 +92,6 @@ TechChar::TechChar(CtsOptions* options,
       db_(db),
       resizer_(resizer),
       openSta_(sta),
-      openStaChar_(nullptr),
       db_network_(db_network),
       logger_(logger),
       resPerDBU_(0.0),
@@ -218,13 +242,19 @@ void TechChar::forEachWireSegment(
   for (unsigned idx = 0; idx < wireSegments_.size(); ++idx) {
     func(idx, wireSegments_[idx]);
   }
+  if (fakeEntriesCreated_) {
+    for (unsigned idx = 0; idx < fakeWireSegments_.size(); ++idx) {
+      func(wireSegments_.size() + idx, fakeWireSegments_[idx]);
+    }
+  }
 };
 
 void TechChar::forEachWireSegment(
     uint8_t length,
     uint8_t load,
     uint8_t outputSlew,
-    const std::function<void(unsigned, const WireSegment&)>& func) const
+    const std::function<void(unsigned, const WireSegment&)>& func,
+    bool withFakeEntries) const
 {
   const unsigned key = computeKey(length, load, outputSlew);
 
@@ -234,6 +264,15 @@ void TechChar::forEachWireSegment(
       func(idx, wireSegments_[idx]);
     }
   }
+
+  if (withFakeEntries && fakeEntriesCreated_) {
+    auto it = keyToFakeWireSegments_.find(key);
+    if (it != keyToFakeWireSegments_.end()) {
+      for (unsigned idx : it->second) {
+        func(idx, getWireSegment(idx));
+      }
+    }
+  }
 }
 
 void TechChar::report() const
@@ -382,6 +421,11 @@ void TechChar::createFakeEntries(unsigned length, unsigned fakeLength)
   if (length == fakeLength) {
     return;
   }
+  // The fake entries are the same for every tree
+  std::lock_guard<std::mutex> lock(fakeEntriesMutex_);
+  if (fakeEntriesCreated_) {
+    return;
+  }
 
   if (logger_->debugCheck(utl::CTS, "tech char", 1)) {
     logger_->warn(CTS, 45, "Creating fake entries in the LUT.");
@@ -395,16 +439,22 @@ void TechChar::createFakeEntries(unsigned length, unsigned fakeLength)
             const unsigned inputCap = seg.getInputCap();
             const unsigned inputSlew = seg.getInputSlew();
 
-            WireSegment& fakeSeg = createWireSegment(
+            fakeWireSegments_.emplace_back(
                 fakeLength, load, outSlew, power, delay, inputCap, inputSlew);
+            WireSegment& fakeSeg = fakeWireSegments_.back();
+            const unsigned fakeKey = computeKey(fakeLength, load, outSlew);
+            keyToFakeWireSegments_[fakeKey].push_back(
+                wireSegments_.size() + fakeWireSegments_.size() - 1);
 
             for (unsigned buf = 0; buf < seg.getNumBuffers(); ++buf) {
               fakeSeg.addBuffer(seg.getBufferLocation(buf));
               fakeSeg.addBufferMaster(seg.getBufferMaster(buf));
             }
-          });
+          },
+          false);
     }
   }
+  fakeEntriesCreated_ = true;
 }
 
 void TechChar::reportSegment(unsigned key) const
@@ -537,14 +587,6 @@ void TechChar::initCharacterization()
     logger_->error(
         CTS, 541, "Could not find buffer output port for {}.", bufMasterName);
   }
-  // Creates the new characterization block. (Wiresegments are created here
-  // instead of the main block)
-  const char* characterizationBlockName = "CharacterizationBlock";
-  if (auto char_block = block->findChild(characterizationBlockName)) {
-    odb::dbBlock::destroy(char_block);
-  }
-  charBlock_ = odb::dbBlock::create(block, characterizationBlockName);
-
   // Defines the different wirelengths to test and the characterization unit.
   const unsigned wirelengthIterations = options_->getCharWirelengthIterations();
   unsigned maxWirelength = (charBuf_->getHeight() * 10)
@@ -939,7 +981,10 @@ std::vector<float>::iterator TechChar::largestDiffIter(
 }
 
 std::vector<TechChar::SolutionData> TechChar::createPatterns(
-    unsigned setupWirelength)
+    odb::dbBlock* block,
+    unsigned setupWirelength,
+    unsigned firstTopology,
+    unsigned lastTopology)
 {
   // Sets the number of nodes (wirelength/characterization unit) that a buffer
   // can be placed and...
@@ -955,7 +1000,8 @@ std::vector<TechChar::SolutionData> TechChar::createPatterns(
              "#topo:{}", setupWirelength, numberOfNodes, numberOfTopologies);
   // clang-format on
   // For each possible topology...
-  for (unsigned solutionCounterInt = 0; solutionCounterInt < numberOfTopologies;
+  for (unsigned solutionCounterInt = firstTopology;
+       solutionCounterInt < std::min(lastTopology, numberOfTopologies);
        solutionCounterInt++) {
     // Creates a bitset that represents the buffer locations.
     const std::bitset<5> solutionCounter(solutionCounterInt);
@@ -965,7 +1011,7 @@ std::vector<TechChar::SolutionData> TechChar::createPatterns(
     const std::string netName = "net_" + std::to_string(setupWirelength) + "_"
                                 + solutionCounter.to_string() + "_"
                                 + std::to_string(wireCounter);
-    net = odb::dbNet::create(charBlock_, netName.c_str());
+    net = odb::dbNet::create(block, netName.c_str());
     odb::dbWire::create(net);
     net->setSigType(odb::dbSigType::SIGNAL);
     // Creates the input port.
@@ -1000,7 +1046,7 @@ std::vector<TechChar::SolutionData> TechChar::createPatterns(
                    "topo:{}", bufName, nodeIndex, solutionCounterInt);
         // clang-format on
         odb::dbInst* bufInstance
-            = odb::dbInst::create(charBlock_, charBuf_, bufName.c_str());
+            = odb::dbInst::create(block, charBuf_, bufName.c_str());
         odb::dbITerm* bufInstanceInPin = bufInstance->getITerm(charBufIn_);
         odb::dbITerm* bufInstanceOutPin = bufInstance->getITerm(charBufOut_);
         bufInstanceInPin->connect(net);
@@ -1013,7 +1059,7 @@ std::vector<TechChar::SolutionData> TechChar::createPatterns(
         const std::string netName = "net_" + std::to_string(setupWirelength)
                                     + "_" + solutionCounter.to_string() + "_"
                                     + std::to_string(wireCounter);
-        net = odb::dbNet::create(charBlock_, netName.c_str());
+        net = odb::dbNet::create(block, netName.c_str());
         odb::dbWire::create(net);
         bufInstanceOutPin->connect(net);
         net->setSigType(odb::dbSigType::SIGNAL);
@@ -1058,26 +1104,24 @@ std::vector<TechChar::SolutionData> TechChar::createPatterns(
   return topologiesVector;
 }
 
-void TechChar::createStaInstance()
+void TechChar::createStaInstance(CharTask& task)
 {
   // Creates a new OpenSTA instance that is used only for the
   // characterization. Creates the new instance based on the charcterization
   // block.
-  openStaChar_ = openSta_->makeBlockSta(charBlock_);
+  task.sta = openSta_->makeBlockSta(task.block);
   // Gets the corner and other analysis attributes from the new instance.
-  charCorner_ = openStaChar_->cmdCorner();
+  task.corner = task.sta->cmdCorner();
   sta::PathAPIndex path_ap_index
-      = charCorner_->findPathAnalysisPt(sta::MinMax::max())->index();
-  sta::Corners* corners = openStaChar_->search()->corners();
-  charPathAnalysis_ = corners->findPathAnalysisPt(path_ap_index);
+      = task.corner->findPathAnalysisPt(sta::MinMax::max())->index();
+  sta::Corners* corners = task.sta->search()->corners();
+  task.pathAnalysis = corners->findPathAnalysisPt(path_ap_index);
 }
 
-void TechChar::setParasitics(
-    const std::vector<TechChar::SolutionData>& topologiesVector,
-    unsigned setupWirelength)
+void TechChar::setParasitics(CharTask& task)
 {
   // For each topology...
-  for (const SolutionData& solution : topologiesVector) {
+  for (const SolutionData& solution : task.topologies) {
     // For each net in the topolgy -> set the parasitics.
     for (unsigned netIndex = 0; netIndex < solution.netVector.size();
          ++netIndex) {
@@ -1130,28 +1174,29 @@ void TechChar::setParasitics(
       const unsigned charUnit = options_->getWireSegmentUnit();
       const double wire_cap = nodesWithoutBuf * charUnit * capPerDBU_;
       const double wire_res = nodesWithoutBuf * charUnit * resPerDBU_;
-      openStaChar_->makePiElmore(firstPin,
-                                 sta::RiseFall::rise(),
-                                 sta::MinMaxAll::all(),
-                                 wire_cap / 2,
-                                 wire_res,
-                                 wire_cap / 2);
-      openStaChar_->setElmore(firstPin,
-                              lastPin,
-                              sta::RiseFall::rise(),
-                              sta::MinMaxAll::all(),
-                              wire_res * wire_cap);
+      task.sta->makePiElmore(firstPin,
+                             sta::RiseFall::rise(),
+                             sta::MinMaxAll::all(),
+                             wire_cap / 2,
+                             wire_res,
+                             wire_cap / 2);
+      task.sta->setElmore(firstPin,
+                          lastPin,
+                          sta::RiseFall::rise(),
+                          sta::MinMaxAll::all(),
+                          wire_res * wire_cap);
     }
   }
 }
 
 TechChar::ResultData TechChar::computeTopologyResults(
+    const CharTask& task,
     const TechChar::SolutionData& solution,
     sta::Vertex* outPinVert,
     float load,
-    float inSlew,
-    unsigned setupWirelength)
+    float inSlew)
 {
+  const unsigned setupWirelength = task.wirelength;
   ResultData results;
   results.wirelength = setupWirelength;
   results.topology = solution.topologyDescriptor;
@@ -1166,7 +1211,7 @@ TechChar::ResultData TechChar::computeTopologyResults(
     for (odb::dbInst* bufferInst : solution.instVector) {
       sta::Instance* bufferInstSta = db_network_->dbToSta(bufferInst);
       sta::PowerResult instResults
-          = openStaChar_->power(bufferInstSta, charCorner_);
+          = task.sta->power(bufferInstSta, task.corner);
       totalPower = totalPower + instResults.total();
     }
   }
@@ -1191,13 +1236,13 @@ TechChar::ResultData TechChar::computeTopologyResults(
       = std::round(incap / charCapStepSize_) * charCapStepSize_;
   results.totalcap = totalcap;
   // Computations for delay.
-  const float pinArrival = openStaChar_->vertexArrival(
-      outPinVert, sta::RiseFall::fall(), charPathAnalysis_);
+  const float pinArrival = task.sta->vertexArrival(
+      outPinVert, sta::RiseFall::fall(), task.pathAnalysis);
   results.pinArrival = pinArrival;
   // Computations for output slew.
-  const float pinRise = openStaChar_->vertexSlew(
+  const float pinRise = task.sta->vertexSlew(
       outPinVert, sta::RiseFall::rise(), sta::MinMax::max());
-  const float pinFall = openStaChar_->vertexSlew(
+  const float pinFall = task.sta->vertexSlew(
       outPinVert, sta::RiseFall::fall(), sta::MinMax::max());
   const float pinSlew = std::round((pinRise + pinFall) / 2 / charSlewStepSize_)
                         * charSlewStepSize_;
@@ -1545,148 +1590,392 @@ void TechChar::create()
 {
   // Setup of the attributes required to run the characterization.
   initCharacterization();
-  long unsigned int topologiesCreated = 0;
+  fakeWireSegments_.clear();
+  keyToFakeWireSegments_.clear();
+  fakeEntriesCreated_ = false;
+
+  // The post-processed results only depend on the inputs in cacheKey(), so
+  // they are read back from the cache file when it matches.
+  const std::string cache_file = options_->getCharCacheFile();
+  std::vector<ResultData> convertedSolutions;
+  if (cache_file.empty() || !readCache(cache_file, convertedSolutions)) {
+    characterize();
+    // Post-processing of the results.
+    convertedSolutions = characterizationPostProcess();
+    if (!cache_file.empty()) {
+      writeCache(cache_file, convertedSolutions);
+    }
+  }
+  compileLut(convertedSolutions);
+  if (logger_->debugCheck(CTS, "characterization", 3)) {
+    printCharacterization();
+    printSolution();
+  }
+}
+
+void TechChar::characterize()
+{
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  // The topologies of a wirelength are split in one task per thread.  They
+  // are not connected to each other, so the split does not change their
+  // results.
+  int thread_count = openSta_->threadCount();
+  if (logger_->debugCheck(CTS, "tech char", 1)) {
+    thread_count = 1;
+  }
+
+  // Blocks, patterns and STA instances are made serially because odb is
+  // not thread safe.
+  std::vector<CharTask> tasks;
   for (unsigned setupWirelength : wirelengthsToTest_) {
-    // Creates the topologies for the current wirelength.
-    std::vector<SolutionData> topologiesVector
-        = createPatterns(setupWirelength);
-    // Creates an OpenSTA instance.
-    createStaInstance();
-    // Setup of the parasitics for each net.
-    setParasitics(topologiesVector, setupWirelength);
-    // For each topology...
-    sta::Graph* graph = openStaChar_->ensureGraph();
-    int topoIndex = 0;
-    for (SolutionData solution : topologiesVector) {
-      // clang-format off
-      debugPrint(logger_, CTS, "tech char", 1, "create WL:{} of {}, "
-                 "topo:{} of {}", setupWirelength, wirelengthsToTest_.size(),
-                 topoIndex, topologiesVector.size());
-      // clang-format on
-      topoIndex++;
-      // Gets the input and output port (as terms, pins and vertices).
-      odb::dbBTerm* inBTerm = solution.inPort->getBTerm();
-      odb::dbBTerm* outBTerm = solution.outPort->getBTerm();
-      odb::dbNet* lastNet = solution.netVector.back();
-      sta::Pin* inPin = db_network_->dbToSta(inBTerm);
-      sta::Pin* outPin = db_network_->dbToSta(outBTerm);
-      sta::Vertex* outPinVert = graph->pinLoadVertex(outPin);
-      sta::Vertex* inPinVert = graph->pinDrvrVertex(inPin);
-
-      // Gets the first pin of the last net. Needed to set a new parasitic
-      // (load) value.
-      sta::Pin* firstPinLastNet = nullptr;
-      if (lastNet->getBTerms().size() > 1) {
-        // Parasitics for purewire segment.
-        // First and last pin are already available.
-        firstPinLastNet = inPin;
-      } else {
-        // Parasitics for the end/start of a net. One Port and one
-        // instance pin.
-        odb::dbITerm* netITerm = lastNet->get1stITerm();
-        firstPinLastNet = db_network_->dbToSta(netITerm);
+    const unsigned numberOfTopologies
+        = 1 << (setupWirelength / options_->getWireSegmentUnit());
+    const unsigned chunk
+        = (numberOfTopologies + thread_count - 1) / thread_count;
+    for (unsigned first = 0; first < numberOfTopologies; first += chunk) {
+      CharTask task;
+      task.wirelength = setupWirelength;
+      // Creates the new characterization block. (Wiresegments are created
+      // here instead of the main block)
+      const std::string blockName
+          = "CharacterizationBlock" + std::to_string(tasks.size());
+      if (auto char_block = block->findChild(blockName.c_str())) {
+        odb::dbBlock::destroy(char_block);
+      }
+      task.block = odb::dbBlock::create(block, blockName.c_str());
+      // Creates the topologies for the current wirelength.
+      task.topologies = createPatterns(
+          task.block,
+          setupWirelength,
+          first,
+          std::min(first + chunk, numberOfTopologies));
+      // Creates an OpenSTA instance.
+      createStaInstance(task);
+      if (thread_count > 1) {
+        // Fill the combination table before it is read by the threads.
+        for (const SolutionData& solution : task.topologies) {
+          getBufferingCombo(masterNames_.size(), solution.instVector.size());
+        }
       }
+      tasks.push_back(std::move(task));
+    }
+  }
 
-      float c1, c2, r1;
-      bool piExists = false;
-      // Gets the parasitics that are currently used for the last net.
-      openStaChar_->findPiElmore(firstPinLastNet,
-                                 sta::RiseFall::rise(),
-                                 sta::MinMax::max(),
-                                 c2,
-                                 r1,
-                                 c1,
-                                 piExists);
-      // For each possible buffer combination (different sizes).
-      unsigned buffersUpdate
-          = getBufferingCombo(masterNames_.size(), solution.instVector.size());
-      // clang-format off
-      debugPrint(logger_, CTS, "tech char", 1, "create #bufs={} "
-                 "#soln.instVector.size={}, #bufUpdate={}, #topo={}",
-                 masterNames_.size(), solution.instVector.size(),
-                 buffersUpdate, topologiesCreated);
-      // clang-format on
-      do {
-        // For each possible load.
-        for (float load : loadsToTest_) {
-          // Sets the new parasitic of the last net (load added to last pin).
-          openStaChar_->makePiElmore(firstPinLastNet,
-                                     sta::RiseFall::rise(),
-                                     sta::MinMaxAll::all(),
-                                     c2,
-                                     r1,
-                                     c1 + load);
-          openStaChar_->setElmore(firstPinLastNet,
-                                  outPin,
-                                  sta::RiseFall::rise(),
-                                  sta::MinMaxAll::all(),
-                                  r1 * (c1 + c2 + load));
-          // For each possible input slew.
-          for (float inputslew : slewsToTest_) {
-            // Sets the slew on the input vertex.
-            // Here the new pattern is created (combination of load, buffers
-            // and slew values).
-            openStaChar_->setAnnotatedSlew(inPinVert,
-                                           charCorner_,
-                                           sta::MinMaxAll::all(),
-                                           sta::RiseFallBoth::riseFall(),
-                                           inputslew);
-            // Updates timing for the new pattern.
-            openStaChar_->updateTiming(true);
-
-            // Gets the results (delay, slew, power...) for the pattern.
-            ResultData results = computeTopologyResults(
-                solution, outPinVert, load, inputslew, setupWirelength);
-
-            // Appends the results to a map, grouping each result by
-            // wirelength, load, output slew and input cap.
-            CharKey solutionKey;
-            solutionKey.wirelength = results.wirelength;
-            solutionKey.pinSlew = results.pinSlew;
-            solutionKey.load = results.load;
-            solutionKey.totalcap = results.totalcap;
-            if (solutionMap_.find(solutionKey) != solutionMap_.end()) {
-              solutionMap_[solutionKey].push_back(results);
-            } else {
-              std::vector<ResultData> resultGroup;
-              resultGroup.push_back(results);
-              solutionMap_[solutionKey] = std::move(resultGroup);
-            }
-            topologiesCreated++;
-            if (logger_->debugCheck(utl::CTS, "tech char", 1)
-                && topologiesCreated % 50000 == 0) {
-              debugPrint(logger_,
-                         CTS,
-                         "tech char",
-                         1,
-                         "Number of created patterns = {}.",
-                         topologiesCreated);
-            }
-          }  // for each slew
-        }    // for each load
-        // If the solution is not a pure-wire, update the buffer topologies.
-        if (!solution.isPureWire) {
-          updateBufferTopologies(solution);
+  // Times every task with the current buffer combination of its topologies.
+  auto time_tasks = [&](bool first_round) {
+    auto time_task = [&](CharTask& task) {
+      if (first_round) {
+        initTaskTiming(task);
+      }
+      timeTaskCombination(task);
+    };
+    if (thread_count > 1) {
+      std::atomic<size_t> next_task{0};
+      auto time_next_tasks = [&]() {
+        for (size_t i = next_task++; i < tasks.size(); i = next_task++) {
+          time_task(tasks[i]);
         }
-        // For pure-wire solution buffersUpdate == 1, so it only runs once.
-        buffersUpdate--;
-      } while (buffersUpdate != 0);
+      };
+      std::vector<std::thread> threads;
+      for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back(time_next_tasks);
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    } else {
+      for (CharTask& task : tasks) {
+        time_task(task);
+      }
+    }
+  };
+
+  // Swapping a buffer master edits odb and fires the dbSta callbacks, so it
+  // is done here on the main thread while no task is being timed.
+  bool pending = true;
+  for (bool first_round = true; pending; first_round = false) {
+    time_tasks(first_round);
+    pending = false;
+    for (CharTask& task : tasks) {
+      pending |= nextTaskCombination(task);
     }
-    openStaChar_.reset(nullptr);
+  }
+
+  // Appends the results to a map, grouping each result by wirelength, load,
+  // output slew and input cap.  The results are merged by task and topology
+  // so the groups match a serial characterization.
+  long unsigned int topologiesCreated = 0;
+  for (CharTask& task : tasks) {
+    for (TopologyTiming& timing : task.timings) {
+      for (ResultData& results : timing.results) {
+        CharKey solutionKey;
+        solutionKey.wirelength = results.wirelength;
+        solutionKey.pinSlew = results.pinSlew;
+        solutionKey.load = results.load;
+        solutionKey.totalcap = results.totalcap;
+        solutionMap_[solutionKey].push_back(std::move(results));
+      }
+      topologiesCreated += timing.results.size();
+    }
+    task.sta.reset();
+    odb::dbBlock::destroy(task.block);
   }
   if (logger_->debugCheck(utl::CTS, "tech char", 1)) {
     logger_->info(
         CTS, 39, "Number of created patterns = {}.", topologiesCreated);
   }
-  // Post-processing of the results.
-  const std::vector<ResultData> convertedSolutions
-      = characterizationPostProcess();
-  compileLut(convertedSolutions);
-  if (logger_->debugCheck(CTS, "characterization", 3)) {
-    printCharacterization();
-    printSolution();
+}
+
+void TechChar::initTaskTiming(CharTask& task)
+{
+  // Setup of the parasitics for each net.
+  setParasitics(task);
+  sta::Graph* graph = task.sta->ensureGraph();
+  task.timings.resize(task.topologies.size());
+  for (size_t i = 0; i < task.topologies.size(); i++) {
+    const SolutionData& solution = task.topologies[i];
+    TopologyTiming& timing = task.timings[i];
+    // Gets the input and output port (as terms, pins and vertices).
+    odb::dbBTerm* inBTerm = solution.inPort->getBTerm();
+    odb::dbBTerm* outBTerm = solution.outPort->getBTerm();
+    odb::dbNet* lastNet = solution.netVector.back();
+    sta::Pin* inPin = db_network_->dbToSta(inBTerm);
+    timing.outPin = db_network_->dbToSta(outBTerm);
+    timing.outPinVert = graph->pinLoadVertex(timing.outPin);
+    timing.inPinVert = graph->pinDrvrVertex(inPin);
+
+    // Gets the first pin of the last net. Needed to set a new parasitic
+    // (load) value.
+    if (lastNet->getBTerms().size() > 1) {
+      // Parasitics for purewire segment.
+      // First and last pin are already available.
+      timing.firstPinLastNet = inPin;
+    } else {
+      // Parasitics for the end/start of a net. One Port and one
+      // instance pin.
+      odb::dbITerm* netITerm = lastNet->get1stITerm();
+      timing.firstPinLastNet = db_network_->dbToSta(netITerm);
+    }
+
+    bool piExists = false;
+    // Gets the parasitics that are currently used for the last net.
+    task.sta->findPiElmore(timing.firstPinLastNet,
+                           sta::RiseFall::rise(),
+                           sta::MinMax::max(),
+                           timing.c2,
+                           timing.r1,
+                           timing.c1,
+                           piExists);
+    // For each possible buffer combination (different sizes).
+    timing.buffersUpdate
+        = getBufferingCombo(masterNames_.size(), solution.instVector.size());
+    // clang-format off
+    debugPrint(logger_, CTS, "tech char", 1, "create #bufs={} "
+               "#soln.instVector.size={}, #bufUpdate={}",
+               masterNames_.size(), solution.instVector.size(),
+               timing.buffersUpdate);
+    // clang-format on
+  }
+}
+
+void TechChar::timeTaskCombination(CharTask& task)
+{
+  // For each topology that has a buffer combination left...
+  for (size_t i = 0; i < task.topologies.size(); i++) {
+    const SolutionData& solution = task.topologies[i];
+    TopologyTiming& timing = task.timings[i];
+    if (timing.buffersUpdate == 0) {
+      continue;
+    }
+    // clang-format off
+    debugPrint(logger_, CTS, "tech char", 1, "create WL:{} of {}, "
+               "topo:{} of {}", task.wirelength, wirelengthsToTest_.size(),
+               i, task.topologies.size());
+    // clang-format on
+    // For each possible load.
+    for (float load : loadsToTest_) {
+      // Sets the new parasitic of the last net (load added to last pin).
+      task.sta->makePiElmore(timing.firstPinLastNet,
+                             sta::RiseFall::rise(),
+                             sta::MinMaxAll::all(),
+                             timing.c2,
+                             timing.r1,
+                             timing.c1 + load);
+      task.sta->setElmore(timing.firstPinLastNet,
+                          timing.outPin,
+                          sta::RiseFall::rise(),
+                          sta::MinMaxAll::all(),
+                          timing.r1 * (timing.c1 + timing.c2 + load));
+      // For each possible input slew.
+      for (float inputslew : slewsToTest_) {
+        // Sets the slew on the input vertex.
+        // Here the new pattern is created (combination of load, buffers
+        // and slew values).
+        task.sta->setAnnotatedSlew(timing.inPinVert,
+                                   task.corner,
+                                   sta::MinMaxAll::all(),
+                                   sta::RiseFallBoth::riseFall(),
+                                   inputslew);
+        // Updates timing for the new pattern.
+        task.sta->updateTiming(true);
+
+        // Gets the results (delay, slew, power...) for the pattern.
+        timing.results.push_back(computeTopologyResults(
+            task, solution, timing.outPinVert, load, inputslew));
+      }  // for each slew
+    }    // for each load
+  }
+}
+
+bool TechChar::nextTaskCombination(CharTask& task)
+{
+  bool pending = false;
+  for (size_t i = 0; i < task.topologies.size(); i++) {
+    TopologyTiming& timing = task.timings[i];
+    if (timing.buffersUpdate == 0) {
+      continue;
+    }
+    // For pure-wire solution buffersUpdate == 1, so it only runs once.
+    timing.buffersUpdate--;
+    if (timing.buffersUpdate != 0) {
+      // If the solution is not a pure-wire, update the buffer topologies.
+      if (!task.topologies[i].isPureWire) {
+        updateBufferTopologies(task.topologies[i]);
+      }
+      pending = true;
+    }
+  }
+  return pending;
+}
+
+// Every input of the characterization that changes its results.
+std::string TechChar::cacheKey() const
+{
+  // resPerDBU_ and capPerDBU_ are the clock wire RC of the corner.
+  std::string key = fmt::format("cts_char 2 {} {} {} {} {} {} {}",
+                                charBuf_->getName(),
+                                charBufIn_->getName(),
+                                options_->getWireSegmentUnit(),
+                                options_->getMaxCharSlew(),
+                                resPerDBU_,
+                                capPerDBU_,
+                                charSlewStepSize_);
+  key += fmt::format(
+      " {} {}", charCapStepSize_, openSta_->cmdCorner()->name());
+  // The liberty files are identified by their contents, so an edited
+  // library does not reuse the results of the old one.
+  std::map<std::string, uint64_t> file_hashes;
+  for (const std::string& master_name : masterNames_) {
+    odb::dbMaster* master = db_->findMaster(master_name.c_str());
+    const sta::LibertyCell* cell
+        = db_network_->libertyCell(db_network_->dbToSta(master));
+    const std::string file_name = cell->libertyLibrary()->filename();
+    auto it = file_hashes.find(file_name);
+    if (it == file_hashes.end()) {
+      it = file_hashes.emplace(file_name, hashFile(file_name)).first;
+    }
+    key += fmt::format(" {} {} {:016x}", master_name, file_name, it->second);
+  }
+  for (unsigned wirelength : wirelengthsToTest_) {
+    key += fmt::format(" w{}", wirelength);
+  }
+  for (float load : loadsToTest_) {
+    key += fmt::format(" l{}", load);
+  }
+  for (float slew : slewsToTest_) {
+    key += fmt::format(" s{}", slew);
+  }
+  return key;
+}
+
+bool TechChar::readCache(const std::string& file_name,
+                         std::vector<ResultData>& solutions)
+{
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    return false;
+  }
+  std::string key;
+  std::getline(file, key);
+  size_t count = 0;
+  unsigned minSlew, maxSlew, minCap, maxCap, minLength, maxLength;
+  file >> minSlew >> maxSlew >> minCap >> maxCap >> minLength >> maxLength
+      >> count;
+  if (key != cacheKey() || !file) {
+    logger_->info(CTS,
+                  127,
+                  "Characterization cache {} does not match the current "
+                  "setup.",
+                  file_name);
+    return false;
+  }
+  solutions.resize(count);
+  for (ResultData& solution : solutions) {
+    size_t topologySize = 0;
+    file >> solution.load >> solution.inSlew >> solution.wirelength
+        >> solution.pinSlew >> solution.pinArrival >> solution.totalcap
+        >> solution.totalPower >> solution.isPureWire >> topologySize;
+    solution.topology.resize(topologySize);
+    for (std::string& element : solution.topology) {
+      file >> element;
+    }
+  }
+  if (!file) {
+    logger_->warn(
+        CTS, 128, "Characterization cache {} is truncated.", file_name);
+    solutions.clear();
+    return false;
+  }
+
+  minSlew_ = minSlew;
+  maxSlew_ = maxSlew;
+  minCapacitance_ = minCap;
+  maxCapacitance_ = maxCap;
+  minSegmentLength_ = minLength;
+  maxSegmentLength_ = maxLength;
+  logger_->info(CTS,
+                126,
+                "Read {} characterization results from {}.",
+                solutions.size(),
+                file_name);
+  return true;
+}
+
+void TechChar::writeCache(const std::string& file_name,
+                          const std::vector<ResultData>& solutions) const
+{
+  std::ofstream file(file_name);
+  if (!file.is_open()) {
+    logger_->warn(
+        CTS, 129, "Cannot write characterization cache {}.", file_name);
+    return;
+  }
+  // fmt writes the shortest float that reads back to the same value.
+  file << cacheKey() << "\n";
+  file << fmt::format("{} {} {} {} {} {}\n{}\n",
+                      minSlew_,
+                      maxSlew_,
+                      minCapacitance_,
+                      maxCapacitance_,
+                      minSegmentLength_,
+                      maxSegmentLength_,
+                      solutions.size());
+  for (const ResultData& solution : solutions) {
+    file << fmt::format("{} {} {} {} {} {} {} {} {}",
+                        solution.load,
+                        solution.inSlew,
+                        solution.wirelength,
+                        solution.pinSlew,
+                        solution.pinArrival,
+                        solution.totalcap,
+                        solution.totalPower,
+                        static_cast<int>(solution.isPureWire),
+                        solution.topology.size());
+    for (const std::string& element : solution.topology) {
+      file << " " << element;
+    }
+    file << "\n";
   }
-  odb::dbBlock::destroy(charBlock_);
 }
 
 // Compute possible buffering solution combinations given #buffers and
@@ -36,6 +36,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <boost/functional/hash.hpp>
 #include <boost/unordered/unordered_map.hpp>
@@ -45,6 +46,8 @@
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -172,11 +175,15 @@ class TechChar
       uint8_t length,
       uint8_t load,
       uint8_t outputSlew,
-      const std::function<void(unsigned, const WireSegment&)>& func) const;
+      const std::function<void(unsigned, const WireSegment&)>& func,
+      bool withFakeEntries = true) const;
 
   const WireSegment& getWireSegment(unsigned idx) const
   {
-    return wireSegments_[idx];
+    if (idx < wireSegments_.size()) {
+      return wireSegments_[idx];
+    }
+    return fakeWireSegments_[idx - wireSegments_.size()];
   }
 
   unsigned getMinSegmentLength() const { return minSegmentLength_; }
@@ -187,7 +194,13 @@ class TechChar
   unsigned getActualMinInputCap() const { return actualMinInputCap_; }
   unsigned getLengthUnit() const { return lengthUnit_; }
 
+  // The fake entries are created by the first tree that needs them and
+  // are kept apart from the characterized segments, so trees being built
+  // on other threads can read the LUT meanwhile.  forEachWireSegment skips
+  // them unless withFakeEntries is set.  Every tree asks for the same
+  // entries, so they are only created once.
   void createFakeEntries(unsigned length, unsigned fakeLength);
+  bool hasFakeEntries() const { return fakeEntriesCreated_; }
 
   double getCapPerDBU() const { return capPerDBU_; }
   utl::Logger* getLogger() { return options_->getLogger(); }
@@ -237,6 +250,36 @@ class TechChar
     }
   };
 
+  // Timing state of one topology that is kept between its buffer
+  // combinations.
+  struct TopologyTiming
+  {
+    sta::Pin* outPin = nullptr;
+    sta::Pin* firstPinLastNet = nullptr;
+    sta::Vertex* inPinVert = nullptr;
+    sta::Vertex* outPinVert = nullptr;
+    float c1 = 0.0;
+    float c2 = 0.0;
+    float r1 = 0.0;
+    unsigned buffersUpdate = 0;
+    std::vector<ResultData> results;
+  };
+
+  // A set of topologies of one wirelength is timed in its own block with its
+  // own STA instance, so the sets can be timed on separate threads.  The
+  // buffer masters are only swapped on the main thread, between two timing
+  // rounds.
+  struct CharTask
+  {
+    unsigned wirelength = 0;
+    odb::dbBlock* block = nullptr;
+    std::vector<SolutionData> topologies;
+    std::vector<TopologyTiming> timings;
+    std::unique_ptr<sta::dbSta> sta;
+    sta::Corner* corner = nullptr;
+    sta::PathAnalysisPt* pathAnalysis = nullptr;
+  };
+
   using Key = uint32_t;
 
   void printCharacterization() const;
@@ -282,15 +325,26 @@ class TechChar
   void reduceOrExpand(std::vector<float>& values, unsigned limit);
   std::vector<float>::iterator smallestDiffIter(std::vector<float>& values);
   std::vector<float>::iterator largestDiffIter(std::vector<float>& values);
-  std::vector<SolutionData> createPatterns(unsigned setupWirelength);
-  void createStaInstance();
-  void setParasitics(const std::vector<SolutionData>& topologiesVector,
-                     unsigned setupWirelength);
-  ResultData computeTopologyResults(const SolutionData& solution,
+  std::vector<SolutionData> createPatterns(odb::dbBlock* block,
+                                          unsigned setupWirelength,
+                                          unsigned firstTopology,
+                                          unsigned lastTopology);
+  void createStaInstance(CharTask& task);
+  void setParasitics(CharTask& task);
+  ResultData computeTopologyResults(const CharTask& task,
+                                    const SolutionData& solution,
                                     sta::Vertex* outPinVert,
                                     float load,
-                                    float inSlew,
-                                    unsigned setupWirelength);
+                                    float inSlew);
+  void characterize();
+  void initTaskTiming(CharTask& task);
+  void timeTaskCombination(CharTask& task);
+  bool nextTaskCombination(CharTask& task);
+  std::string cacheKey() const;
+  bool readCache(const std::string& file_name,
+                 std::vector<ResultData>& solutions);
+  void writeCache(const std::string& file_name,
+                  const std::vector<ResultData>& solutions) const;
   void updateBufferTopologies(SolutionData& solution);
   void updateBufferTopologiesOld(TechChar::SolutionData& solution);
   size_t cellNameToID(const std::string& masterName);
@@ -327,17 +381,18 @@ class TechChar
 
   std::deque<WireSegment> wireSegments_;
   std::unordered_map<Key, std::deque<unsigned>> keyToWireSegments_;
+  // Fake entries are numbered after the characterized segments.
+  std::deque<WireSegment> fakeWireSegments_;
+  std::unordered_map<Key, std::deque<unsigned>> keyToFakeWireSegments_;
+  std::atomic<bool> fakeEntriesCreated_ = false;
+  std::mutex fakeEntriesMutex_;
 
   CtsOptions* options_;
   odb::dbDatabase* db_;
   rsz::Resizer* resizer_;
   sta::dbSta* openSta_;
-  std::unique_ptr<sta::dbSta> openStaChar_;
   sta::dbNetwork* db_network_;
   Logger* logger_;
-  sta::PathAnalysisPt* charPathAnalysis_ = nullptr;
-  sta::Corner* charCorner_ = nullptr;
-  odb::dbBlock* charBlock_ = nullptr;
   odb::dbMaster* charBuf_ = nullptr;
   odb::dbMTerm* charBufIn_ = nullptr;
   odb::dbMTerm* charBufOut_ = nullptr;
@@ -141,6 +141,9 @@ class TreeBuilder
   }
   void setDb(odb::dbDatabase* db) { db_ = db; }
   void setLogger(utl::Logger* logger) { logger_ = logger; }
+  void setThreadCount(int threads) { threadCount_ = threads; }
+  // Serial builds see the fake LUT entries created by earlier trees.
+  void setShareFakeLutEntries(bool share) { shareFakeLutEntries_ = share; }
   bool isInsideBbox(double x,
                     double y,
                     double x1,
@@ -263,6 +266,8 @@ class TreeBuilder
   std::set<ClockInst*> tree_level_buffers_;
   utl::Logger* logger_;
   odb::dbDatabase* db_;
+  int threadCount_ = 1;
+  bool shareFakeLutEntries_ = true;
   std::vector<odb::dbBox*> bboxList_;
   double bufferWidth_ = 0.0;
   double bufferHeight_ = 0.0;
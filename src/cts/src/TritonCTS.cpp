@@ -35,11 +35,15 @@
 
 #include "cts/TritonCTS.h"
 
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <ctime>
+#include <exception>
 #include <fstream>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <unordered_set>
 
 #include "Clock.h"
@@ -239,12 +243,33 @@ void TritonCTS::findClockRoots()
 
 void TritonCTS::buildClockTrees()
 {
+  const int thread_count
+      = std::min<int>(openSta_->threadCount(), builders_->size());
+  // Plots and the observer are not thread safe.
+  const bool parallel = thread_count > 1 && !options_->getObserver()
+                        && !options_->getPlotSolution()
+                        && !logger_->debugCheck(CTS, "HTree", 2)
+                        && !logger_->debugCheck(CTS, "tech char", 1);
+  // Threads that are not used to build trees are left to each tree.
+  const int tree_thread_count
+      = parallel ? std::max(1, openSta_->threadCount() / thread_count)
+                 : openSta_->threadCount();
   for (TreeBuilder* builder : *builders_) {
     builder->setTechChar(*techChar_);
     builder->setDb(db_);
     builder->setLogger(logger_);
-    builder->initBlockages();
-    builder->run();
+    builder->setThreadCount(tree_thread_count);
+    // Trees built in parallel must not depend on the build order.
+    builder->setShareFakeLutEntries(!parallel);
+  }
+
+  if (parallel) {
+    buildClockTreesParallel(thread_count);
+  } else {
+    for (TreeBuilder* builder : *builders_) {
+      builder->initBlockages();
+      builder->run();
+    }
   }
 
   if (options_->getBalanceLevels()) {
@@ -261,6 +286,48 @@ void TritonCTS::buildClockTrees()
   }
 }
 
+// The clock trees are independent until they are written to the db, so they
+// are built on worker threads.  Each builder logs to a buffered logger and the
+// messages are reported in builder order once all of them are done.
+void TritonCTS::buildClockTreesParallel(int thread_count)
+{
+  const std::vector<TreeBuilder*>& builders = *builders_;
+  std::vector<std::unique_ptr<utl::Logger>> loggers;
+  std::vector<std::exception_ptr> errors(builders.size());
+  for (TreeBuilder* builder : builders) {
+    loggers.push_back(logger_->makeBufferedLogger());
+    builder->setLogger(loggers.back().get());
+  }
+
+  std::atomic<size_t> next_builder{0};
+  auto build = [&]() {
+    for (size_t i = next_builder++; i < builders.size(); i = next_builder++) {
+      try {
+        builders[i]->initBlockages();
+        builders[i]->run();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (int i = 0; i < thread_count; i++) {
+    threads.emplace_back(build);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < builders.size(); i++) {
+    builders[i]->setLogger(logger_);
+    logger_->reportBuffered(*loggers[i]);
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+  }
+}
+
 void TritonCTS::initOneClockTree(odb::dbNet* driverNet,
                                  const std::string& sdcClockName,
                                  TreeBuilder* parent)
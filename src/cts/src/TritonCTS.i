@@ -188,6 +188,12 @@ set_sink_buffer(const char* buffer)
   getTritonCts()->setSinkBuffer(buffer);
 }
 
+void
+set_char_cache_file(const char* file)
+{
+  getTritonCts()->getParms()->setCharCacheFile(file);
+}
+
 void
 set_balance_levels(bool balance)
 {
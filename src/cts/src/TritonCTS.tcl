@@ -90,6 +90,7 @@ sta::define_cmd_args "clock_tree_synthesis" {[-wire_unit unit]
                                              [-dont_use_dummy_load] \
                                              [-delay_buffer_derate] \
                                              [-library] \
+                                             [-char_cache_file file] \
 };# checker off
 
 proc clock_tree_synthesis { args } {
@@ -100,7 +101,8 @@ proc clock_tree_synthesis { args } {
           -clustering_exponent \
           -clustering_unbalance_ratio -sink_clustering_max_diameter \
           -sink_clustering_levels -tree_buf \
-          -sink_buffer_max_cap_derate -delay_buffer_derate -library} \
+          -sink_buffer_max_cap_derate -delay_buffer_derate -library \
+          -char_cache_file} \
     flags {-post_cts_disable -sink_clustering_enable -balance_levels \
            -obstruction_aware -apply_ndr -dont_use_dummy_load
   };# checker off
@@ -225,6 +227,12 @@ proc clock_tree_synthesis { args } {
 
   cts::set_apply_ndr [info exists flags(-apply_ndr)]
 
+  if { [info exists keys(-char_cache_file)] } {
+    cts::set_char_cache_file $keys(-char_cache_file)
+  } else {
+    cts::set_char_cache_file ""
+  }
+
   if { [ord::get_db_block] == "NULL" } {
     utl::error CTS 103 "No design block found."
   }
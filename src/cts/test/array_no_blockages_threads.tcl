@@ -0,0 +1,4 @@
+# array_no_blockages with the H-tree branches clustered on worker threads
+# The results must match the serial run.
+set_thread_count 4
+source "array_no_blockages.tcl"
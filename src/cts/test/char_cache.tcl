@@ -0,0 +1,49 @@
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "no_clock.def"
+
+set_wire_rc -clock -layer metal5
+
+# The message reports the number of results, which is not stable.
+suppress_message CTS 126
+# The mismatch message reports the absolute cache path; the rewrite is
+# checked below instead.
+suppress_message CTS 127
+
+set cache_file [make_result_file char_cache.txt]
+file delete -force $cache_file
+
+proc run_cts { wire_unit } {
+  global cache_file
+  clock_tree_synthesis -root_buf CLKBUF_X3 \
+    -buf_list CLKBUF_X3 \
+    -wire_unit $wire_unit \
+    -char_cache_file $cache_file
+}
+
+proc cache_marked { } {
+  global cache_file
+  set stream [open $cache_file r]
+  set contents [read $stream]
+  close $stream
+  return [string match "*cache marker*" $contents]
+}
+
+# No cache yet: characterizes and writes it.
+run_cts 20
+puts "cache written: [file exists $cache_file]"
+
+# A marker after the results is ignored when reading but lost if the
+# cache were rewritten.
+set stream [open $cache_file a]
+puts $stream "cache marker"
+close $stream
+
+# Same setup: the cache is read back.
+run_cts 20
+puts "cache reused: [cache_marked]"
+
+# Different wire unit: the cache does not match and is rewritten.
+run_cts 15
+puts "cache rewritten: [expr ![cache_marked]]"
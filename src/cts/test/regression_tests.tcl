@@ -2,8 +2,11 @@ record_tests {
   simple_test_hier
   array
   array_no_blockages
+  array_no_blockages_threads
   array_ins_delay
   balance_levels
+  balance_levels_threads
+  char_cache
   check_buffers
   check_buffers_blockages
   check_charBuf
@@ -21,6 +24,7 @@ record_tests {
   simple_test
   simple_test_clustered
   simple_test_clustered_max_cap
+  simple_test_threads
   simple_test_hier
   lvt_lib
   #cts_readme_msgs_check
@@ -0,0 +1,19 @@
+source "helpers.tcl"
+set_thread_count 4
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "16sinks.def"
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal3
+
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+                     -buf_list CLKBUF_X3 \
+                     -wire_unit 20 \
+                     -obstruction_aware \
+                     -apply_ndr    
+
+set def_file [make_result_file simple_test_threads_out.def]
+write_def $def_file
+diff_files simple_test_out.defok $def_file
@@ -894,9 +894,7 @@ Instance* dbNetwork::findChild(const Instance* parent, const char* name) const
     return dbToSta(child_inst);
   }
   // Look for a leaf instance
-  std::string full_name = mod_inst->getHierarchicalName();
-  full_name += pathDivider() + std::string(name);
-  dbInst* inst = block_->findInst(full_name.c_str());
+  dbInst* inst = block_->findInst(mod_inst, name, pathDivider());
   return dbToSta(inst);
 }
 
@@ -66,6 +66,16 @@ class RoutingJobDescription : public dst::JobDescription
   bool isDesignUpdate() const { return design_update_; }
   int getSendEvery() const { return send_every_; }
   const std::string& getViaData() const { return via_data_; }
+  // Serialized worker size is proportional to the nets and shapes each
+  // worker routes, so it is used as the work estimate.
+  float getEstimatedCost() const override
+  {
+    size_t size = 0;
+    for (const auto& [idx, worker] : workers_) {
+      size += worker.size();
+    }
+    return workers_.empty() ? 1.0 : size;
+  }
 
  private:
   std::string globals_path_;
@@ -1467,39 +1467,60 @@ void FlexDR::sendWorkers(
       workers.emplace_back(idx, workerStr);
     }
   }
+  dst::JobMessage msg(dst::JobMessage::ROUTING), result(dst::JobMessage::NONE);
+  std::unique_ptr<dst::JobDescription> desc
+      = std::make_unique<RoutingJobDescription>();
+  RoutingJobDescription* rjd = static_cast<RoutingJobDescription*>(desc.get());
+  rjd->setWorkers(workers);
+  rjd->setSharedDir(dist_dir_);
+  rjd->setSendEvery(20);
+  const float cost = rjd->getEstimatedCost();
+  msg.setJobDescription(std::move(desc));
+
   std::string remote_ip = dist_ip_;
   uint16_t remote_port = dist_port_;
-  if (router_->getCloudSize() > 1) {
-    dst::JobMessage msg(dst::JobMessage::BALANCER),
-        result(dst::JobMessage::NONE);
-    bool ok = dist_->sendJob(msg, dist_ip_.c_str(), dist_port_, result);
+  const bool balanced = router_->getCloudSize() > 1;
+  if (balanced) {
+    dst::JobMessage balancer_msg(dst::JobMessage::BALANCER),
+        balancer_result(dst::JobMessage::NONE);
+    auto balancer_desc = std::make_unique<dst::BalancerJobDescription>();
+    balancer_desc->setEstimatedCost(cost);
+    balancer_msg.setJobDescription(std::move(balancer_desc));
+    bool ok = dist_->sendJob(
+        balancer_msg, dist_ip_.c_str(), dist_port_, balancer_result);
     if (!ok) {
       logger_->error(utl::DRT, 7461, "Balancer failed");
     } else {
-      dst::BalancerJobDescription* desc
+      dst::BalancerJobDescription* balancer_desc
           = static_cast<dst::BalancerJobDescription*>(
-              result.getJobDescription());
-      remote_ip = desc->getWorkerIP();
-      remote_port = desc->getWorkerPort();
+              balancer_result.getJobDescription());
+      remote_ip = balancer_desc->getWorkerIP();
+      remote_port = balancer_desc->getWorkerPort();
     }
   }
   {
-    dst::JobMessage msg(dst::JobMessage::ROUTING),
-        result(dst::JobMessage::NONE);
-    std::unique_ptr<dst::JobDescription> desc
-        = std::make_unique<RoutingJobDescription>();
-    RoutingJobDescription* rjd
-        = static_cast<RoutingJobDescription*>(desc.get());
-    rjd->setWorkers(workers);
-    rjd->setSharedDir(dist_dir_);
-    rjd->setSendEvery(20);
-    msg.setJobDescription(std::move(desc));
     ProfileTask task("DIST: SENDJOB");
+    const auto start = std::chrono::steady_clock::now();
     bool ok = dist_->sendJobMultiResult(
         msg, remote_ip.c_str(), remote_port, result);
     if (!ok) {
       logger_->error(utl::DRT, 500, "Sending worker {} failed");
     }
+    if (balanced) {
+      // Feed the job latency back so the balancer learns the worker speed
+      // and releases the cost reserved for this batch.
+      const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+      dst::JobMessage done_msg(dst::JobMessage::JOB_COMPLETED),
+          done_result(dst::JobMessage::NONE);
+      auto done_desc = std::make_unique<dst::BalancerJobDescription>();
+      done_desc->setWorkerIP(remote_ip);
+      done_desc->setWorkerPort(remote_port);
+      done_desc->setEstimatedCost(cost);
+      done_desc->setElapsedTime(elapsed.count());
+      done_msg.setJobDescription(std::move(done_desc));
+      dist_->sendJob(done_msg, dist_ip_.c_str(), dist_port_, done_result);
+    }
     for (const auto& one_desc : result.getAllJobDescriptions()) {
       RoutingJobDescription* result_desc
           = static_cast<RoutingJobDescription*>(one_desc.get());
@@ -32,16 +32,18 @@
 #include <ittnotify.h>
 #endif
 
+#include "utl/Tracer.h"
+
 namespace drt {
 
 #ifdef HAS_VTUNE
 // This class make a VTune task in its scope (RAII).  This is useful
 // in VTune to see where the runtime is going with more domain specific
-// display.
+// display.  The task is also recorded as a utl::TraceZone.
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) : done_(false)
+  ProfileTask(const char* name) : zone_(name), done_(false)
   {
     domain_ = __itt_domain_create("TritonRoute");
     name_ = __itt_string_handle_create(name);
@@ -61,9 +63,11 @@ class ProfileTask
   {
     done_ = true;
     __itt_task_end(domain_);
+    zone_.end();
   }
 
  private:
+  utl::TraceZone zone_;
   __itt_domain* domain_;
   __itt_string_handle* name_;
   bool done_;
@@ -71,12 +75,15 @@ class ProfileTask
 
 #else
 
-// No-op version
+// Only records a utl::TraceZone
 class ProfileTask
 {
  public:
-  ProfileTask(const char* name) {}
-  void done() {}
+  ProfileTask(const char* name) : zone_(name) {}
+  void done() { zone_.end(); }
+
+ private:
+  utl::TraceZone zone_;
 };
 #endif
 
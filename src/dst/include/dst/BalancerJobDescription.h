@@ -42,12 +42,18 @@ class BalancerJobDescription : public JobDescription
   BalancerJobDescription() : worker_port_(0) {}
   void setWorkerIP(const std::string& ip) { worker_ip_ = ip; }
   void setWorkerPort(unsigned short port) { worker_port_ = port; }
+  void setEstimatedCost(float cost) { estimated_cost_ = cost; }
+  void setElapsedTime(double seconds) { elapsed_time_ = seconds; }
   std::string getWorkerIP() const { return worker_ip_; }
   unsigned short getWorkerPort() const { return worker_port_; }
+  float getEstimatedCost() const override { return estimated_cost_; }
+  double getElapsedTime() const { return elapsed_time_; }
 
  private:
   std::string worker_ip_;
   unsigned short worker_port_;
+  float estimated_cost_{1.0};
+  double elapsed_time_{0};  // seconds, set when reporting a completed job
 
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version)
@@ -55,6 +61,8 @@ class BalancerJobDescription : public JobDescription
     (ar) & boost::serialization::base_object<dst::JobDescription>(*this);
     (ar) & worker_ip_;
     (ar) & worker_port_;
+    (ar) & estimated_cost_;
+    (ar) & elapsed_time_;
   }
   friend class boost::serialization::access;
 };
@@ -59,6 +59,7 @@ class Distributed
                        unsigned short port,
                        const char* workers_domain);
   void addWorkerAddress(const char* address, unsigned short port);
+  void reportWorkerStats(const char* balancer_ip, unsigned short port);
   bool sendJob(JobMessage& msg,
                const char* ip,
                unsigned short port,
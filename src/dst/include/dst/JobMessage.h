@@ -44,6 +44,9 @@ class JobDescription
  public:
   JobDescription() {}
   virtual ~JobDescription() {}
+  // Relative amount of work the job carries, used by the load balancer to
+  // schedule jobs on workers. Not serialized.
+  virtual float getEstimatedCost() const { return 1.0; }
 
  private:
   template <class Archive>
@@ -63,6 +66,8 @@ class JobMessage
     BALANCER,
     PIN_ACCESS,
     GRDR_INIT,
+    WORKER_STATS,
+    JOB_COMPLETED,
     SUCCESS,
     ERROR,
     NONE
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <string>
+#include <vector>
+
+#include "dst/JobMessage.h"
+namespace boost::serialization {
+class access;
+}
+namespace dst {
+
+struct WorkerStats
+{
+  std::string ip;
+  unsigned short port{0};
+  unsigned int active_jobs{0};
+  unsigned int completed_jobs{0};
+  unsigned int failed_jobs{0};
+  float pending_cost{0};
+  double avg_latency{0};  // seconds per completed job
+  double throughput{0};   // estimated cost units per second
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version)
+  {
+    (ar) & ip;
+    (ar) & port;
+    (ar) & active_jobs;
+    (ar) & completed_jobs;
+    (ar) & failed_jobs;
+    (ar) & pending_cost;
+    (ar) & avg_latency;
+    (ar) & throughput;
+  }
+};
+
+class WorkerStatsJobDescription : public JobDescription
+{
+ public:
+  void setStats(const std::vector<WorkerStats>& stats) { stats_ = stats; }
+  const std::vector<WorkerStats>& getStats() const { return stats_; }
+
+ private:
+  std::vector<WorkerStats> stats_;
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version)
+  {
+    (ar) & boost::serialization::base_object<dst::JobDescription>(*this);
+    (ar) & stats_;
+  }
+  friend class boost::serialization::access;
+};
+}  // namespace dst
@@ -36,6 +36,8 @@
 #include <boost/bind/bind.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/thread/thread.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 
@@ -43,12 +45,41 @@
 #include "dst/BalancerJobDescription.h"
 #include "dst/BroadcastJobDescription.h"
 #include "dst/Distributed.h"
+#include "dst/WorkerStatsJobDescription.h"
 #include "utl/Logger.h"
 
 using namespace dst;
 
 BOOST_CLASS_EXPORT(dst::BalancerJobDescription)
 BOOST_CLASS_EXPORT(dst::BroadcastJobDescription)
+BOOST_CLASS_EXPORT(dst::WorkerStatsJobDescription)
+
+namespace {
+// Shared between the connection and the threads running the attempts of a
+// relayed job; attempts may outlive the connection when a speculative copy
+// wins the race.
+struct RelayState
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  int running = 0;
+  int failures = 0;
+  bool done = false;
+  std::string result;
+};
+
+// Tells the balancer a detached thread is done with it, whichever way the
+// thread exits.
+class ThreadFinished
+{
+ public:
+  explicit ThreadFinished(LoadBalancer* owner) : owner_(owner) {}
+  ~ThreadFinished() { owner_->threadFinished(); }
+
+ private:
+  LoadBalancer* owner_;
+};
+}  // namespace
 
 BalancerConnection::BalancerConnection(asio::io_service& io_service,
                                        LoadBalancer* owner,
@@ -70,7 +101,11 @@ void BalancerConnection::start()
       JobMessage::EOP,
       [me = shared_from_this()](boost::system::error_code const& ec,
                                 std::size_t bytes_xfer) {
-        boost::thread t(&BalancerConnection::handle_read, me, ec, bytes_xfer);
+        me->owner_->threadStarted();
+        boost::thread t([me, ec, bytes_xfer]() {
+          ThreadFinished finished(me->owner_);
+          me->handle_read(ec, bytes_xfer);
+        });
         t.detach();
       });
 }
@@ -95,9 +130,35 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
     }
     switch (msg.getMessageType()) {
       case JobMessage::UNICAST: {
+        if (msg.getJobType() == JobMessage::WORKER_STATS) {
+          JobMessage reply(JobMessage::SUCCESS);
+          auto uDesc = std::make_unique<WorkerStatsJobDescription>();
+          uDesc->setStats(owner_->getWorkersStats());
+          reply.setJobDescription(std::move(uDesc));
+          owner_->dist_->sendResult(reply, sock_);
+          sock_.close();
+          break;
+        }
+        if (msg.getJobType() == JobMessage::JOB_COMPLETED) {
+          auto desc
+              = static_cast<BalancerJobDescription*>(msg.getJobDescription());
+          if (desc != nullptr) {
+            owner_->releaseWorker(ip::address::from_string(desc->getWorkerIP()),
+                                  desc->getWorkerPort(),
+                                  desc->getEstimatedCost(),
+                                  desc->getElapsedTime());
+          }
+          JobMessage reply(JobMessage::SUCCESS);
+          owner_->dist_->sendResult(reply, sock_);
+          sock_.close();
+          break;
+        }
+        const float cost = msg.getJobDescription() != nullptr
+                               ? msg.getJobDescription()->getEstimatedCost()
+                               : 1.0;
         ip::address workerAddress;
         unsigned short port;
-        owner_->getNextWorker(workerAddress, port);
+        owner_->getNextWorker(workerAddress, port, cost);
         if (workerAddress.is_unspecified()) {
           logger_->warn(utl::DST, 6, "No workers available");
           sock_.close();
@@ -108,59 +169,19 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
             auto desc = uDesc.get();
             desc->setWorkerIP(workerAddress.to_string());
             desc->setWorkerPort(port);
+            desc->setEstimatedCost(cost);
             reply.setJobDescription(std::move(uDesc));
             owner_->dist_->sendResult(reply, sock_);
             sock_.close();
           } else {
-            asio::io_service io_service;
-            tcp::socket socket(io_service);
-            int failed_workers_trials = 0;
-            asio::streambuf receive_buffer;
-            bool failure = true;
-            while (failure) {
-              try {
-                socket.connect(tcp::endpoint(workerAddress, port));
-                asio::write(socket, in_packet_);
-                asio::read(socket, receive_buffer, asio::transfer_all());
-                failure = false;
-              } catch (std::exception const& ex) {
-                if (socket.is_open()) {
-                  socket.close();
-                }
-                if (std::string(ex.what()).find("read: End of file")
-                    != std::string::npos) {
-                  // Since asio::transfer_all() used with a stream buffer it
-                  // always reach an eof file exception!
-                  failure = false;
-                  break;
-                }
-                logger_->warn(utl::DST,
-                              204,
-                              "Exception thrown: {}. worker with ip \"{}\" and "
-                              "port \"{}\" will be pushed back the queue.",
-                              ex.what(),
-                              workerAddress,
-                              port);
-                owner_->punishWorker(workerAddress, port);
-                failed_workers_trials++;
-                if (failed_workers_trials == MAX_FAILED_WORKERS_TRIALS) {
-                  logger_->warn(utl::DST,
-                                205,
-                                "Maximum of {} failing workers reached, "
-                                "relaying error to leader.",
-                                failed_workers_trials);
-                  break;
-                }
-                owner_->getNextWorker(workerAddress, port);
-              }
-            }
-            if (failure) {
+            std::string relayed;
+            if (!relayJob(cost, workerAddress, port, relayed)) {
               JobMessage result(JobMessage::ERROR);
               std::string msgStr;
               JobMessage::serializeMsg(JobMessage::WRITE, result, msgStr);
               asio::write(sock_, asio::buffer(msgStr), error);
             } else {
-              asio::write(sock_, receive_buffer, error);
+              asio::write(sock_, asio::buffer(relayed), error);
             }
             sock_.close();
           }
@@ -174,9 +195,7 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
         auto workers_copy = owner_->workers_;
         std::mutex broadcast_failure_mutex;
         std::vector<std::pair<ip::address, unsigned short>> failed_workers;
-        while (!workers_copy.empty()) {
-          auto worker = workers_copy.top();
-          workers_copy.pop();
+        for (const auto& worker : workers_copy) {
           asio::post(
               pool,
               [worker, data, &failed_workers, &broadcast_failure_mutex]() {
@@ -237,6 +256,129 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
   }
 }
 
+bool BalancerConnection::relayJob(float cost,
+                                  ip::address worker_address,
+                                  unsigned short port,
+                                  std::string& result)
+{
+  auto state = std::make_shared<RelayState>();
+  const std::string packet{buffers_begin(in_packet_.data()),
+                           buffers_end(in_packet_.data())};
+  LoadBalancer* owner = owner_;
+  utl::Logger* logger = logger_;
+  auto launch = [=](const ip::address& address, unsigned short worker_port) {
+    state->running++;
+    owner->threadStarted();
+    boost::thread t([=]() {
+      ThreadFinished finished(owner);
+      const auto start = std::chrono::steady_clock::now();
+      asio::streambuf receive_buffer;
+      bool success = false;
+      try {
+        asio::io_service io_service;
+        tcp::socket socket(io_service);
+        socket.connect(tcp::endpoint(address, worker_port));
+        asio::write(socket, asio::buffer(packet));
+        boost::system::error_code ec;
+        asio::read(socket, receive_buffer, asio::transfer_all(), ec);
+        // Since asio::transfer_all() is used with a stream buffer it always
+        // reaches an eof.
+        if (ec && ec != asio::error::eof) {
+          throw boost::system::system_error(ec);
+        }
+        success = true;
+      } catch (std::exception const& ex) {
+        logger->warn(utl::DST,
+                     204,
+                     "Exception thrown: {}. worker with ip \"{}\" and "
+                     "port \"{}\" will be pushed back the queue.",
+                     ex.what(),
+                     address,
+                     worker_port);
+      }
+      const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+      if (success) {
+        owner->releaseWorker(address, worker_port, cost, elapsed.count());
+      } else {
+        owner->punishWorker(address, worker_port, cost);
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->running--;
+      if (!success) {
+        state->failures++;
+      } else if (!state->done) {
+        state->done = true;
+        state->result = std::string{buffers_begin(receive_buffer.data()),
+                                    buffers_end(receive_buffer.data())};
+      }
+      state->cv.notify_all();
+    });
+    t.detach();
+  };
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  launch(worker_address, port);
+  auto deadline = owner_->getStragglerTimeout(worker_address, port, cost);
+  auto straggler_time = std::chrono::steady_clock::now() + deadline;
+  bool speculated = false;
+  while (!state->done) {
+    if (state->running == 0) {
+      if (state->failures >= MAX_FAILED_WORKERS_TRIALS) {
+        logger_->warn(utl::DST,
+                      205,
+                      "Maximum of {} failing workers reached, "
+                      "relaying error to leader.",
+                      state->failures);
+        break;
+      }
+      lock.unlock();
+      worker_address = ip::address();
+      owner_->getNextWorker(worker_address, port, cost);
+      deadline = owner_->getStragglerTimeout(worker_address, port, cost);
+      lock.lock();
+      if (worker_address.is_unspecified()) {
+        break;
+      }
+      launch(worker_address, port);
+      straggler_time = std::chrono::steady_clock::now() + deadline;
+      continue;
+    }
+    if (speculated || deadline.count() == 0) {
+      state->cv.wait(lock);
+      continue;
+    }
+    if (state->cv.wait_until(lock, straggler_time) == std::cv_status::timeout
+        && !state->done && state->running > 0) {
+      speculated = true;
+      ip::address backup_address;
+      unsigned short backup_port;
+      lock.unlock();
+      const bool found = owner_->getSpeculativeWorker(
+          worker_address, port, cost, backup_address, backup_port);
+      lock.lock();
+      if (found) {
+        debugPrint(logger_,
+                   utl::DST,
+                   "load_balancer",
+                   1,
+                   "Job on worker {}/{} exceeded {}ms, re-dispatching to "
+                   "worker {}/{}.",
+                   worker_address,
+                   port,
+                   deadline.count(),
+                   backup_address,
+                   backup_port);
+        launch(backup_address, backup_port);
+      }
+    }
+  }
+  if (state->done) {
+    result = state->result;
+  }
+  return state->done;
+}
+
 #if !SWIG && FMT_VERSION >= 100000
 namespace boost::asio::ip {
 
@@ -30,6 +30,7 @@
 #include <boost/asio.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/make_shared.hpp>
+#include <string>
 
 namespace asio = boost::asio;
 namespace ip = asio::ip;
@@ -62,6 +63,12 @@ class BalancerConnection
   LoadBalancer* getOwner() const { return owner_; }
 
  private:
+  // Relays the received packet to a worker, re-dispatching it when the
+  // worker fails or is straggling. Returns false if no worker succeeded.
+  bool relayJob(float cost,
+                ip::address worker_address,
+                unsigned short port,
+                std::string& result);
   tcp::socket sock_;
   asio::streambuf in_packet_;
   utl::Logger* logger_;
@@ -37,6 +37,7 @@
 #include "Worker.h"
 #include "dst/JobCallBack.h"
 #include "dst/JobMessage.h"
+#include "dst/WorkerStatsJobDescription.h"
 #include "sta/StaMain.hh"
 #include "utl/Logger.h"
 namespace dst {
@@ -60,6 +61,8 @@ Distributed::Distributed(utl::Logger* logger) : logger_(logger)
 
 Distributed::~Distributed()
 {
+  // Stop the workers before their callbacks go away.
+  workers_.clear();
   for (auto cb : callbacks_) {
     delete cb;
   }
@@ -83,8 +86,7 @@ void Distributed::runWorker(const char* ip,
     auto worker = uWorker.get();
     workers_.push_back(std::move(uWorker));
     if (interactive) {
-      boost::thread t(boost::bind(&Worker::run, worker));
-      t.detach();
+      worker->runInThread();
     } else {
       worker->run();
     }
@@ -115,6 +117,35 @@ void Distributed::addWorkerAddress(const char* address, unsigned short port)
 {
   end_points_.emplace_back(address, port);
 }
+
+void Distributed::reportWorkerStats(const char* balancer_ip,
+                                    unsigned short port)
+{
+  JobMessage msg(JobMessage::WORKER_STATS), result(JobMessage::NONE);
+  if (!sendJob(msg, balancer_ip, port, result)
+      || result.getJobType() != JobMessage::SUCCESS) {
+    logger_->warn(utl::DST, 209, "Failed to query the load balancer stats.");
+    return;
+  }
+  auto desc
+      = static_cast<WorkerStatsJobDescription*>(result.getJobDescription());
+  logger_->report("{:>21} {:>7} {:>10} {:>7} {:>13} {:>12}",
+                  "Worker",
+                  "Active",
+                  "Completed",
+                  "Failed",
+                  "Latency (s)",
+                  "Throughput");
+  for (const auto& stats : desc->getStats()) {
+    logger_->report("{:>21} {:>7} {:>10} {:>7} {:>13.3f} {:>12.1f}",
+                    fmt::format("{}/{}", stats.ip, stats.port),
+                    stats.active_jobs,
+                    stats.completed_jobs,
+                    stats.failed_jobs,
+                    stats.avg_latency,
+                    stats.throughput);
+  }
+}
 // TODO: exponential backoff
 bool sendMsg(dst::socket& sock, const std::string& msg, std::string& errorMsg)
 {
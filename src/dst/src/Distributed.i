@@ -56,4 +56,11 @@ void add_worker_address(
   distributed->addWorkerAddress(address, ip);
 }
 
+void report_worker_stats(
+    const char* host, unsigned short port)
+{
+  auto* distributed = ord::OpenRoad::openRoad()->getDistributed();
+  distributed->reportWorkerStats(host, port);
+}
+
 %} // inline
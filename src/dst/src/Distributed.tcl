@@ -96,4 +96,26 @@ proc add_worker_address { args } {
     utl::error DST 17 "-port is required in add_worker_address cmd."
   }
   dst::add_worker_address $host $port
-}
\ No newline at end of file
+}
+
+sta::define_cmd_args "report_worker_stats" {
+    [-host host]
+    [-port port]
+}
+proc report_worker_stats { args } {
+  sta::parse_key_args "report_worker_stats" args \
+    keys {-host -port} \
+    flags {}
+  sta::check_argc_eq0 "report_worker_stats" $args
+  if { [info exists keys(-host)] } {
+    set host $keys(-host)
+  } else {
+    utl::error DST 210 "-host is required in report_worker_stats cmd."
+  }
+  if { [info exists keys(-port)] } {
+    set port $keys(-port)
+  } else {
+    utl::error DST 211 "-port is required in report_worker_stats cmd."
+  }
+  dst::report_worker_stats $host $port
+}
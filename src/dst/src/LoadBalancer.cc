@@ -28,8 +28,11 @@
 
 #include "LoadBalancer.h"
 
+#include <algorithm>
 #include <boost/bind/bind.hpp>
 #include <boost/thread/thread.hpp>
+#include <limits>
+#include <memory>
 
 #include "utl/Logger.h"
 
@@ -41,15 +44,7 @@ void LoadBalancer::start_accept()
 {
   if (jobs_ != 0 && jobs_ % 100 == 0) {
     logger_->info(utl::DST, 7, "Processed {} jobs", jobs_);
-    auto copy = workers_;
-    while (!copy.empty()) {
-      auto worker = copy.top();
-      logger_->report("Worker {}/{} handled {} jobs",
-                      worker.ip,
-                      worker.port,
-                      worker.priority);
-      copy.pop();
-    }
+    reportWorkers();
   }
   jobs_++;
   BalancerConnection::pointer connection
@@ -61,6 +56,21 @@ void LoadBalancer::start_accept()
                                      asio::placeholders::error));
 }
 
+void LoadBalancer::reportWorkers()
+{
+  for (const auto& stats : getWorkersStats()) {
+    logger_->report(
+        "Worker {}/{} handled {} jobs ({} failed), avg latency {:.3f}s, "
+        "throughput {:.1f}",
+        stats.ip,
+        stats.port,
+        stats.completed_jobs,
+        stats.failed_jobs,
+        stats.avg_latency,
+        stats.throughput);
+  }
+}
+
 LoadBalancer::LoadBalancer(Distributed* dist,
                            asio::io_service& io_service,
                            utl::Logger* logger,
@@ -79,6 +89,8 @@ LoadBalancer::LoadBalancer(Distributed* dist,
     workers_lookup_thread = boost::thread(
         boost::bind(&LoadBalancer::lookUpWorkers, this, workers_domain, port));
   }
+  workers_heartbeat_thread
+      = boost::thread(boost::bind(&LoadBalancer::monitorWorkers, this));
 }
 
 LoadBalancer::~LoadBalancer()
@@ -87,6 +99,25 @@ LoadBalancer::~LoadBalancer()
   if (workers_lookup_thread.joinable()) {
     workers_lookup_thread.join();
   }
+  if (workers_heartbeat_thread.joinable()) {
+    workers_heartbeat_thread.interrupt();
+    workers_heartbeat_thread.join();
+  }
+  std::unique_lock<std::mutex> lock(threads_mutex_);
+  threads_cv_.wait(lock, [this] { return running_threads_ == 0; });
+}
+
+void LoadBalancer::threadStarted()
+{
+  std::lock_guard<std::mutex> lock(threads_mutex_);
+  running_threads_++;
+}
+
+void LoadBalancer::threadFinished()
+{
+  std::lock_guard<std::mutex> lock(threads_mutex_);
+  running_threads_--;
+  threads_cv_.notify_all();
 }
 
 bool LoadBalancer::addWorker(const std::string& ip, unsigned short port)
@@ -114,52 +145,168 @@ bool LoadBalancer::addWorker(const std::string& ip, unsigned short port)
     }
   }
   if (validWorkerState) {
-    workers_.push(worker(ip::address::from_string(ip), port, 0));
+    workers_.emplace_back(ip::address::from_string(ip), port);
   }
   return validWorkerState;
 }
+
+LoadBalancer::worker* LoadBalancer::findWorker(const ip::address& ip,
+                                               unsigned short port)
+{
+  for (auto& w : workers_) {
+    if (w.ip == ip && w.port == port) {
+      return &w;
+    }
+  }
+  return nullptr;
+}
+
+double LoadBalancer::getDefaultThroughput() const
+{
+  // Workers without history are assumed to be as fast as the average known
+  // worker so that they are neither starved nor flooded.
+  double sum = 0;
+  int count = 0;
+  for (const auto& w : workers_) {
+    if (w.throughput > 0) {
+      sum += w.throughput;
+      count++;
+    }
+  }
+  return count == 0 ? 0 : sum / count;
+}
+
+LoadBalancer::worker* LoadBalancer::selectWorker(float cost,
+                                                 const worker* excluded)
+{
+  double default_throughput = getDefaultThroughput();
+  if (default_throughput == 0) {
+    default_throughput = 1.0;
+  }
+  worker* best = nullptr;
+  double best_finish = std::numeric_limits<double>::max();
+  for (auto& w : workers_) {
+    if (&w == excluded) {
+      continue;
+    }
+    const double throughput
+        = w.throughput > 0 ? w.throughput : default_throughput;
+    // Expected time for the worker to drain its queue and this job, doubled
+    // for every consecutive failure.
+    const double finish = (w.pending_cost + cost) / throughput
+                          * (1 << std::min<int>(w.failures, 16));
+    if (finish < best_finish) {
+      best_finish = finish;
+      best = &w;
+    }
+  }
+  return best;
+}
+
 void LoadBalancer::updateWorker(const ip::address& ip, unsigned short port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      worker.priority--;
-    }
-    newQueue.push(worker);
+  worker* w = findWorker(ip, port);
+  if (w != nullptr) {
+    w->pending_cost = std::max(0.0f, w->pending_cost - 1);
   }
-  workers_.swap(newQueue);
 }
-void LoadBalancer::getNextWorker(ip::address& ip, unsigned short& port)
+
+void LoadBalancer::getNextWorker(ip::address& ip,
+                                 unsigned short& port,
+                                 float cost)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  if (!workers_.empty()) {
-    worker w = workers_.top();
-    workers_.pop();
-    ip = w.ip;
-    port = w.port;
-    if (w.priority != std::numeric_limits<unsigned short>::max()) {
-      w.priority++;
-    }
-    workers_.push(w);
+  worker* w = selectWorker(cost, nullptr);
+  if (w != nullptr) {
+    ip = w->ip;
+    port = w->port;
+    w->pending_cost += cost;
+    w->active_jobs++;
   }
 }
 
-void LoadBalancer::punishWorker(const ip::address& ip, unsigned short port)
+bool LoadBalancer::getSpeculativeWorker(const ip::address& excluded_ip,
+                                        unsigned short excluded_port,
+                                        float cost,
+                                        ip::address& ip,
+                                        unsigned short& port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      worker.priority = worker.priority == 0 ? 2 : worker.priority * 2;
-    }
-    newQueue.push(worker);
+  worker* w = selectWorker(cost, findWorker(excluded_ip, excluded_port));
+  if (w == nullptr) {
+    return false;
   }
-  workers_.swap(newQueue);
+  ip = w->ip;
+  port = w->port;
+  w->pending_cost += cost;
+  w->active_jobs++;
+  return true;
+}
+
+void LoadBalancer::releaseWorker(const ip::address& ip,
+                                 unsigned short port,
+                                 float cost,
+                                 double elapsed_seconds)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w == nullptr) {
+    return;
+  }
+  w->pending_cost = std::max(0.0f, w->pending_cost - cost);
+  if (w->active_jobs > 0) {
+    w->active_jobs--;
+  }
+  w->completed_jobs++;
+  w->failures = 0;
+  w->total_latency += elapsed_seconds;
+  if (elapsed_seconds > 0) {
+    // Exponential moving average so that a worker slowing down (or speeding
+    // up) is reflected after a few jobs.
+    const double alpha = 0.3;
+    const double sample = cost / elapsed_seconds;
+    w->throughput = w->throughput == 0
+                        ? sample
+                        : alpha * sample + (1 - alpha) * w->throughput;
+  }
+}
+
+void LoadBalancer::punishWorker(const ip::address& ip,
+                                unsigned short port,
+                                float cost)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w == nullptr) {
+    return;
+  }
+  w->pending_cost = std::max(0.0f, w->pending_cost - cost);
+  if (w->active_jobs > 0) {
+    w->active_jobs--;
+  }
+  w->failed_jobs++;
+  w->failures++;
+}
+
+std::chrono::milliseconds LoadBalancer::getStragglerTimeout(
+    const ip::address& ip,
+    unsigned short port,
+    float cost)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w == nullptr) {
+    return std::chrono::milliseconds(0);
+  }
+  const double throughput
+      = w->throughput > 0 ? w->throughput : getDefaultThroughput();
+  if (throughput == 0) {
+    return std::chrono::milliseconds(0);
+  }
+  const auto expected = std::chrono::milliseconds(
+      static_cast<int64_t>(straggler_factor * 1000 * cost / throughput));
+  return std::max(expected, std::chrono::milliseconds(min_straggler_timeout));
 }
 
 void LoadBalancer::removeWorker(const ip::address& ip,
@@ -169,18 +316,105 @@ void LoadBalancer::removeWorker(const ip::address& ip,
   if (lock) {
     workers_mutex_.lock();
   }
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
+  workers_.erase(std::remove_if(workers_.begin(),
+                                workers_.end(),
+                                [&](const worker& w) {
+                                  return w.ip == ip && w.port == port;
+                                }),
+                 workers_.end());
+  if (lock) {
+    workers_mutex_.unlock();
+  }
+}
+
+std::vector<WorkerStats> LoadBalancer::getWorkersStats()
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  std::vector<WorkerStats> stats;
+  stats.reserve(workers_.size());
+  for (const auto& w : workers_) {
+    WorkerStats s;
+    s.ip = w.ip.to_string();
+    s.port = w.port;
+    s.active_jobs = w.active_jobs;
+    s.completed_jobs = w.completed_jobs;
+    s.failed_jobs = w.failed_jobs;
+    s.pending_cost = w.pending_cost;
+    s.avg_latency
+        = w.completed_jobs == 0 ? 0 : w.total_latency / w.completed_jobs;
+    s.throughput = w.throughput;
+    stats.push_back(s);
+  }
+  return stats;
+}
+
+void LoadBalancer::checkWorkersHealth()
+{
+  std::vector<std::pair<ip::address, unsigned short>> end_points;
+  {
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    for (const auto& w : workers_) {
+      end_points.emplace_back(w.ip, w.port);
+    }
+  }
+  // A worker serves jobs on its accepting thread, so a protocol level ping
+  // would stall behind a running job. Completing the TCP handshake only
+  // needs the worker process to be alive and listening.
+  std::vector<bool> responsive(end_points.size(), false);
+  asio::io_service io_service;
+  std::vector<std::unique_ptr<tcp::socket>> sockets;
+  for (size_t i = 0; i < end_points.size(); i++) {
+    sockets.push_back(std::make_unique<tcp::socket>(io_service));
+    sockets.back()->async_connect(
+        tcp::endpoint(end_points[i].first, end_points[i].second),
+        [&responsive, i](const boost::system::error_code& ec) {
+          responsive[i] = !ec;
+        });
+  }
+  io_service.run_for(std::chrono::seconds(workers_heartbeat_timeout));
+  sockets.clear();
+
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  for (size_t i = 0; i < end_points.size(); i++) {
+    const auto& [ip, port] = end_points[i];
+    worker* w = findWorker(ip, port);
+    if (w == nullptr) {
       continue;
     }
-    newQueue.push(worker);
+    if (responsive[i]) {
+      w->missed_heartbeats = 0;
+      continue;
+    }
+    w->missed_heartbeats++;
+    debugPrint(logger_,
+               utl::DST,
+               "load_balancer",
+               1,
+               "Worker {}/{} missed {} heartbeats.",
+               ip,
+               port,
+               w->missed_heartbeats);
+    if (w->missed_heartbeats >= max_missed_heartbeats) {
+      logger_->warn(utl::DST,
+                    208,
+                    "Worker {}/{} missed {} heartbeats and has been removed.",
+                    ip,
+                    port,
+                    w->missed_heartbeats);
+      removeWorker(ip, port, false);
+    }
   }
-  workers_.swap(newQueue);
-  if (lock) {
-    workers_mutex_.unlock();
+}
+
+void LoadBalancer::monitorWorkers()
+{
+  try {
+    while (alive) {
+      boost::this_thread::sleep(
+          boost::posix_time::milliseconds(workers_heartbeat_period * 1000));
+      checkWorkersHealth();
+    }
+  } catch (const boost::thread_interrupted&) {
   }
 }
 
@@ -206,7 +440,7 @@ void LoadBalancer::lookUpWorkers(const char* domain, unsigned short port)
     int new_workers_count = 0;
     udp::resolver::iterator it_end;
     for (; it != it_end; ++it) {
-      auto discovered_worker = worker(it->endpoint().address(), port, 0);
+      auto discovered_worker = worker(it->endpoint().address(), port);
       if (std::find(workers_set.begin(), workers_set.end(), discovered_worker)
           == workers_set.end()) {
         workers_set.push_back(discovered_worker);
@@ -31,12 +31,14 @@
 #include <boost/asio.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/thread/thread.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "BalancerConnection.h"
+#include "dst/WorkerStatsJobDescription.h"
 
 namespace utl {
 class Logger;
@@ -45,6 +47,17 @@ class Logger;
 namespace dst {
 const int workers_discovery_period = 15;  // time in seconds between retrying to
                                           // find new workers on the network
+const int workers_heartbeat_period = 5;  // time in seconds between probing the
+                                         // registered workers for liveness
+const int workers_heartbeat_timeout = 2;  // time in seconds before a probe is
+                                          // considered missed
+const int max_missed_heartbeats = 3;  // consecutive missed probes before a
+                                      // worker is evicted
+const float straggler_factor = 3.0;  // a job running longer than this factor
+                                     // times its expected latency is
+                                     // speculatively re-dispatched
+const int min_straggler_timeout = 1000;  // lower bound in milliseconds on the
+                                         // straggler deadline
 class Distributed;
 class LoadBalancer
 {
@@ -58,33 +71,66 @@ class LoadBalancer
                unsigned short port = 1234);
   ~LoadBalancer();
   bool addWorker(const std::string& ip, unsigned short port);
+  // Releases one unit of estimated work from the worker without recording
+  // any timing.
   void updateWorker(const ip::address& ip, unsigned short port);
-  void getNextWorker(ip::address& ip, unsigned short& port);
+  // Picks the worker with the earliest expected completion time for a job
+  // of the given estimated cost and reserves that cost on it.
+  void getNextWorker(ip::address& ip,
+                     unsigned short& port,
+                     float cost = 1.0);
+  // Same as getNextWorker but never returns the excluded worker. Returns
+  // false if no other worker is available.
+  bool getSpeculativeWorker(const ip::address& excluded_ip,
+                            unsigned short excluded_port,
+                            float cost,
+                            ip::address& ip,
+                            unsigned short& port);
+  // Releases the cost reserved by getNextWorker and records the job latency
+  // in the worker throughput estimate.
+  void releaseWorker(const ip::address& ip,
+                     unsigned short port,
+                     float cost,
+                     double elapsed_seconds);
   void removeWorker(const ip::address& ip,
                     unsigned short port,
                     bool lock = true);
-  void punishWorker(const ip::address& ip, unsigned short port);
+  // Releases the reserved cost and penalizes the worker after a failed job.
+  void punishWorker(const ip::address& ip,
+                    unsigned short port,
+                    float cost = 0.0);
+  // Time after which a job of the given cost running on the worker is
+  // considered a straggler. Zero if there is no history to base it on.
+  std::chrono::milliseconds getStragglerTimeout(const ip::address& ip,
+                                                unsigned short port,
+                                                float cost);
+  // Probes every worker once and evicts those that missed too many probes.
+  void checkWorkersHealth();
+  std::vector<WorkerStats> getWorkersStats();
+  // Connection and relay threads are detached; they register here so the
+  // destructor can wait for them before the balancer goes away.
+  void threadStarted();
+  void threadFinished();
 
  private:
   struct worker
   {
     ip::address ip;
     unsigned short port;
-    unsigned short priority;
-    worker(ip::address ipIn, unsigned short portIn, unsigned short priorityIn)
-        : ip(ipIn), port(portIn), priority(priorityIn)
+    float pending_cost{0};  // estimated work dispatched and not yet released
+    unsigned int active_jobs{0};
+    unsigned int completed_jobs{0};
+    unsigned int failed_jobs{0};
+    unsigned short failures{0};  // consecutive failures
+    unsigned short missed_heartbeats{0};
+    double total_latency{0};   // seconds
+    double throughput{0};      // smoothed cost units per second
+    worker(ip::address ipIn, unsigned short portIn) : ip(ipIn), port(portIn)
     {
     }
     bool operator==(const worker& rhs) const
     {
-      return (ip == rhs.ip && port == rhs.port && priority == rhs.priority);
-    }
-  };
-  struct CompareWorker
-  {
-    bool operator()(worker const& w1, worker const& w2)
-    {
-      return w1.priority > w2.priority;
+      return (ip == rhs.ip && port == rhs.port);
     }
   };
 
@@ -92,19 +138,28 @@ class LoadBalancer
   tcp::acceptor acceptor_;
   asio::io_service* service;
   utl::Logger* logger_;
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> workers_;
+  std::vector<worker> workers_;
   std::mutex workers_mutex_;
   std::unique_ptr<asio::thread_pool> pool_;
   std::mutex pool_mutex_;
   uint32_t jobs_;
   std::atomic<bool> alive = true;
   boost::thread workers_lookup_thread;
+  boost::thread workers_heartbeat_thread;
   std::vector<std::string> broadcastData;
+  std::mutex threads_mutex_;
+  std::condition_variable threads_cv_;
+  int running_threads_{0};
 
   void start_accept();
   void handle_accept(const BalancerConnection::pointer& connection,
                      const boost::system::error_code& err);
   void lookUpWorkers(const char* domain, unsigned short port);
+  void monitorWorkers();
+  worker* findWorker(const ip::address& ip, unsigned short port);
+  double getDefaultThroughput() const;
+  worker* selectWorker(float cost, const worker* excluded);
+  void reportWorkers();
   friend class dst::BalancerConnection;
 };
 }  // namespace dst
@@ -61,12 +61,20 @@ Worker::Worker(Distributed* dist,
 Worker::~Worker()
 {
   service_.stop();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
 }
 void Worker::run()
 {
   service_.run();
 }
 
+void Worker::runInThread()
+{
+  thread_ = boost::thread(&Worker::run, this);
+}
+
 void Worker::handle_accept(
     const boost::shared_ptr<WorkerConnection>& connection,
     const boost::system::error_code& err)
@@ -29,6 +29,7 @@
 #pragma once
 #include <boost/asio.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/thread/thread.hpp>
 
 #include "WorkerConnection.h"
 
@@ -47,10 +48,13 @@ class Worker
          const char* ip,
          unsigned short port);
   void run();
+  // Runs the worker on its own thread, joined when the worker is destroyed.
+  void runInThread();
   ~Worker();
 
  private:
   asio::io_service service_;
+  boost::thread thread_;
   tcp::acceptor acceptor_;
   Distributed* dist_;
   utl::Logger* logger_;
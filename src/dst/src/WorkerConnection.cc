@@ -118,6 +118,10 @@ void WorkerConnection::handle_read(boost::system::error_code const& err,
         sock_.close();
         return;
     }
+  } else if (err == asio::error::eof && bytes_transferred == 0) {
+    // Connections closed without any data are liveness probes from the
+    // load balancer.
+    sock_.close();
   } else {
     logger_->warn(utl::DST,
                   4,
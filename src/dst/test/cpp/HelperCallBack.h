@@ -26,6 +26,8 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <functional>
+
 #include "dst/Distributed.h"
 #include "dst/JobCallBack.h"
 #include "dst/JobMessage.h"
@@ -35,9 +37,18 @@ using namespace dst;
 class HelperCallBack : public dst::JobCallBack
 {
  public:
-  HelperCallBack(dst::Distributed* dist) : dist_(dist) {}
+  // on_job runs before every routing job is answered, e.g. to hold a
+  // worker back until the test releases it.
+  HelperCallBack(dst::Distributed* dist,
+                 std::function<void()> on_job = nullptr)
+      : dist_(dist), on_job_(std::move(on_job))
+  {
+  }
   void onRoutingJobReceived(dst::JobMessage& msg, dst::socket& sock) override
   {
+    if (on_job_) {
+      on_job_();
+    }
     JobMessage replyMsg;
     if (msg.getJobType() == JobMessage::JobType::ROUTING)
       replyMsg.setJobType(JobMessage::JobType::SUCCESS);
@@ -56,4 +67,5 @@ class HelperCallBack : public dst::JobCallBack
 
  private:
   dst::Distributed* dist_;
+  std::function<void()> on_job_;
 };
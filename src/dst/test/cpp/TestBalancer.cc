@@ -3,6 +3,9 @@
 #include <boost/asio.hpp>
 #include <boost/test/included/unit_test.hpp>
 #include <boost/thread/thread.hpp>
+#include <atomic>
+#include <future>
+#include <memory>
 #include <string>
 
 #include "HelperCallBack.h"
@@ -10,6 +13,7 @@
 #include "dst/BroadcastJobDescription.h"
 #include "dst/Distributed.h"
 #include "dst/JobMessage.h"
+#include "dst/WorkerStatsJobDescription.h"
 #include "utl/Logger.h"
 
 using namespace dst;
@@ -107,4 +111,93 @@ BOOST_AUTO_TEST_CASE(test_default)
   // history i.e have invalid state.
   BOOST_TEST(balancer->addWorker(local_ip, worker_port_2) == false);
 }
+BOOST_AUTO_TEST_CASE(test_adaptive)
+{
+  // The slow worker holds every job until the test releases it, so the
+  // re-dispatch below does not depend on how loaded the machine is.
+  std::promise<void> release_slow;
+  std::shared_future<void> slow_released = release_slow.get_future().share();
+  std::atomic<bool> slow_answered = false;
+
+  auto logger = std::make_unique<utl::Logger>();
+  auto dist = std::make_unique<Distributed>(logger.get());
+  auto slow_dist = std::make_unique<Distributed>(logger.get());
+  std::string local_ip = "127.0.0.1";
+  unsigned short balancer_port = 5560;
+  unsigned short fast_port = 5561;
+  unsigned short slow_port = 5562;
+  unsigned short dead_port = 5563;
+  auto local = asio::ip::address::from_string(local_ip);
+  asio::io_service io_service;
+  auto balancer = std::make_unique<LoadBalancer>(dist.get(),
+                                                 io_service,
+                                                 logger.get(),
+                                                 local_ip.c_str(),
+                                                 "",
+                                                 balancer_port);
+  balancer->addWorker(local_ip, fast_port);
+  balancer->addWorker(local_ip, slow_port);
+  asio::ip::address address;
+  unsigned short port;
+
+  // Expensive jobs are kept away from the worker that already has work.
+  balancer->getNextWorker(address, port, 10);
+  BOOST_TEST(port == fast_port);
+  balancer->getNextWorker(address, port, 1);
+  BOOST_TEST(port == slow_port);
+  balancer->getNextWorker(address, port, 1);
+  BOOST_TEST(port == slow_port);
+  balancer->releaseWorker(local, fast_port, 10, 0.01);
+  balancer->releaseWorker(local, slow_port, 1, 1.0);
+  balancer->releaseWorker(local, slow_port, 1, 1.0);
+
+  // The faster worker is preferred once both have a history.
+  balancer->getNextWorker(address, port, 1);
+  BOOST_TEST(port == fast_port);
+  balancer->releaseWorker(local, fast_port, 1, 0.001);
+
+  // A job stuck on the slow worker is re-dispatched to the fast one.
+  boost::thread t(boost::bind(&asio::io_service::run, &io_service));
+  dist->addCallBack(new HelperCallBack(dist.get()));
+  slow_dist->addCallBack(new HelperCallBack(slow_dist.get(), [&]() {
+    slow_released.wait();
+    slow_answered = true;
+  }));
+  dist->runWorker(local_ip.c_str(), fast_port, true);
+  slow_dist->runWorker(local_ip.c_str(), slow_port, true);
+  balancer->getNextWorker(address, port, 1000);  // keep the fast worker busy
+  BOOST_TEST(port == fast_port);
+  JobMessage msg(JobMessage::JobType::ROUTING);
+  JobMessage result;
+  BOOST_TEST(dist->sendJob(msg, local_ip.c_str(), balancer_port, result));
+  BOOST_TEST(result.getJobType() == JobMessage::JobType::SUCCESS);
+  // Only the speculative copy can have answered.
+  BOOST_TEST(!slow_answered);
+  balancer->releaseWorker(local, fast_port, 1000, 0.1);
+
+  // The stats endpoint reports every worker.
+  JobMessage stats_msg(JobMessage::JobType::WORKER_STATS);
+  BOOST_TEST(
+      dist->sendJob(stats_msg, local_ip.c_str(), balancer_port, result));
+  auto stats_desc
+      = static_cast<WorkerStatsJobDescription*>(result.getJobDescription());
+  BOOST_TEST(stats_desc->getStats().size() == 2);
+  BOOST_TEST(stats_desc->getStats()[0].completed_jobs >= 3);
+
+  // A worker that stops answering is evicted after missing heartbeats while
+  // a busy worker is kept.
+  balancer->addWorker(local_ip, dead_port);
+  for (int i = 0; i < max_missed_heartbeats; i++) {
+    balancer->checkWorkersHealth();
+  }
+  BOOST_TEST(balancer->getWorkersStats().size() == 2);
+
+  // Let the held job finish; the balancer waits for its relay thread and
+  // the workers are joined when their Distributed is destroyed.
+  release_slow.set_value();
+  io_service.stop();
+  t.join();
+  balancer.reset();
+  BOOST_TEST(slow_answered);
+}
 BOOST_AUTO_TEST_SUITE_END()
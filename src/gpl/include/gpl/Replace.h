@@ -69,6 +69,13 @@ class TimingBase;
 class InitialPlace;
 class NesterovPlace;
 
+// Iterative solver for the initial placement B2B systems.
+enum class InitialPlaceSolver
+{
+  BiCGSTAB,
+  CG  // conjugate gradient with a Jacobi (diagonal) preconditioner
+};
+
 class Replace
 {
  public:
@@ -83,7 +90,7 @@ class Replace
   void reset();
 
   void doIncrementalPlace(int threads);
-  void doInitialPlace();
+  void doInitialPlace(int threads);
   void runMBFF(int max_sz, float alpha, float beta, int threads, int num_paths);
 
   int doNesterovPlace(int threads, int start_iter = 0);
@@ -94,6 +101,7 @@ class Replace
   void setInitialPlaceMaxSolverIter(int iter);
   void setInitialPlaceMaxFanout(int fanout);
   void setInitialPlaceNetWeightScale(float scale);
+  void setInitialPlaceSolver(InitialPlaceSolver solver);
 
   void setNesterovPlaceMaxIter(int iter);
 
@@ -167,6 +175,7 @@ class Replace
   int initialPlaceMaxSolverIter_ = 100;
   int initialPlaceMaxFanout_ = 200;
   float initialPlaceNetWeightScale_ = 800;
+  InitialPlaceSolver initialPlaceSolver_ = InitialPlaceSolver::BiCGSTAB;
 
   int total_placeable_insts_ = 0;
 
@@ -33,6 +33,9 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -42,28 +45,17 @@
 
 namespace gpl {
 
-FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
+FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int numThreads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      numThreads_(numThreads)
 {
-  binDensity_ = new float*[binCntX_];
-  electroPhi_ = new float*[binCntX_];
-  electroForceX_ = new float*[binCntX_];
-  electroForceY_ = new float*[binCntX_];
-
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
-
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
-  }
+  binDensity_.resize(binCntX_ * binCntY_, 0);
+  electroPhi_.resize(binCntX_ * binCntY_, 0);
+  electroForceX_.resize(binCntX_ * binCntY_, 0);
+  electroForceY_.resize(binCntX_ * binCntY_, 0);
 
   csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
 
@@ -74,6 +66,21 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
 
   workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
 
+  // Fill the cos/sin table for the longest side the way ddct2d does. The
+  // 1D transforms only read it afterwards, so they can run concurrently.
+  const int n = std::max(binCntX_, binCntY_);
+  makewt(n >> 2, workArea_.data(), csTable_.data());
+  makect(n, workArea_.data(), csTable_.data() + (n >> 2));
+
+  // Small grids are not worth the thread startup.
+  if (binCntX_ * binCntY_ < 128 * 128 || n < 4) {
+    numThreads_ = 1;
+  }
+
+  // 16 floats fill a 64 byte cache line of each row.
+  colBlock_ = std::min(binCntY_, 16);
+  colBuffer_.resize(numThreads_ * binCntX_ * colBlock_, 0);
+
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -88,125 +95,118 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
   }
 }
 
-FFT::~FFT()
-{
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
-  }
-  delete[] binDensity_;
-  delete[] electroPhi_;
-  delete[] electroForceX_;
-  delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
-}
-
 void FFT::updateDensity(int x, int y, float density)
 {
-  binDensity_[x][y] = density;
+  binDensity_[index(x, y)] = density;
 }
 
 std::pair<float, float> FFT::getElectroForce(int x, int y) const
 {
-  return std::make_pair(electroForceX_[x][y], electroForceY_[x][y]);
+  return std::make_pair(electroForceX_[index(x, y)],
+                        electroForceY_[index(x, y)]);
 }
 
 float FFT::getElectroPhi(int x, int y) const
 {
-  return electroPhi_[x][y];
+  return electroPhi_[index(x, y)];
 }
 
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
+  transform2d(binDensity_, -1, false, false);
 
+  const double scale = 4.0 / binCntX_ / binCntY_;
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i][0] *= 0.5;
-  }
-
-  for (int i = 0; i < binCntY_; i++) {
-    binDensity_[0][i] *= 0.5;
-  }
+    float* density = &binDensity_[index(i, 0)];
+    float* phi = &electroPhi_[index(i, 0)];
+    float* electroX = &electroForceX_[index(i, 0)];
+    float* electroY = &electroForceY_[index(i, 0)];
+    const float wx = wx_[i];
+    const float wx2 = wxSquare_[i];
+
+    density[0] *= 0.5;
+    if (i == 0) {
+      for (int j = 0; j < binCntY_; j++) {
+        density[j] *= 0.5;
+      }
+    }
 
-  for (int i = 0; i < binCntX_; i++) {
+    //////////// lutong
+    //  denom =
+    //  wx2 / 4.0 +
+    //  wy2 / 4.0 ;
+    // a_phi = a_den / denom ;
+    ////b_phi = 0 ; // -1.0 * b / denom ;
+    ////a_ex = 0 ; // b_phi * wx ;
+    // a_ex = a_phi * wx / 2.0 ;
+    ////a_ey = 0 ; // b_phi * wy ;
+    // a_ey = a_phi * wy / 2.0 ;
+    ///////////
+#pragma omp simd
     for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
+      density[j] *= scale;
+      phi[j] = density[j] / (wx2 + wySquare_[j]);
+      electroX[j] = phi[j] * wx;
+      electroY[j] = phi[j] * wy_[j];
     }
   }
+  // The (0, 0) term is the average density, which exerts no force.
+  electroPhi_[0] = electroForceX_[0] = electroForceY_[0] = 0.0f;
 
-  for (int i = 0; i < binCntX_; i++) {
-    float wx = wx_[i];
-    float wx2 = wxSquare_[i];
-
-    for (int j = 0; j < binCntY_; j++) {
-      float wy = wy_[j];
-      float wy2 = wySquare_[j];
-
-      float density = binDensity_[i][j];
-      float phi = 0;
-      float electroX = 0, electroY = 0;
+  // Inverse DCT
+  transform2d(electroPhi_, 1, false, false);
+  transform2d(electroForceX_, 1, false, true);
+  transform2d(electroForceY_, 1, true, false);
+}
 
-      if (i == 0 && j == 0) {
-        phi = electroX = electroY = 0.0f;
+void FFT::transform2d(std::vector<float>& a,
+                      int isgn,
+                      bool rowSine,
+                      bool colSine)
+{
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+
+#pragma omp parallel num_threads(numThreads_)
+  {
+#pragma omp for schedule(static)
+    for (int i = 0; i < binCntX_; i++) {
+      float* row = &a[index(i, 0)];
+      if (rowSine) {
+        ddst(binCntY_, isgn, row, ip, w);
       } else {
-        //////////// lutong
-        //  denom =
-        //  wx2 / 4.0 +
-        //  wy2 / 4.0 ;
-        // a_phi = a_den / denom ;
-        ////b_phi = 0 ; // -1.0 * b / denom ;
-        ////a_ex = 0 ; // b_phi * wx ;
-        // a_ex = a_phi * wx / 2.0 ;
-        ////a_ey = 0 ; // b_phi * wy ;
-        // a_ey = a_phi * wy / 2.0 ;
-        ///////////
-        phi = density / (wx2 + wy2);
-        electroX = phi * wx;
-        electroY = phi * wy;
+        ddct(binCntY_, isgn, row, ip, w);
+      }
+    }
+
+    // Copy a block of columns to contiguous memory, transform each column
+    // and copy them back.
+    float* t = &colBuffer_[omp_get_thread_num() * binCntX_ * colBlock_];
+#pragma omp for schedule(static)
+    for (int j0 = 0; j0 < binCntY_; j0 += colBlock_) {
+      const int cols = std::min(colBlock_, binCntY_ - j0);
+      for (int i = 0; i < binCntX_; i++) {
+        const float* src = &a[index(i, j0)];
+        for (int k = 0; k < cols; k++) {
+          t[k * binCntX_ + i] = src[k];
+        }
+      }
+      for (int k = 0; k < cols; k++) {
+        if (colSine) {
+          ddst(binCntX_, isgn, &t[k * binCntX_], ip, w);
+        } else {
+          ddct(binCntX_, isgn, &t[k * binCntX_], ip, w);
+        }
+      }
+      for (int i = 0; i < binCntX_; i++) {
+        float* dst = &a[index(i, j0)];
+        for (int k = 0; k < cols; k++) {
+          dst[k] = t[k * binCntX_ + i];
+        }
       }
-      electroPhi_[i][j] = phi;
-      electroForceX_[i][j] = electroX;
-      electroForceY_[i][j] = electroY;
     }
   }
-  // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
 }
 
 }  // namespace gpl
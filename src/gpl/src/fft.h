@@ -40,8 +40,7 @@ namespace gpl {
 class FFT
 {
  public:
-  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
-  ~FFT();
+  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int numThreads = 1);
 
   // input func
   void updateDensity(int x, int y, float density);
@@ -54,12 +53,19 @@ class FFT
   float getElectroPhi(int x, int y) const;
 
  private:
-  // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
-  float** binDensity_ = nullptr;
-  float** electroPhi_ = nullptr;
-  float** electroForceX_ = nullptr;
-  float** electroForceY_ = nullptr;
+  // 2D DCT/DST of a binCntX_ x binCntY_ array. The rows get a DST if
+  // rowSine is set and a DCT otherwise, then the columns likewise for
+  // colSine. Same results as Ooura's ddct2d/ddsct2d/ddcst2d, with the
+  // rows and column blocks spread over numThreads_.
+  void transform2d(std::vector<float>& a, int isgn, bool rowSine, bool colSine);
+
+  int index(int x, int y) const { return x * binCntY_ + y; }
+
+  // 2D arrays of binCntX_ rows of binCntY_ floats each, stored row by row.
+  std::vector<float> binDensity_;
+  std::vector<float> electroPhi_;
+  std::vector<float> electroForceX_;
+  std::vector<float> electroForceY_;
 
   // cos/sin table (prev: w_2d)
   // length:  max(binCntX, binCntY) * 3 / 2
@@ -77,10 +83,16 @@ class FFT
   // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
   std::vector<int> workArea_;
 
+  // Columns are copied here colBlock_ at a time, binCntX_ * colBlock_
+  // floats per thread.
+  std::vector<float> colBuffer_;
+  int colBlock_ = 0;
+
   int binCntX_ = 0;
   int binCntY_ = 0;
   int binSizeX_ = 0;
   int binSizeY_ = 0;
+  int numThreads_ = 1;
 };
 
 //
@@ -92,6 +104,8 @@ class FFT
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 
 /// 2D FFT ////////////////////////////////////////////////////////////////
 void cdft2d(int, int, int, float**, float*, int*, float*);
@@ -33,10 +33,13 @@
 
 #include "initialPlace.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "placerBase.h"
 #include "solver.h"
+#include "utl/Tracer.h"
 
 namespace gpl {
 
@@ -54,6 +57,7 @@ void InitialPlaceVars::reset()
   maxSolverIter = 100;
   maxFanout = 200;
   netWeightScale = 800.0;
+  solver = InitialPlaceSolver::BiCGSTAB;
   debug = false;
 }
 
@@ -65,7 +69,7 @@ InitialPlace::InitialPlace(InitialPlaceVars ipVars,
 {
 }
 
-void InitialPlace::doBicgstabPlace()
+void InitialPlace::doInitialPlace(int threads)
 {
   ResidualError error;
 
@@ -79,11 +83,14 @@ void InitialPlace::doBicgstabPlace()
   // set ExtId for idx reference // easy recovery
   setPlaceInstExtId();
 
+  utl::TraceZone place_zone("gpl.initial_place");
   for (size_t iter = 1; iter <= ipVars_.maxIter; iter++) {
+    utl::TraceZone iter_zone("gpl.initial_place_iter");
     updatePinInfo();
-    createSparseMatrix();
+    createSparseMatrix(threads);
     error = cpuSparseSolve(ipVars_.maxSolverIter,
-                           iter,
+                           ipVars_.solver,
+                           threads,
                            placeInstForceMatrixX_,
                            fixedInstForceVecX_,
                            instLocVecX_,
@@ -214,9 +221,62 @@ void InitialPlace::updatePinInfo()
   }
 }
 
+// The B2B pattern changes little between iterations, so the matrix keeps
+// its sparsity pattern and only the values are updated when every entry
+// is already in it. Otherwise it is rebuilt with the union of the old and
+// new patterns. Once half of the kept pattern is no longer used by the
+// list, the pattern has drifted and is rebuilt from the list alone so it
+// does not keep growing.
+static void updateMatrix(SMatrix& matrix, const std::vector<T>& list)
+{
+  bool drifted = true;
+  if (matrix.isCompressed() && matrix.nonZeros() > 0) {
+    float* values = matrix.valuePtr();
+    const int* cols = matrix.innerIndexPtr();
+    const int* rows = matrix.outerIndexPtr();
+    std::fill(values, values + matrix.nonZeros(), 0.0f);
+    std::vector<bool> used(matrix.nonZeros(), false);
+    Eigen::Index used_count = 0;
+    bool fits = true;
+    for (const T& entry : list) {
+      const int* begin = cols + rows[entry.row()];
+      const int* end = cols + rows[entry.row() + 1];
+      const int* col = std::lower_bound(begin, end, entry.col());
+      if (col == end || *col != entry.col()) {
+        fits = false;
+        continue;
+      }
+      const Eigen::Index index = col - cols;
+      values[index] += entry.value();
+      if (!used[index]) {
+        used[index] = true;
+        used_count++;
+      }
+    }
+    drifted = used_count * 2 < matrix.nonZeros();
+    if (fits && !drifted) {
+      return;
+    }
+  }
+
+  if (!drifted) {
+    std::vector<T> merged;
+    merged.reserve(list.size() + matrix.nonZeros());
+    for (int row = 0; row < matrix.outerSize(); row++) {
+      for (SMatrix::InnerIterator it(matrix, row); it; ++it) {
+        merged.emplace_back(row, it.col(), 0.0f);
+      }
+    }
+    merged.insert(merged.end(), list.begin(), list.end());
+    matrix.setFromTriplets(merged.begin(), merged.end());
+  } else {
+    matrix.setFromTriplets(list.begin(), list.end());
+  }
+}
+
 // solve placeInstForceMatrixX_ * xcg_x_ = xcg_b_ and placeInstForceMatrixY_ *
 // ycg_x_ = ycg_b_ eq.
-void InitialPlace::createSparseMatrix()
+void InitialPlace::createSparseMatrix(int threads)
 {
   const int placeCnt = pbc_->placeInsts().size();
   instLocVecX_.resize(placeCnt);
@@ -224,22 +284,10 @@ void InitialPlace::createSparseMatrix()
   instLocVecY_.resize(placeCnt);
   fixedInstForceVecY_.resize(placeCnt);
 
-  placeInstForceMatrixX_.resize(placeCnt, placeCnt);
-  placeInstForceMatrixY_.resize(placeCnt, placeCnt);
-
-  //
-  // listX and listY is a temporary vector that have tuples, (idx1, idx2, val)
-  //
-  // listX finally becomes placeInstForceMatrixX_
-  // listY finally becomes placeInstForceMatrixY_
-  //
-  // The triplet vector is recommended usages
-  // to fill in SparseMatrix from Eigen docs.
-  //
-
-  std::vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
+  if (placeInstForceMatrixX_.rows() != placeCnt) {
+    placeInstForceMatrixX_.resize(placeCnt, placeCnt);
+    placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  }
 
   // initialize vector
   for (auto& inst : pbc_->placeInsts()) {
@@ -251,6 +299,39 @@ void InitialPlace::createSparseMatrix()
     fixedInstForceVecX_(idx) = fixedInstForceVecY_(idx) = 0;
   }
 
+  // X and Y only read the shared pin and instance data.
+#pragma omp parallel sections num_threads(std::min(threads, 2))
+  {
+#pragma omp section
+    createAxisMatrix(true);
+#pragma omp section
+    createAxisMatrix(false);
+  }
+}
+
+void InitialPlace::createAxisMatrix(bool isX)
+{
+  //
+  // list is a temporary vector that have tuples, (idx1, idx2, val)
+  //
+  // list finally becomes placeInstForceMatrixX_ or placeInstForceMatrixY_
+  //
+  // The triplet vector is recommended usages
+  // to fill in SparseMatrix from Eigen docs.
+  //
+  std::vector<T>& list = isX ? listX_ : listY_;
+  Eigen::VectorXf& fixedInstForceVec
+      = isX ? fixedInstForceVecX_ : fixedInstForceVecY_;
+  list.clear();
+
+  const auto coordi = [isX](const auto* obj) {
+    return isX ? obj->cx() : obj->cy();
+  };
+  const auto isBoundPin = [isX](const Pin* pin) {
+    return isX ? pin->isMinPinX() || pin->isMaxPinX()
+               : pin->isMinPinY() || pin->isMaxPinY();
+  };
+
   // for each net
   for (auto& net : pbc_->nets()) {
     // skip for small nets.
@@ -278,119 +359,64 @@ void InitialPlace::createSparseMatrix()
           continue;
         }
 
-        // B2B modeling on min/maxX pins.
-        if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
-            || pin2->isMaxPinX()) {
-          int diffX = abs(pin1->cx() - pin2->cx());
-          float weightX = 0;
-          if (diffX > ipVars_.minDiffLength) {
-            weightX = netWeight / diffX;
-          } else {
-            weightX = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listX.emplace_back(inst1, inst1, weightX);
-            listX.emplace_back(inst2, inst2, weightX);
-
-            listX.emplace_back(inst1, inst2, -weightX);
-            listX.emplace_back(inst2, inst1, -weightX);
-
-            fixedInstForceVecX_(inst1)
-                += -weightX
-                   * ((pin1->cx() - pin1->instance()->cx())
-                      - (pin2->cx() - pin2->instance()->cx()));
-
-            fixedInstForceVecX_(inst2)
-                += -weightX
-                   * ((pin2->cx() - pin2->instance()->cx())
-                      - (pin1->cx() - pin1->instance()->cx()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listX.emplace_back(inst2, inst2, weightX);
-
-            fixedInstForceVecX_(inst2)
-                += weightX
-                   * (pin1->cx() - (pin2->cx() - pin2->instance()->cx()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listX.emplace_back(inst1, inst1, weightX);
-
-            fixedInstForceVecX_(inst1)
-                += weightX
-                   * (pin2->cx() - (pin1->cx() - pin1->instance()->cx()));
-          }
+        // B2B modeling on min/max pins.
+        if (!isBoundPin(pin1) && !isBoundPin(pin2)) {
+          continue;
         }
+        int diff = abs(coordi(pin1) - coordi(pin2));
+        float weight = 0;
+        if (diff > ipVars_.minDiffLength) {
+          weight = netWeight / diff;
+        } else {
+          weight = netWeight / ipVars_.minDiffLength;
+        }
+
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
 
-        // B2B modeling on min/maxY pins.
-        if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
-            || pin2->isMaxPinY()) {
-          int diffY = abs(pin1->cy() - pin2->cy());
-          float weightY = 0;
-          if (diffY > ipVars_.minDiffLength) {
-            weightY = netWeight / diffY;
-          } else {
-            weightY = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listY.emplace_back(inst1, inst1, weightY);
-            listY.emplace_back(inst2, inst2, weightY);
-
-            listY.emplace_back(inst1, inst2, -weightY);
-            listY.emplace_back(inst2, inst1, -weightY);
-
-            fixedInstForceVecY_(inst1)
-                += -weightY
-                   * ((pin1->cy() - pin1->instance()->cy())
-                      - (pin2->cy() - pin2->instance()->cy()));
-
-            fixedInstForceVecY_(inst2)
-                += -weightY
-                   * ((pin2->cy() - pin2->instance()->cy())
-                      - (pin1->cy() - pin1->instance()->cy()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listY.emplace_back(inst2, inst2, weightY);
-
-            fixedInstForceVecY_(inst2)
-                += weightY
-                   * (pin1->cy() - (pin2->cy() - pin2->instance()->cy()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listY.emplace_back(inst1, inst1, weightY);
-
-            fixedInstForceVecY_(inst1)
-                += weightY
-                   * (pin2->cy() - (pin1->cy() - pin1->instance()->cy()));
-          }
+          list.emplace_back(inst1, inst1, weight);
+          list.emplace_back(inst2, inst2, weight);
+
+          list.emplace_back(inst1, inst2, -weight);
+          list.emplace_back(inst2, inst1, -weight);
+
+          fixedInstForceVec(inst1)
+              += -weight
+                 * ((coordi(pin1) - coordi(pin1->instance()))
+                    - (coordi(pin2) - coordi(pin2->instance())));
+
+          fixedInstForceVec(inst2)
+              += -weight
+                 * ((coordi(pin2) - coordi(pin2->instance()))
+                    - (coordi(pin1) - coordi(pin1->instance())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          list.emplace_back(inst2, inst2, weight);
+
+          fixedInstForceVec(inst2)
+              += weight
+                 * (coordi(pin1) - (coordi(pin2) - coordi(pin2->instance())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          list.emplace_back(inst1, inst1, weight);
+
+          fixedInstForceVec(inst1)
+              += weight
+                 * (coordi(pin2) - (coordi(pin1) - coordi(pin1->instance())));
         }
       }
     }
   }
 
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+  updateMatrix(isX ? placeInstForceMatrixX_ : placeInstForceMatrixY_, list);
 }
 
 void InitialPlace::updateCoordi()
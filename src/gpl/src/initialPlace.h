@@ -35,7 +35,9 @@
 
 #include <Eigen/SparseCore>
 #include <memory>
+#include <vector>
 
+#include "gpl/Replace.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
 
@@ -57,6 +59,7 @@ class InitialPlaceVars
   int maxSolverIter;
   int maxFanout;
   float netWeightScale;
+  InitialPlaceSolver solver;
   bool debug;
 
   InitialPlaceVars();
@@ -72,7 +75,7 @@ class InitialPlace
                std::shared_ptr<PlacerBaseCommon> pbc,
                std::vector<std::shared_ptr<PlacerBase>>& pbVec,
                utl::Logger* logger);
-  void doBicgstabPlace();
+  void doInitialPlace(int threads);
 
  private:
   InitialPlaceVars ipVars_;
@@ -104,16 +107,20 @@ class InitialPlace
   //        SparseMatrix that contains connectivity forces on Y // B2B model is
   //        used
   //
-  // Used the interative BiCGSTAB solver to solve matrix eqs.
+  // Used the interative BiCGSTAB or CG solver to solve matrix eqs.
 
   Eigen::VectorXf instLocVecX_, fixedInstForceVecX_;
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
 
+  // (idx1, idx2, val) entries of the matrices, kept to reuse their storage.
+  std::vector<Eigen::Triplet<float>> listX_, listY_;
+
   void placeInstsCenter();
   void setPlaceInstExtId();
   void updatePinInfo();
-  void createSparseMatrix();
+  void createSparseMatrix(int threads);
+  void createAxisMatrix(bool isX);
   void updateCoordi();
 };
 
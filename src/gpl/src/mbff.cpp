@@ -1219,6 +1219,7 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
       }
     }
 
+#pragma omp critical(mbff_tray_sizes)
     for (const auto& sizes : trays_used) {
       tray_sizes_used_[sizes.second]++;
     }
@@ -1757,7 +1758,8 @@ float MBFF::GetKSilh(const std::vector<std::vector<Flop>>& clusters,
 
 void MBFF::KMeansDecomp(const std::vector<Flop>& flops,
                         const int max_sz,
-                        std::vector<std::vector<Flop>>& pointsets)
+                        std::vector<std::vector<Flop>>& pointsets,
+                        std::mt19937* rng)
 {
   const int num_flops = static_cast<int>(flops.size());
   if (max_sz == -1 || num_flops <= max_sz) {
@@ -1772,7 +1774,8 @@ void MBFF::KMeansDecomp(const std::vector<Flop>& flops,
   std::vector<std::vector<int>> rand_nums(27);
   for (int i = 0; i < multistart_ + 7; i++) {
     for (int j = 0; j < 20; j++) {
-      rand_nums[i].push_back(std::rand());
+      rand_nums[i].push_back(rng ? static_cast<int>((*rng)() >> 1)
+                                 : std::rand());
     }
   }
 
@@ -1885,7 +1888,7 @@ void MBFF::KMeansDecomp(const std::vector<Flop>& flops,
   for (int i = 0; i < best_k; i++) {
     if (static_cast<int>(nxt_clusters[i].size())) {
       std::vector<std::vector<Flop>> R;
-      KMeansDecomp(nxt_clusters[i], max_sz, R);
+      KMeansDecomp(nxt_clusters[i], max_sz, R, rng);
       for (auto& x : R) {
         pointsets.push_back(x);
       }
@@ -1893,6 +1896,190 @@ void MBFF::KMeansDecomp(const std::vector<Flop>& flops,
   }
 }
 
+void MBFF::SplitTiles(const std::vector<Flop>& flops,
+                      const int tile_sz,
+                      std::vector<std::vector<Flop>>& tiles)
+{
+  // recursive median bisection along the longer side of the bounding box
+  std::vector<std::vector<Flop>> stack{flops};
+  while (!stack.empty()) {
+    std::vector<Flop> cur = std::move(stack.back());
+    stack.pop_back();
+    if (static_cast<int>(cur.size()) <= tile_sz) {
+      tiles.push_back(std::move(cur));
+      continue;
+    }
+
+    float lx = std::numeric_limits<float>::max();
+    float ly = std::numeric_limits<float>::max();
+    float ux = std::numeric_limits<float>::lowest();
+    float uy = std::numeric_limits<float>::lowest();
+    for (const Flop& flop : cur) {
+      lx = std::min(lx, flop.pt.x);
+      ly = std::min(ly, flop.pt.y);
+      ux = std::max(ux, flop.pt.x);
+      uy = std::max(uy, flop.pt.y);
+    }
+    const bool split_x = (ux - lx) >= (uy - ly);
+    const auto mid = cur.begin() + cur.size() / 2;
+    std::nth_element(
+        cur.begin(), mid, cur.end(), [split_x](const Flop& a, const Flop& b) {
+          if (split_x) {
+            return std::tie(a.pt.x, a.pt.y, a.idx)
+                   < std::tie(b.pt.x, b.pt.y, b.idx);
+          }
+          return std::tie(a.pt.y, a.pt.x, a.idx)
+                 < std::tie(b.pt.y, b.pt.x, b.idx);
+        });
+    stack.emplace_back(mid, cur.end());
+    stack.emplace_back(cur.begin(), mid);
+  }
+}
+
+void MBFF::MergeTileBoundaries(
+    std::vector<std::vector<std::vector<Flop>>>& tile_pointsets,
+    const int max_sz,
+    std::vector<std::vector<Flop>>& pointsets)
+{
+  struct PointsetInfo
+  {
+    int tile;
+    Point center;
+    float radius;
+    std::vector<Flop>* flops;
+  };
+
+  std::vector<PointsetInfo> infos;
+  for (size_t t = 0; t < tile_pointsets.size(); t++) {
+    for (std::vector<Flop>& pointset : tile_pointsets[t]) {
+      Point center{0, 0};
+      for (const Flop& flop : pointset) {
+        center.x += flop.pt.x;
+        center.y += flop.pt.y;
+      }
+      center.x /= pointset.size();
+      center.y /= pointset.size();
+      float radius = 0;
+      for (const Flop& flop : pointset) {
+        radius = std::max(radius, GetDist(flop.pt, center));
+      }
+      infos.push_back({static_cast<int>(t), center, radius, &pointset});
+    }
+  }
+
+  /*
+  pointsets from different tiles whose extents touch are candidates for
+  merging; sweep the pointsets sorted by center x to find them
+  */
+  const int num_sets = static_cast<int>(infos.size());
+  std::vector<int> order(num_sets);
+  float max_radius = 0;
+  for (int i = 0; i < num_sets; i++) {
+    order[i] = i;
+    max_radius = std::max(max_radius, infos[i].radius);
+  }
+  std::sort(order.begin(), order.end(), [&infos](int a, int b) {
+    return std::tie(infos[a].center.x, a) < std::tie(infos[b].center.x, b);
+  });
+
+  std::vector<std::pair<float, std::pair<int, int>>> cluster_pairs;
+  for (int i = 0; i < num_sets; i++) {
+    const PointsetInfo& a = infos[order[i]];
+    for (int j = i + 1; j < num_sets; j++) {
+      const PointsetInfo& b = infos[order[j]];
+      if (b.center.x - a.center.x > a.radius + max_radius) {
+        break;
+      }
+      if (a.tile == b.tile
+          || static_cast<int>(a.flops->size() + b.flops->size()) > max_sz) {
+        continue;
+      }
+      const float dist = GetDist(a.center, b.center);
+      if (dist <= a.radius + b.radius) {
+        cluster_pairs.emplace_back(dist, std::minmax(order[i], order[j]));
+      }
+    }
+  }
+  std::sort(cluster_pairs.begin(), cluster_pairs.end());
+
+  std::vector<int> id(num_sets);
+  std::vector<int> sz(num_sets);
+  for (int i = 0; i < num_sets; i++) {
+    id[i] = i;
+    sz[i] = static_cast<int>(infos[i].flops->size());
+  }
+  auto find = [&id](int i) {
+    while (id[i] != i) {
+      id[i] = id[id[i]];
+      i = id[i];
+    }
+    return i;
+  };
+
+  int num_merged = 0;
+  for (const auto& cluster_pair : cluster_pairs) {
+    const int root1 = find(cluster_pair.second.first);
+    const int root2 = find(cluster_pair.second.second);
+    if (root1 == root2 || sz[root1] + sz[root2] > max_sz) {
+      continue;
+    }
+    id[root2] = root1;
+    sz[root1] += sz[root2];
+    num_merged++;
+  }
+
+  std::vector<int> root_to_set(num_sets, -1);
+  for (int i = 0; i < num_sets; i++) {
+    const int root = find(i);
+    if (root_to_set[root] == -1) {
+      root_to_set[root] = static_cast<int>(pointsets.size());
+      pointsets.emplace_back();
+    }
+    std::vector<Flop>& pointset = pointsets[root_to_set[root]];
+    pointset.insert(
+        pointset.end(), infos[i].flops->begin(), infos[i].flops->end());
+  }
+
+  debugPrint(log_,
+             utl::GPL,
+             "mbff",
+             1,
+             "{} pointsets merged across tile boundaries",
+             num_merged);
+}
+
+void MBFF::TiledDecomp(const std::vector<Flop>& flops,
+                       const int max_sz,
+                       std::vector<std::vector<Flop>>& pointsets)
+{
+  std::vector<std::vector<Flop>> tiles;
+  SplitTiles(flops, max_sz * tile_scale_, tiles);
+  const int num_tiles = static_cast<int>(tiles.size());
+
+  // seeds are drawn up front so the result does not depend on the schedule
+  std::vector<unsigned> seeds(num_tiles);
+  for (int t = 0; t < num_tiles; t++) {
+    seeds[t] = std::rand();
+  }
+
+  std::vector<std::vector<std::vector<Flop>>> tile_pointsets(num_tiles);
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (int t = 0; t < num_tiles; t++) {
+    std::mt19937 rng(seeds[t]);
+    KMeansDecomp(tiles[t], max_sz, tile_pointsets[t], &rng);
+  }
+
+  debugPrint(log_,
+             utl::GPL,
+             "mbff",
+             1,
+             "{} flops split into {} tiles",
+             flops.size(),
+             num_tiles);
+
+  MergeTileBoundaries(tile_pointsets, max_sz, pointsets);
+}
+
 float MBFF::GetPairDisplacements()
 {
   float ret = 0;
@@ -1915,7 +2102,11 @@ float MBFF::RunClustering(const std::vector<Flop>& flops,
                           const std::vector<int> array_mask)
 {
   std::vector<std::vector<Flop>> pointsets;
-  KMeansDecomp(flops, mx_sz, pointsets);
+  if (mx_sz != -1 && static_cast<int>(flops.size()) > mx_sz * tile_scale_) {
+    TiledDecomp(flops, mx_sz, pointsets);
+  } else {
+    KMeansDecomp(flops, mx_sz, pointsets);
+  }
 
   // all_start_trays[t][i][j]: start trays of size 2^i, multistart = j for
   // pointset[t]
@@ -1941,7 +2132,7 @@ float MBFF::RunClustering(const std::vector<Flop>& flops,
     }
   }
 
-  float ans = 0;
+  std::vector<float> costs(num_pointsets, 0);
   std::vector<std::pair<int, int>> all_mappings[num_pointsets];
   std::vector<Tray> all_final_trays[num_pointsets];
 
@@ -1986,10 +2177,14 @@ float MBFF::RunClustering(const std::vector<Flop>& flops,
       }
     }
     std::vector<std::pair<int, int>> mapping(num_flops);
-    const float cur_ans = RunILP(
+    costs[t] = RunILP(
         pointsets[t], all_final_trays[t], mapping, alpha, beta, array_mask);
     all_mappings[t] = std::move(mapping);
-    ans += cur_ans;
+  }
+
+  float ans = 0;
+  for (const float cost : costs) {
+    ans += cost;
   }
 
   for (int t = 0; t < num_pointsets; t++) {
@@ -35,6 +35,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <vector>
@@ -178,9 +179,25 @@ class MBFF
               std::vector<int>& rand_nums);
   float GetKSilh(const std::vector<std::vector<Flop>>& clusters,
                  const std::vector<Point>& centers);
+  // rng = nullptr draws the k-means seeds from std::rand
   void KMeansDecomp(const std::vector<Flop>& flops,
                     int max_sz,
-                    std::vector<std::vector<Flop>>& pointsets);
+                    std::vector<std::vector<Flop>>& pointsets,
+                    std::mt19937* rng = nullptr);
+
+  // split flops into spatial tiles of at most tile_sz flops
+  void SplitTiles(const std::vector<Flop>& flops,
+                  int tile_sz,
+                  std::vector<std::vector<Flop>>& tiles);
+  // merge neighboring pointsets of different tiles while they fit in max_sz
+  void MergeTileBoundaries(
+      std::vector<std::vector<std::vector<Flop>>>& tile_pointsets,
+      int max_sz,
+      std::vector<std::vector<Flop>>& pointsets);
+  // KMeansDecomp on spatial tiles in parallel for large flop sets
+  void TiledDecomp(const std::vector<Flop>& flops,
+                   int max_sz,
+                   std::vector<std::vector<Flop>>& pointsets);
 
   void MinCostFlow(const std::vector<Flop>& flops,
                    std::vector<Tray>& trays,
@@ -275,6 +292,8 @@ class MBFF
   std::vector<int> unused_;
   // max tray size: 1 << (7 - 1) = 64 bits
   int num_sizes_ = 7;
+  // flop sets larger than max split size * tile_scale_ are tiled
+  int tile_scale_ = 20;
   // ind of last test tray
   int test_idx_;
   // all MBFF next_states
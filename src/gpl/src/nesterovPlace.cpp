@@ -46,6 +46,7 @@
 #include "routeBase.h"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
 
 namespace gpl {
 using utl::GPL;
@@ -327,9 +328,12 @@ int NesterovPlace::doNesterovPlace(int start_iter)
     nb->resetMinSumOverflow();
   }
 
+  utl::TraceZone place_zone("gpl.nesterov_place");
+
   // Core Nesterov Loop
   int iter = start_iter;
   for (; iter < npVars_.maxNesterovIter; iter++) {
+    utl::TraceZone iter_zone("gpl.nesterov_iter");
     float prevA = curA;
 
     // here, prevA is a_(k), curA is a_(k+1)
@@ -431,6 +435,7 @@ int NesterovPlace::doNesterovPlace(int start_iter)
       // See timingBase.cpp in detail
       log_->info(
           GPL, 100, "Timing-driven: executing resizer for reweighting nets.");
+      utl::TraceZone timing_zone("gpl.timing_driven");
       bool shouldTdProceed = tb_->updateGNetWeights(average_overflow_);
 
       // problem occured
@@ -504,6 +509,7 @@ int NesterovPlace::doNesterovPlace(int start_iter)
         && npVars_.routabilityCheckOverflow >= average_overflow_unscaled_) {
       // recover the densityPenalty values
       // if further routability-driven is needed
+      utl::TraceZone routability_zone("gpl.routability_driven");
       std::pair<bool, bool> result = rb_->routability();
       isRoutabilityNeed_ = result.first;
       bool isRevertInitNeeded = result.second;
@@ -1,4 +1,6 @@
 %{
+#include <cstring>
+
 #include "ord/OpenRoad.hh"
 #include "gpl/Replace.h"
 #include "odb/db.h"
@@ -15,6 +17,7 @@ getReplace();
 using ord::getOpenRoad;
 using ord::getReplace;
 using gpl::Replace;
+using gpl::InitialPlaceSolver;
 
 %}
 
@@ -33,7 +36,8 @@ void
 replace_initial_place_cmd()
 {
   Replace* replace = getReplace();
-  replace->doInitialPlace();
+  int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  replace->doInitialPlace(threads);
 }
 
 void 
@@ -82,6 +86,17 @@ set_initial_place_max_fanout_cmd(int fanout)
   replace->setInitialPlaceMaxFanout(fanout);
 }
 
+void
+set_initial_place_solver_cmd(const char* solver)
+{
+  Replace* replace = getReplace();
+  if (strcmp(solver, "cg") == 0) {
+    replace->setInitialPlaceSolver(InitialPlaceSolver::CG);
+  } else {
+    replace->setInitialPlaceSolver(InitialPlaceSolver::BiCGSTAB);
+  }
+}
+
 void
 set_nesv_place_iter_cmd(int iter)
 {
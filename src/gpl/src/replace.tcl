@@ -50,6 +50,7 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_solver initial_place_solver]\
     [-routability_use_grt]\
     [-routability_target_rc_metric routability_target_rc_metric]\
     [-routability_check_overflow routability_check_overflow]\
@@ -62,6 +63,8 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
+    [-timing_driven_virtual_repair]\
+    [-timing_driven_reuse_distance timing_driven_reuse_distance]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
 }
@@ -73,6 +76,7 @@ proc global_placement { args } {
       -min_phi_coef -max_phi_coef -overflow \
       -reference_hpwl \
       -initial_place_max_iter -initial_place_max_fanout \
+      -initial_place_solver \
       -routability_check_overflow -routability_max_density \
       -routability_max_bloat_iter -routability_max_inflation_iter \
       -routability_target_rc_metric \
@@ -82,6 +86,7 @@ proc global_placement { args } {
       -timing_driven_net_reweight_overflow \
       -timing_driven_net_weight_max \
       -timing_driven_nets_percentage \
+      -timing_driven_reuse_distance \
       -pad_left -pad_right} \
     flags {-skip_initial_place \
       -skip_nesterov_place \
@@ -91,6 +96,7 @@ proc global_placement { args } {
       -disable_timing_driven \
       -disable_routability_driven \
       -skip_io \
+      -timing_driven_virtual_repair \
       -incremental}
 
   # flow control for initial_place
@@ -141,6 +147,16 @@ proc global_placement { args } {
     if { [info exists keys(-timing_driven_nets_percentage)] } {
       rsz::set_worst_slack_nets_percent $keys(-timing_driven_nets_percentage)
     }
+
+    rsz::set_virtual_resize_slacks \
+      [info exists flags(-timing_driven_virtual_repair)]
+    if { [info exists keys(-timing_driven_reuse_distance)] } {
+      set reuse_distance $keys(-timing_driven_reuse_distance)
+      sta::check_positive_float "-timing_driven_reuse_distance" $reuse_distance
+      rsz::set_resize_slacks_reuse_distance [sta::distance_ui_sta $reuse_distance]
+    } else {
+      rsz::set_resize_slacks_reuse_distance 0
+    }
   }
 
   if { [info exists flags(-disable_timing_driven)] } {
@@ -174,6 +190,14 @@ proc global_placement { args } {
     gpl::set_initial_place_max_fanout_cmd $initial_place_max_fanout
   }
 
+  if { [info exists keys(-initial_place_solver)] } {
+    set initial_place_solver $keys(-initial_place_solver)
+    if { [lsearch -exact {bicgstab cg} $initial_place_solver] == -1 } {
+      utl::error GPL 153 "-initial_place_solver must be bicgstab or cg."
+    }
+    gpl::set_initial_place_solver_cmd $initial_place_solver
+  }
+
   # density settings
   set target_density 0.7
   set uniform_mode 0
@@ -407,7 +407,8 @@ static float getUsageCapacityRatio(Tile* tile,
 void RouteBase::updateRudyRoute()
 {
   grt::Rudy* rudy = grouter_->getRudy();
-  rudy->calculateRudy();
+  rudy->setNumThreads(nbc_->getNumThreads());
+  rudy->updateRudy();
   tg_->setNumRoutingLayers(0);
 
   // update grid tile info
@@ -35,10 +35,61 @@
 
 #include "solver.h"
 
+#include <omp.h>
+
+#include <algorithm>
+
 namespace gpl {
 
+template <typename Solver>
+static float solve(Solver& solver,
+                   int maxSolverIter,
+                   SMatrix& placeInstForceMatrix,
+                   Eigen::VectorXf& fixedInstForceVec,
+                   Eigen::VectorXf& instLocVec)
+{
+  solver.setMaxIterations(maxSolverIter);
+  solver.compute(placeInstForceMatrix);
+  instLocVec = solver.solveWithGuess(fixedInstForceVec, instLocVec);
+  return solver.error();
+}
+
+static float solveAxis(int maxSolverIter,
+                       InitialPlaceSolver solverType,
+                       SMatrix& placeInstForceMatrix,
+                       Eigen::VectorXf& fixedInstForceVec,
+                       Eigen::VectorXf& instLocVec)
+{
+  // The B2B matrices are symmetric positive semidefinite and the systems
+  // are consistent, so CG applies. Lower | Upper makes CG multiply with the
+  // whole row major matrix, which Eigen runs on multiple threads.
+  switch (solverType) {
+    case InitialPlaceSolver::BiCGSTAB: {
+      BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
+      return solve(solver,
+                   maxSolverIter,
+                   placeInstForceMatrix,
+                   fixedInstForceVec,
+                   instLocVec);
+    }
+    case InitialPlaceSolver::CG: {
+      ConjugateGradient<SMatrix,
+                        Eigen::Lower | Eigen::Upper,
+                        DiagonalPreconditioner<float>>
+          solver;
+      return solve(solver,
+                   maxSolverIter,
+                   placeInstForceMatrix,
+                   fixedInstForceVec,
+                   instLocVec);
+    }
+  }
+  return 0;
+}
+
 ResidualError cpuSparseSolve(int maxSolverIter,
-                             int iter,
+                             InitialPlaceSolver solverType,
+                             int threads,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
@@ -48,15 +99,29 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              utl::Logger* logger)
 {
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
-  solver.setMaxIterations(maxSolverIter);
-  solver.compute(placeInstForceMatrixX);
-  instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
-  error.x = solver.error();
-
-  solver.compute(placeInstForceMatrixY);
-  instLocVecY = solver.solveWithGuess(fixedInstForceVecY, instLocVecY);
-  error.y = solver.error();
+  // X and Y are solved concurrently and each solver multiplies with its
+  // matrix on half of the threads.
+  const int max_active_levels = omp_get_max_active_levels();
+  const int eigen_threads = Eigen::nbThreads();
+  omp_set_max_active_levels(2);
+  Eigen::setNbThreads(std::max(threads / 2, 1));
+#pragma omp parallel sections num_threads(std::min(threads, 2))
+  {
+#pragma omp section
+    error.x = solveAxis(maxSolverIter,
+                        solverType,
+                        placeInstForceMatrixX,
+                        fixedInstForceVecX,
+                        instLocVecX);
+#pragma omp section
+    error.y = solveAxis(maxSolverIter,
+                        solverType,
+                        placeInstForceMatrixY,
+                        fixedInstForceVecY,
+                        instLocVecY);
+  }
+  omp_set_max_active_levels(max_active_levels);
+  Eigen::setNbThreads(eigen_threads);
   return error;
 }
 }  // namespace gpl
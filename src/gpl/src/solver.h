@@ -39,6 +39,7 @@
 #include <Eigen/SparseCore>
 #include <memory>
 
+#include "gpl/Replace.h"
 #include "graphics.h"
 #include "odb/db.h"
 #include "placerBase.h"
@@ -57,13 +58,17 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
+using Eigen::ConjugateGradient;
+using Eigen::DiagonalPreconditioner;
 using Eigen::IdentityPreconditioner;
 using utl::GPL;
 
 using SMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
 
+// Solves the X and Y systems concurrently when threads > 1.
 ResidualError cpuSparseSolve(int maxSolverIter,
-                             int iter,
+                             InitialPlaceSolver solverType,
+                             int threads,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
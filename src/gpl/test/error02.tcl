@@ -0,0 +1,7 @@
+source helpers.tcl
+set test_name error01
+read_lef ./nangate45.lef
+read_def ./$test_name.def
+
+catch {global_placement -skip_initial_place -initial_place_solver gmres} error
+puts $error
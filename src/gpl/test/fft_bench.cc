@@ -0,0 +1,41 @@
+// Times gpl::FFT::doFFT over a range of bin grid sizes and thread counts.
+//   fft_bench [max_threads]
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+#include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/fft.h"
+
+int main(int argc, char* argv[])
+{
+  const int max_threads = argc > 1 ? std::atoi(argv[1]) : 8;
+  const int iterations = 10;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> dist(0.0, 1.5);
+
+  fmt::print("{:>12} {:>8} {:>12}\n", "bins", "threads", "ms/solve");
+  for (int bin_cnt = 64; bin_cnt <= 2048; bin_cnt *= 2) {
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+      auto fft = std::make_unique<gpl::FFT>(bin_cnt, bin_cnt, 1, 1, threads);
+      for (int x = 0; x < bin_cnt; x++) {
+        for (int y = 0; y < bin_cnt; y++) {
+          fft->updateDensity(x, y, dist(gen));
+        }
+      }
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        fft->doFFT();
+      }
+      const std::chrono::duration<double, std::milli> elapsed
+          = std::chrono::steady_clock::now() - start;
+      fmt::print("{:>12} {:>8} {:>12.3f}\n",
+                 fmt::format("{}x{}", bin_cnt, bin_cnt),
+                 threads,
+                 elapsed.count() / iterations);
+    }
+  }
+  return 0;
+}
@@ -146,4 +146,31 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+// The threaded transform must match the serial one bit for bit.
+TEST(FloatFFTTest, Threads)
+{
+  const int bin_cnt_x = 256;
+  const int bin_cnt_y = 128;
+  gpl::FFT serial(bin_cnt_x, bin_cnt_y, 10, 14, 1);
+  gpl::FFT threaded(bin_cnt_x, bin_cnt_y, 10, 14, 4);
+
+  for (int x = 0; x < bin_cnt_x; x++) {
+    for (int y = 0; y < bin_cnt_y; y++) {
+      const float density = ((x * 7 + y * 13) % 17) / 8.0f;
+      serial.updateDensity(x, y, density);
+      threaded.updateDensity(x, y, density);
+    }
+  }
+
+  serial.doFFT();
+  threaded.doFFT();
+
+  for (int x = 0; x < bin_cnt_x; x++) {
+    for (int y = 0; y < bin_cnt_y; y++) {
+      EXPECT_EQ(serial.getElectroForce(x, y), threaded.getElectroForce(x, y));
+      EXPECT_EQ(serial.getElectroPhi(x, y), threaded.getElectroPhi(x, y));
+    }
+  }
+}
+
 }  // namespace
@@ -0,0 +1,150 @@
+#include "src/gpl/src/mbff.h"
+
+#include <tcl.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "db_sta/MakeDbSta.hh"
+#include "db_sta/dbNetwork.hh"
+#include "db_sta/dbSta.hh"
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/lefin.h"
+#include "sta/Sta.hh"
+#include "utl/Logger.h"
+#include "utl/deleter.h"
+
+namespace gpl {
+
+namespace {
+
+std::once_flag init_sta_flag;
+
+const char* tech_lef = "./asap7/asap7_tech_1x_201209.lef";
+// lef and liberty of the single bit flop and of each tray
+const std::vector<std::pair<const char*, const char*>> libs = {
+    {"./SingleBit/asap7sc7p5t_28_L_1x_220121a.lef",
+     "./SingleBit/asap7sc7p5t_SEQ_LVT_TT_nldm_220123.lib"},
+    {"./2BitTrayH2/asap7sc7p5t_DFFHQNV2X.lef",
+     "./2BitTrayH2/asap7sc7p5t_DFFHQNV2X_LVT_TT_nldm_FAKE.lib"},
+    {"./4BitTrayH4/asap7sc7p5t_DFFHQNV4X.lef",
+     "./4BitTrayH4/asap7sc7p5t_DFFHQNV4X_LVT_TT_nldm_FAKE.lib"},
+    {"./4BitTrayH2W2/asap7sc7p5t_DFFHQNH2V2X.lef",
+     "./4BitTrayH2W2/asap7sc7p5t_DFFHQNH2V2X_LVT_TT_nldm_FAKE.lib"},
+};
+
+// name, master and location of an instance
+using InstPlacement = std::tuple<std::string, std::string, int, int>;
+
+int bitCount(const std::string& master_name)
+{
+  if (master_name.find("V4X") != std::string::npos
+      || master_name.find("H2V2X") != std::string::npos) {
+    return 4;
+  }
+  if (master_name.find("V2X") != std::string::npos) {
+    return 2;
+  }
+  return 1;
+}
+
+class MbffTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    std::call_once(init_sta_flag, []() { sta::initSta(); });
+  }
+
+  // Places num_flops flops on one clock net, clusters them and returns the
+  // resulting instances sorted by name.
+  std::vector<InstPlacement> clusterFlops(const int num_flops,
+                                          const int max_split_size,
+                                          const int threads)
+  {
+    utl::Logger logger;
+    auto db = utl::deleted_unique_ptr<odb::dbDatabase>(
+        odb::dbDatabase::create(), &odb::dbDatabase::destroy);
+    std::unique_ptr<sta::dbSta> sta(ord::makeDbSta());
+    sta->initVars(Tcl_CreateInterp(), db.get(), &logger);
+
+    odb::lefin lef_reader(db.get(), &logger, false);
+    odb::dbTech* tech = lef_reader.createTech("asap7", tech_lef);
+    for (const auto& [lef, lib] : libs) {
+      odb::dbLib* db_lib = lef_reader.createLib(tech, lef, lef);
+      sta->postReadLef(nullptr, db_lib);
+      sta->readLiberty(lib,
+                       sta->findCorner("default"),
+                       sta::MinMaxAll::all(),
+                       /*infer_latches=*/false);
+    }
+
+    odb::dbChip* chip = odb::dbChip::create(db.get());
+    odb::dbBlock* block = odb::dbBlock::create(chip, "top");
+    sta->getDbNetwork()->setBlock(block);
+    block->setDieArea(odb::Rect(0, 0, 200000, 200000));
+    sta->postReadDef(block);
+
+    odb::dbMaster* flop_master = db->findMaster("DFFHQNx1_ASAP7_75t_L");
+    odb::dbNet* clk = odb::dbNet::create(block, "clk");
+    clk->setSigType(odb::dbSigType::CLOCK);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, 190000);
+    for (int i = 0; i < num_flops; i++) {
+      const std::string name = "ff" + std::to_string(i);
+      odb::dbInst* flop = odb::dbInst::create(block, flop_master, name.c_str());
+      flop->setLocation(coord(rng), coord(rng));
+      flop->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+      flop->findITerm("CLK")->connect(clk);
+    }
+
+    MBFF mbff(db.get(), sta.get(), &logger, threads, 20, 0);
+    mbff.Run(max_split_size, 40.0, 1.0);
+
+    std::vector<InstPlacement> placements;
+    for (odb::dbInst* inst : block->getInsts()) {
+      const odb::Point origin = inst->getOrigin();
+      placements.emplace_back(inst->getName(),
+                              inst->getMaster()->getName(),
+                              origin.x(),
+                              origin.y());
+    }
+    std::sort(placements.begin(), placements.end());
+    return placements;
+  }
+};
+
+// 240 flops with a max split size of 4 are more than tile_scale_ * 4, so the
+// flops are decomposed in tiles.
+TEST_F(MbffTest, TiledClusteringKeepsEveryFlop)
+{
+  const std::vector<InstPlacement> placements = clusterFlops(240, 4, 1);
+  int bits = 0;
+  std::map<int, int> trays;
+  for (const InstPlacement& placement : placements) {
+    const int bit_count = bitCount(std::get<1>(placement));
+    bits += bit_count;
+    trays[bit_count]++;
+  }
+  EXPECT_EQ(bits, 240);
+  EXPECT_LT(static_cast<int>(placements.size()), 240);
+  EXPECT_GT(trays[2] + trays[4], 0);
+}
+
+TEST_F(MbffTest, TiledClusteringIsStableAcrossThreads)
+{
+  const std::vector<InstPlacement> serial = clusterFlops(240, 4, 1);
+  EXPECT_EQ(serial, clusterFlops(240, 4, 4));
+  EXPECT_EQ(serial, clusterFlops(240, 4, 8));
+}
+
+}  // namespace
+
+}  // namespace gpl
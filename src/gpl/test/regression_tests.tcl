@@ -24,6 +24,7 @@ record_tests {
   incremental01
   incremental02
   error01
+  error02
   diverge01
   density01
   convergence01
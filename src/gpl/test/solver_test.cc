@@ -0,0 +1,97 @@
+#include "src/gpl/src/solver.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+
+namespace gpl {
+namespace {
+
+const int num_cells = 50;
+
+// The B2B system of a row of cells chained by two pin nets, with a fixed
+// pin at 0 and one at num_cells + 1. Cell i settles at i + 1.
+void makeChain(SMatrix& matrix, Eigen::VectorXf& fixed_force)
+{
+  std::vector<Eigen::Triplet<float>> list;
+  for (int i = 0; i < num_cells; i++) {
+    list.emplace_back(i, i, 2.0f);
+    if (i > 0) {
+      list.emplace_back(i, i - 1, -1.0f);
+    }
+    if (i < num_cells - 1) {
+      list.emplace_back(i, i + 1, -1.0f);
+    }
+  }
+  matrix.resize(num_cells, num_cells);
+  matrix.setFromTriplets(list.begin(), list.end());
+  fixed_force = Eigen::VectorXf::Zero(num_cells);
+  fixed_force[num_cells - 1] = num_cells + 1;
+}
+
+ResidualError solveChain(const InitialPlaceSolver solver_type,
+                         const int threads,
+                         Eigen::VectorXf& loc_x,
+                         Eigen::VectorXf& loc_y)
+{
+  utl::Logger logger;
+  SMatrix matrix_x, matrix_y;
+  Eigen::VectorXf fixed_x, fixed_y;
+  makeChain(matrix_x, fixed_x);
+  makeChain(matrix_y, fixed_y);
+  loc_x = Eigen::VectorXf::Zero(num_cells);
+  loc_y = Eigen::VectorXf::Zero(num_cells);
+  return cpuSparseSolve(200,
+                        solver_type,
+                        threads,
+                        matrix_x,
+                        fixed_x,
+                        loc_x,
+                        matrix_y,
+                        fixed_y,
+                        loc_y,
+                        &logger);
+}
+
+void expectChainSolved(const Eigen::VectorXf& loc)
+{
+  for (int i = 0; i < num_cells; i++) {
+    EXPECT_NEAR(loc[i], i + 1, 1e-2);
+  }
+}
+
+TEST(SolverTest, ConjugateGradientSolvesChain)
+{
+  for (const int threads : {1, 4}) {
+    Eigen::VectorXf loc_x, loc_y;
+    const ResidualError error
+        = solveChain(InitialPlaceSolver::CG, threads, loc_x, loc_y);
+    EXPECT_LT(error.x, 1e-4);
+    EXPECT_LT(error.y, 1e-4);
+    expectChainSolved(loc_x);
+    expectChainSolved(loc_y);
+  }
+}
+
+TEST(SolverTest, ConjugateGradientMatchesBiCGSTAB)
+{
+  Eigen::VectorXf cg_x, cg_y, bicgstab_x, bicgstab_y;
+  solveChain(InitialPlaceSolver::CG, 4, cg_x, cg_y);
+  solveChain(InitialPlaceSolver::BiCGSTAB, 4, bicgstab_x, bicgstab_y);
+  for (int i = 0; i < num_cells; i++) {
+    EXPECT_NEAR(cg_x[i], bicgstab_x[i], 1e-2);
+    EXPECT_NEAR(cg_y[i], bicgstab_y[i], 1e-2);
+  }
+}
+
+TEST(SolverTest, RestoresEigenThreads)
+{
+  Eigen::setNbThreads(3);
+  Eigen::VectorXf loc_x, loc_y;
+  solveChain(InitialPlaceSolver::CG, 8, loc_x, loc_y);
+  EXPECT_EQ(Eigen::nbThreads(), 3);
+}
+
+}  // namespace
+}  // namespace gpl
@@ -44,6 +44,7 @@
 #include <vector>
 
 #include "GRoute.h"
+#include "IncrementalStats.h"
 #include "RoutePt.h"
 #include "ant/AntennaChecker.hh"
 #include "odb/db.h"
@@ -177,6 +178,7 @@ class GlobalRouter : public ant::GlobalRouteSource
                            int layer,
                            float reduction_percentage);
   void setVerbose(const bool v);
+  void setNumThreads(int num_threads);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* file_name);
@@ -411,6 +413,8 @@ class GlobalRouter : public ant::GlobalRouteSource
   std::vector<Net*> updateDirtyRoutes(bool save_guides = false);
   void mergeResults(NetRouteMap& routes);
   void updateDirtyNets(std::vector<Net*>& dirty_nets);
+  void beginIncrementalSession();
+  void endIncrementalSession();
   void shrinkNetRoute(odb::dbNet* db_net);
   void deleteSegment(Net* net, GRoute& segments, int seg_id);
   void destroyNetWire(Net* net);
@@ -489,6 +493,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   std::vector<RegionAdjustment> region_adjustments_;
 
   bool verbose_;
+  int num_threads_;
   int min_layer_for_clock_;
   int max_layer_for_clock_;
 
@@ -518,6 +523,10 @@ class GlobalRouter : public ant::GlobalRouteSource
 
   // incremental grt
   GRouteDbCbk* grouter_cbk_;
+  // Runtime of the last full global_route including its grid and netlist
+  // setup, zero until one has run.
+  double full_route_seconds_;
+  IncrementalStats incr_stats_;
 
   friend class IncrementalGRoute;
   friend class GRouteDbCbk;
@@ -68,6 +68,23 @@ class Rudy
    * */
   void calculateRudy();
 
+  /**
+   * Brings the map up to date by only recomputing the tiles under the
+   * old and new terminal bounding boxes of the nets that changed since the
+   * last call. Those tiles are summed again over all nets in block order,
+   * so the map is identical to `calculateRudy`. Falls back to
+   * `calculateRudy` on the first call, when the net list or the resource
+   * reductions changed, or when too many nets moved for the incremental
+   * update to pay off.
+   * */
+  void updateRudy();
+
+  /**
+   * Set the number of threads used to compute the net bounding boxes and
+   * to accumulate the tiles. Results do not depend on the thread count.
+   * */
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+
   /**
    * Set the grid area and grid numbers.
    * Default value will be the die area of block and (40, 40), respectively.
@@ -79,7 +96,11 @@ class Rudy
    * If the layer which name is metal1 and it has getWidth value, then this
    * function will not applied, but it will apply that information.
    * */
-  void setWireWidth(int wire_width) { wire_width_ = wire_width; }
+  void setWireWidth(int wire_width)
+  {
+    wire_width_ = wire_width;
+    rudy_valid_ = false;
+  }
 
   const Tile& getTile(int x, int y) const { return grid_.at(x).at(y); }
   std::pair<int, int> getGridSize() const;
@@ -90,9 +111,23 @@ class Rudy
    * \pre This function should be called after `setGridConfig`
    * */
   void makeGrid();
-  void getResourceReductions();
+  void getResourceReductions(std::vector<float>& reductions);
+  void applyResourceReductions();
   Tile& getEditableTile(int x, int y) { return grid_.at(x).at(y); }
-  void processIntersectionSignalNet(odb::Rect net_rect);
+  // Returns true when the net list differs from the cached one.
+  bool collectNets();
+  void updateNetBoxes(std::vector<odb::Rect>& net_boxes);
+  // Clears the tiles and accumulates the reductions and net_boxes_.
+  void accumulateRudy();
+  int getNumBands() const;
+  // Marks the tiles under net_rect in dirty, indexed like reductions_.
+  void markTiles(odb::Rect net_rect, std::vector<bool>& dirty) const;
+  // Adds the net to the tiles of columns [x_begin, x_end), or only to the
+  // dirty ones when dirty is given.
+  void processIntersectionSignalNet(odb::Rect net_rect,
+                                    int x_begin,
+                                    int x_end,
+                                    const std::vector<bool>* dirty = nullptr);
 
   odb::dbBlock* block_;
   odb::Rect grid_block_;
@@ -101,7 +136,15 @@ class Rudy
   int tile_cnt_y_ = 40;
   int wire_width_ = 100;
   int tile_size_ = 0;
+  int num_threads_ = 1;
   std::vector<std::vector<Tile>> grid_;
+  // Resource reduction per tile, indexed by x * tile_cnt_y_ + y.
+  std::vector<float> reductions_;
+  // Nets and their cached terminal bounding boxes, in block order. Supply
+  // nets keep an empty box so they never contribute.
+  std::vector<odb::dbNet*> nets_;
+  std::vector<odb::Rect> net_boxes_;
+  bool rudy_valid_ = false;
 };
 
 }  // namespace grt
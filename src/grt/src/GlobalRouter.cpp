@@ -73,6 +73,8 @@
 #include "sta/Set.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
+#include "utl/timer.h"
 #include "utl/algorithms.h"
 
 namespace grt {
@@ -101,6 +103,7 @@ GlobalRouter::GlobalRouter()
       initialized_(false),
       total_diodes_count_(0),
       verbose_(false),
+      num_threads_(1),
       min_layer_for_clock_(-1),
       max_layer_for_clock_(-2),
       seed_(0),
@@ -114,7 +117,8 @@ GlobalRouter::GlobalRouter()
       heatmap_(nullptr),
       heatmap_rudy_(nullptr),
       congestion_file_name_(nullptr),
-      grouter_cbk_(nullptr)
+      grouter_cbk_(nullptr),
+      full_route_seconds_(0.0)
 {
 }
 
@@ -278,6 +282,7 @@ void GlobalRouter::globalRoute(bool save_guides,
                   "(with at least 2 terms)");
     return;
   }
+  utl::TraceZone zone("grt.global_route");
   if (start_incremental && end_incremental) {
     logger_->error(GRT,
                    251,
@@ -286,6 +291,7 @@ void GlobalRouter::globalRoute(bool save_guides,
   } else if (start_incremental) {
     grouter_cbk_ = new GRouteDbCbk(this);
     grouter_cbk_->addOwner(block_);
+    beginIncrementalSession();
   } else {
     try {
       if (end_incremental) {
@@ -293,7 +299,9 @@ void GlobalRouter::globalRoute(bool save_guides,
         grouter_cbk_->removeOwner();
         delete grouter_cbk_;
         grouter_cbk_ = nullptr;
+        endIncrementalSession();
       } else {
+        utl::Timer route_timer;
         clear();
         block_ = db_->getChip()->getBlock();
 
@@ -307,6 +315,7 @@ void GlobalRouter::globalRoute(bool save_guides,
         }
 
         routes_ = findRouting(nets, min_layer, max_layer);
+        full_route_seconds_ = route_timer.elapsed();
       }
     } catch (...) {
       updateDbCongestion();
@@ -347,6 +356,7 @@ void GlobalRouter::repairAntennas(odb::dbMTerm* diode_mterm,
                                   float ratio_margin,
                                   const int num_threads)
 {
+  utl::TraceZone zone("grt.repair_antennas");
   if (!initialized_ || haveDetailedRoutes()) {
     int min_layer, max_layer;
     getMinMaxLayer(min_layer, max_layer);
@@ -393,7 +403,7 @@ void GlobalRouter::repairAntennas(odb::dbMTerm* diode_mterm,
                                                           num_threads);
     if (violations) {
       IncrementalGRoute incr_groute(this, block_);
-      repair_antennas_->repairAntennas(diode_mterm);
+      repair_antennas_->repairAntennas(diode_mterm, num_threads);
       total_diodes_count_ += repair_antennas_->getDiodesCount();
       logger_->info(
           GRT, 15, "Inserted {} diodes.", repair_antennas_->getDiodesCount());
@@ -466,13 +476,7 @@ void GlobalRouter::estimateRC(rsz::SpefWriter* spef_writer)
 
   MakeWireParasitics builder(
       logger_, resizer_, sta_, db_->getTech(), block_, this);
-
-  for (auto& [db_net, route] : routes_) {
-    if (!route.empty()) {
-      Net* net = getNet(db_net);
-      builder.estimateParasitcs(db_net, net->getPins(), route, spef_writer);
-    }
-  }
+  builder.estimateParasitcs(routes_, num_threads_, spef_writer);
 }
 
 void GlobalRouter::estimateRC(odb::dbNet* db_net)
@@ -605,9 +609,13 @@ void GlobalRouter::setPerturbationAmount(int perturbation)
 
 void GlobalRouter::updateDirtyNets(std::vector<Net*>& dirty_nets)
 {
-  int min_layer, max_layer;
-  getMinMaxLayer(min_layer, max_layer);
-  initRoutingLayers(min_layer, max_layer);
+  // The routing layers only change with a full initialization, so the
+  // incremental updates reuse them.
+  if (routing_layers_.empty()) {
+    int min_layer, max_layer;
+    getMinMaxLayer(min_layer, max_layer);
+    initRoutingLayers(min_layer, max_layer);
+  }
   for (odb::dbNet* db_net : dirty_nets_) {
     Net* net = db_net_map_[db_net];
     net->destroyPins();
@@ -1722,6 +1730,11 @@ void GlobalRouter::setVerbose(const bool v)
   verbose_ = v;
 }
 
+void GlobalRouter::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void GlobalRouter::setOverflowIterations(int iterations)
 {
   overflow_iterations_ = iterations;
@@ -1838,6 +1851,7 @@ void GlobalRouter::ensureLayerForGuideDimension(int max_routing_layer)
 void GlobalRouter::configFastRoute()
 {
   fastroute_->setVerbose(verbose_);
+  fastroute_->setNumThreads(num_threads_);
   fastroute_->setOverflowIterations(overflow_iterations_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
 
@@ -4440,10 +4454,10 @@ void GlobalRouter::reportNetDetailedRouteWL(odb::dbWire* wire,
 {
   std::vector<int64_t> lengths;
   lengths.resize(db_->getTech()->getRoutingLayerCount() + 1);
-  odb::dbWireShapeItr shapes;
-  odb::dbShape s;
+  std::vector<odb::dbShape> shapes;
+  wire->getShapes(shapes);
   int via_count = 0;
-  for (shapes.begin(wire); shapes.next(s);) {
+  for (const odb::dbShape& s : shapes) {
     if (!s.isVia()) {
       lengths[s.getTechLayer()->getRoutingLevel()] += s.getLength();
     } else {
@@ -4560,6 +4574,7 @@ IncrementalGRoute::IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block)
     : groute_(groute), db_cbk_(groute)
 {
   db_cbk_.addOwner(block);
+  groute_->beginIncrementalSession();
 }
 
 std::vector<Net*> IncrementalGRoute::updateRoutes(bool save_guides)
@@ -4570,6 +4585,7 @@ std::vector<Net*> IncrementalGRoute::updateRoutes(bool save_guides)
 IncrementalGRoute::~IncrementalGRoute()
 {
   db_cbk_.removeOwner();
+  groute_->endIncrementalSession();
 }
 
 void GlobalRouter::setRenderer(
@@ -4593,6 +4609,7 @@ std::vector<Net*> GlobalRouter::updateDirtyRoutes(bool save_guides)
 {
   std::vector<Net*> dirty_nets;
   if (!dirty_nets_.empty()) {
+    utl::Timer update_timer;
     fastroute_->setVerbose(false);
 
     updateDirtyNets(dirty_nets);
@@ -4625,17 +4642,35 @@ std::vector<Net*> GlobalRouter::updateDirtyRoutes(bool save_guides)
     if (fastroute_->has2Doverflow() && !allow_congestion_) {
       // The maximum number of times that the nets traversing the congestion
       // area will be added
-      int add_max = 30;
+      const int max_congestion_rounds = 30;
+      int add_max = max_congestion_rounds;
       // The set will contain the nets for routing
       std::set<odb::dbNet*> congestion_nets;
       // The dirty nets that could not be routed are added
       for (auto& it : dirty_nets) {
         congestion_nets.insert(it->getDbNet());
       }
+      int last_overflow = fastroute_->totalOverflow();
       while (fastroute_->has2Doverflow() && reroutingOverflow && add_max >= 0) {
         // The nets that cross the congestion area are obtained and added to
         // the set
+        const size_t last_net_count = congestion_nets.size();
         fastroute_->getCongestionNets(congestion_nets);
+        // Once the congestion area stops growing and rerouting it no longer
+        // lowers the overflow, more rounds over the same nets do not help,
+        // so go straight to legalizing the inserted buffers.
+        if (add_max > 0 && add_max < max_congestion_rounds
+            && congestion_nets.size() == last_net_count
+            && fastroute_->totalOverflow() >= last_overflow) {
+          debugPrint(logger_,
+                     GRT,
+                     "incr",
+                     1,
+                     "Congestion area stopped growing with {} rounds left.",
+                     add_max);
+          add_max = 0;
+        }
+        last_overflow = fastroute_->totalOverflow();
         // When every attempt to increase the congestion region failed, try
         // legalizing the buffers inserted
         if (add_max == 0) {
@@ -4670,11 +4705,59 @@ std::vector<Net*> GlobalRouter::updateDirtyRoutes(bool save_guides)
     if (save_guides) {
       saveGuides();
     }
+
+    incr_stats_.recordUpdate(dirty_nets.size(), update_timer.elapsed());
   }
 
   return dirty_nets;
 }
 
+void GlobalRouter::beginIncrementalSession()
+{
+  incr_stats_.beginSession();
+}
+
+void GlobalRouter::endIncrementalSession()
+{
+  const IncrementalStats::Session session = incr_stats_.endSession();
+  if (session.updates == 0) {
+    return;
+  }
+
+  if (verbose_) {
+    logger_->info(GRT,
+                  269,
+                  "Incremental routing rerouted {} nets in {} updates in "
+                  "{:.2f}s.",
+                  session.rerouted_nets,
+                  session.updates,
+                  session.seconds);
+  }
+  // Both times are measured: the session against the last full
+  // global_route, setup included, repeated once per update.
+  if (full_route_seconds_ > 0.0) {
+    const double full_seconds = full_route_seconds_ * session.updates;
+    if (verbose_) {
+      logger_->info(GRT,
+                    270,
+                    "Full global routes for these updates would take {:.2f}s "
+                    "({:.2f}s each), {:.2f}s saved.",
+                    full_seconds,
+                    full_route_seconds_,
+                    full_seconds - session.seconds);
+    }
+  }
+  debugPrint(logger_,
+             GRT,
+             "incr",
+             1,
+             "{} updates rerouted {} nets in {:.2f}s; last full route {:.2f}s.",
+             session.updates,
+             session.rerouted_nets,
+             session.seconds,
+             full_route_seconds_);
+}
+
 void GlobalRouter::initFastRouteIncr(std::vector<Net*>& nets)
 {
   initNetlist(nets);
@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, Precision Innovations Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "grt/IncrementalStats.h"
+
+namespace grt {
+
+void IncrementalStats::beginSession()
+{
+  sessions_.emplace_back();
+}
+
+IncrementalStats::Session IncrementalStats::endSession()
+{
+  if (sessions_.empty()) {
+    return Session();
+  }
+
+  const Session session = sessions_.back();
+  sessions_.pop_back();
+  if (!sessions_.empty()) {
+    Session& parent = sessions_.back();
+    parent.updates += session.updates;
+    parent.rerouted_nets += session.rerouted_nets;
+    parent.seconds += session.seconds;
+  }
+  return session;
+}
+
+void IncrementalStats::recordUpdate(const int rerouted_nets,
+                                    const double seconds)
+{
+  if (sessions_.empty()) {
+    return;
+  }
+
+  Session& session = sessions_.back();
+  session.updates++;
+  session.rerouted_nets += rerouted_nets;
+  session.seconds += seconds;
+}
+
+}  // namespace grt
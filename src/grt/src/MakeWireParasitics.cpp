@@ -95,6 +95,7 @@ void MakeWireParasitics::estimateParasitcs(odb::dbNet* net,
     }
   }
 
+  initLayerRC();
   sta::Net* sta_net = network_->dbToSta(net);
 
   for (sta::Corner* corner : *sta_->corners()) {
@@ -118,6 +119,244 @@ void MakeWireParasitics::estimateParasitcs(odb::dbNet* net,
   parasitics_->deleteParasiticNetworks(sta_net);
 }
 
+void MakeWireParasitics::estimateParasitcs(NetRouteMap& routes,
+                                           int num_threads,
+                                           rsz::SpefWriter* spef_writer)
+{
+  std::vector<NetRC> net_rcs;
+  for (auto& [db_net, route] : routes) {
+    if (!route.empty()) {
+      net_rcs.push_back({db_net, grouter_->getNet(db_net), &route, 0, {}, {}});
+    }
+  }
+
+  // The debug reports are written while the parasitics are made, so keep
+  // them in the per net flow. On one thread there is nothing to gain from
+  // computing the RC networks ahead, and the per net flow is the reference
+  // the threaded estimation is compared with.
+  if (num_threads <= 1 || logger_->debugCheck(GRT, "est_rc", 1)) {
+    for (NetRC& net_rc : net_rcs) {
+      estimateParasitcs(net_rc.db_net,
+                        net_rc.net->getPins(),
+                        *net_rc.route,
+                        spef_writer);
+    }
+    return;
+  }
+
+  std::vector<sta::Corner*> corners;
+  for (sta::Corner* corner : *sta_->corners()) {
+    corners.push_back(corner);
+  }
+  initLayerRC();
+
+  // Compute the RC networks of a chunk of nets in parallel, then add them
+  // to the STA parasitics in route order. The parasitics and the
+  // reduction are not thread safe.
+  const int num_nets = net_rcs.size();
+  const int chunk_size = 1024;
+  for (int chunk_begin = 0; chunk_begin < num_nets;
+       chunk_begin += chunk_size) {
+    const int chunk_end = std::min(chunk_begin + chunk_size, num_nets);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 16)
+    for (int i = chunk_begin; i < chunk_end; i++) {
+      computeNetRC(net_rcs[i]);
+    }
+    for (int i = chunk_begin; i < chunk_end; i++) {
+      makeNetParasitics(net_rcs[i], corners, spef_writer);
+      // Release the RC network once it is in the parasitics.
+      net_rcs[i].wires.clear();
+      net_rcs[i].pins.clear();
+    }
+  }
+}
+
+// Cache the wire RC of the routing layers and the resistance of the cut
+// layers below and above them, indexed by corner and routing layer.
+void MakeWireParasitics::initLayerRC()
+{
+  if (!r_per_meter_.empty()) {
+    return;
+  }
+  const int num_corners = sta_->corners()->count();
+  const int num_layers = tech_->getRoutingLayerCount();
+  r_per_meter_.assign(num_corners, std::vector<double>(num_layers + 1));
+  cap_per_meter_.assign(num_corners, std::vector<double>(num_layers + 1));
+  lower_cut_res_.assign(num_corners, std::vector<float>(num_layers + 1));
+  upper_cut_res_.assign(num_corners, std::vector<float>(num_layers + 1));
+  for (sta::Corner* corner : *sta_->corners()) {
+    const int c = corner->index();
+    for (int layer_id = 1; layer_id <= num_layers; layer_id++) {
+      odb::dbTechLayer* layer = tech_->findRoutingLayer(layer_id);
+      double r_per_meter = 0.0;    // ohm/meter
+      double cap_per_meter = 0.0;  // F/meter
+      resizer_->layerRC(layer, corner, r_per_meter, cap_per_meter);
+
+      const float layer_width = block_->dbuToMicrons(layer->getWidth());
+      if (r_per_meter == 0.0) {
+        const float res_ohm_per_micron = layer->getResistance() / layer_width;
+        r_per_meter = 1E+6 * res_ohm_per_micron;  // ohm/meter
+      }
+
+      if (cap_per_meter == 0.0) {
+        const float cap_pf_per_micron = layer_width * layer->getCapacitance()
+                                        + 2 * layer->getEdgeCapacitance();
+        cap_per_meter = 1E+6 * 1E-12 * cap_pf_per_micron;  // F/meter
+      }
+      r_per_meter_[c][layer_id] = r_per_meter;
+      cap_per_meter_[c][layer_id] = cap_per_meter;
+
+      odb::dbTechLayer* lower_cut = layer->getLowerLayer();
+      if (lower_cut) {
+        lower_cut_res_[c][layer_id] = getCutLayerRes(lower_cut, corner);
+      }
+      odb::dbTechLayer* upper_cut = layer->getUpperLayer();
+      if (upper_cut) {
+        upper_cut_res_[c][layer_id] = getCutLayerRes(upper_cut, corner);
+      }
+    }
+  }
+}
+
+// Build the same network as makeRouteParasitics and makeParasiticsToPins
+// with node indices instead of parasitic nodes.
+void MakeWireParasitics::computeNetRC(NetRC& net_rc) const
+{
+  const int min_routing_layer = grouter_->getMinRoutingLayer();
+  const int num_corners = r_per_meter_.size();
+
+  std::map<RoutePt, int> node_map;
+  auto ensure_node = [&node_map](int x, int y, int layer) {
+    return node_map.emplace(RoutePt(x, y, layer), node_map.size())
+        .first->second;
+  };
+
+  net_rc.wires.assign(num_corners, {});
+  for (GSegment& segment : *net_rc.route) {
+    const int init_layer = segment.init_layer;
+    const int n1
+        = (init_layer >= min_routing_layer)
+              ? ensure_node(segment.init_x, segment.init_y, init_layer)
+              : -1;
+    const int final_layer = segment.final_layer;
+    const int n2
+        = (final_layer >= min_routing_layer)
+              ? ensure_node(segment.final_x, segment.final_y, final_layer)
+              : -1;
+    if (n1 < 0 || n2 < 0) {
+      continue;
+    }
+
+    const int wire_length_dbu = segment.length();
+    for (int c = 0; c < num_corners; c++) {
+      WireRC wire{n1, n2, 0.0, 0.0, true};
+      if (wire_length_dbu == 0) {
+        // via
+        wire.res = upper_cut_res_[c][min(init_layer, final_layer)];
+      } else if (init_layer == final_layer) {
+        layerRC(wire_length_dbu, init_layer, c, wire.res, wire.cap);
+      } else {
+        wire.is_wire_or_via = false;
+      }
+      net_rc.wires[c].push_back(wire);
+    }
+  }
+  net_rc.num_nodes = node_map.size();
+
+  net_rc.pins.assign(num_corners, {});
+  for (Pin& pin : net_rc.net->getPins()) {
+    const odb::Point pt = pin.getPosition();
+    const odb::Point grid_pt = pin.getOnGridPosition();
+
+    // Use the route layer above the pin layer if there is a via
+    // to the pin, otherwise use the pin layer.
+    int layer = pin.getConnectionLayer() + 1;
+    auto node_itr
+        = node_map.find(RoutePt(grid_pt.getX(), grid_pt.getY(), layer));
+    bool has_via = true;
+    if (node_itr == node_map.end()) {
+      layer--;
+      has_via = false;
+      node_itr
+          = node_map.find(RoutePt(grid_pt.getX(), grid_pt.getY(), layer));
+    }
+
+    const int wire_length_dbu
+        = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
+    for (int c = 0; c < num_corners; c++) {
+      PinRC pin_rc{&pin, -1, 0.0, 0.0};
+      if (node_itr != node_map.end()) {
+        pin_rc.grid_node = node_itr->second;
+        const float via_res = has_via ? lower_cut_res_[c][layer] : 0;
+        float res, cap;
+        layerRC(wire_length_dbu, layer, c, res, cap);
+        pin_rc.res = res + via_res;
+        pin_rc.cap = cap;
+      }
+      net_rc.pins[c].push_back(pin_rc);
+    }
+  }
+}
+
+void MakeWireParasitics::makeNetParasitics(
+    const NetRC& net_rc,
+    const std::vector<sta::Corner*>& corners,
+    rsz::SpefWriter* spef_writer)
+{
+  sta::Net* sta_net = network_->dbToSta(net_rc.db_net);
+
+  std::vector<sta::ParasiticNode*> nodes(net_rc.num_nodes);
+  for (int c = 0; c < corners.size(); c++) {
+    sta::Corner* corner = corners[c];
+    sta::ParasiticAnalysisPt* analysis_point
+        = corner->findParasiticAnalysisPt(min_max_);
+    sta::Parasitic* parasitic
+        = parasitics_->makeParasiticNetwork(sta_net, false, analysis_point);
+
+    // Node ids follow the first appearance of the route points, like the
+    // node_map in makeRouteParasitics.
+    for (int i = 0; i < net_rc.num_nodes; i++) {
+      nodes[i] = parasitics_->ensureParasiticNode(
+          parasitic, sta_net, i + 1, network_);
+    }
+
+    size_t wire_resistor_id = 1;
+    for (const WireRC& wire : net_rc.wires[c]) {
+      if (!wire.is_wire_or_via) {
+        reportNonWireRoute(net_rc.db_net);
+      }
+      sta::ParasiticNode* n1 = nodes[wire.node1];
+      sta::ParasiticNode* n2 = nodes[wire.node2];
+      parasitics_->incrCap(n1, wire.cap / 2.0);
+      parasitics_->makeResistor(
+          parasitic, wire_resistor_id++, wire.res, n1, n2);
+      parasitics_->incrCap(n2, wire.cap / 2.0);
+    }
+
+    for (const PinRC& pin_rc : net_rc.pins[c]) {
+      sta::ParasiticNode* pin_node = parasitics_->ensureParasiticNode(
+          parasitic, staPin(*pin_rc.pin), network_);
+      if (pin_rc.grid_node >= 0) {
+        sta::ParasiticNode* grid_node = nodes[pin_rc.grid_node];
+        parasitics_->incrCap(pin_node, pin_rc.cap / 2.0);
+        parasitics_->makeResistor(
+            parasitic, resistor_id_++, pin_rc.res, pin_node, grid_node);
+        parasitics_->incrCap(grid_node, pin_rc.cap / 2.0);
+      } else {
+        reportMissingRoute(*pin_rc.pin);
+      }
+    }
+
+    if (spef_writer) {
+      spef_writer->writeNet(corner, sta_net, parasitic);
+    }
+
+    arc_delay_calc_->reduceParasitic(
+        parasitic, sta_net, corner, sta::MinMaxAll::all());
+  }
+  parasitics_->deleteParasiticNetworks(sta_net);
+}
+
 void MakeWireParasitics::estimateParasitcs(odb::dbNet* net, GRoute& route)
 {
   debugPrint(logger_, GRT, "est_rc", 1, "net {}", net->getConstName());
@@ -135,6 +374,7 @@ void MakeWireParasitics::estimateParasitcs(odb::dbNet* net, GRoute& route)
     }
   }
 
+  initLayerRC();
   sta::Net* sta_net = network_->dbToSta(net);
   grt::Net* grt_net = grouter_->getNet(net);
 
@@ -216,10 +456,8 @@ void MakeWireParasitics::makeRouteParasitics(
     float cap = 0.0;
     if (wire_length_dbu == 0) {
       // via
-      int lower_layer = min(segment.init_layer, segment.final_layer);
-      odb::dbTechLayer* cut_layer
-          = tech_->findRoutingLayer(lower_layer)->getUpperLayer();
-      res = getCutLayerRes(cut_layer, corner);
+      const int lower_layer = min(segment.init_layer, segment.final_layer);
+      res = upper_cut_res_[corner->index()][lower_layer];
       debugPrint(logger_,
                  GRT,
                  "est_rc",
@@ -231,7 +469,8 @@ void MakeWireParasitics::makeRouteParasitics(
                  segment.final_layer,
                  units->resistanceUnit()->asString(res));
     } else if (segment.init_layer == segment.final_layer) {
-      layerRC(wire_length_dbu, segment.init_layer, corner, res, cap);
+      layerRC(
+          wire_length_dbu, segment.init_layer, corner->index(), res, cap);
       debugPrint(logger_,
                  GRT,
                  "est_rc",
@@ -244,10 +483,7 @@ void MakeWireParasitics::makeRouteParasitics(
                  units->resistanceUnit()->asString(res),
                  units->capacitanceUnit()->asString(cap));
     } else
-      logger_->warn(GRT,
-                    25,
-                    "Non wire or via route found on net {}.",
-                    net->getConstName());
+      reportNonWireRoute(net);
     parasitics_->incrCap(n1, cap / 2.0);
     parasitics_->makeResistor(parasitic, resistor_id_++, res, n1, n2);
     parasitics_->incrCap(n2, cap / 2.0);
@@ -294,9 +530,7 @@ void MakeWireParasitics::makeParasiticsToPin(
     grid_route = RoutePt(grid_pt.getX(), grid_pt.getY(), layer);
     grid_node = node_map[grid_route];
   } else {
-    odb::dbTechLayer* cut_layer
-        = tech_->findRoutingLayer(layer)->getLowerLayer();
-    via_res = getCutLayerRes(cut_layer, corner);
+    via_res = lower_cut_res_[corner->index()][layer];
   }
 
   if (grid_node) {
@@ -304,7 +538,7 @@ void MakeWireParasitics::makeParasiticsToPin(
     int wire_length_dbu
         = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
     float res, cap;
-    layerRC(wire_length_dbu, layer, corner, res, cap);
+    layerRC(wire_length_dbu, layer, corner->index(), res, cap);
     sta::Units* units = sta_->units();
     debugPrint(
         logger_,
@@ -342,7 +576,7 @@ void MakeWireParasitics::makeParasiticsToPin(
         parasitic, resistor_id_++, res + via_res, pin_node, grid_node);
     parasitics_->incrCap(grid_node, cap / 2.0);
   } else {
-    logger_->warn(GRT, 26, "Missing route to pin {}.", pin.getName());
+    reportMissingRoute(pin);
   }
 }
 
@@ -392,9 +626,7 @@ void MakeWireParasitics::makePartialParasiticsToPin(
     grid_route = RoutePt(grid_pt.getX(), grid_pt.getY(), layer);
     grid_node = node_map[grid_route];
   } else {
-    odb::dbTechLayer* cut_layer
-        = tech_->findRoutingLayer(layer)->getLowerLayer();
-    via_res = getCutLayerRes(cut_layer, corner);
+    via_res = lower_cut_res_[corner->index()][layer];
   }
 
   if (grid_node) {
@@ -402,7 +634,7 @@ void MakeWireParasitics::makePartialParasiticsToPin(
     int wire_length_dbu
         = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
     float res, cap;
-    layerRC(wire_length_dbu, layer, corner, res, cap);
+    layerRC(wire_length_dbu, layer, corner->index(), res, cap);
     sta::Units* units = sta_->units();
     debugPrint(
         logger_,
@@ -445,32 +677,26 @@ void MakeWireParasitics::makePartialParasiticsToPin(
 }
 
 void MakeWireParasitics::layerRC(int wire_length_dbu,
-                                 int layer_id,
-                                 sta::Corner* corner,
+                                 int layer,
+                                 int corner_idx,
                                  // Return values.
                                  float& res,
                                  float& cap) const
 {
-  odb::dbTechLayer* layer = tech_->findRoutingLayer(layer_id);
-  double r_per_meter = 0.0;    // ohm/meter
-  double cap_per_meter = 0.0;  // F/meter
-  resizer_->layerRC(layer, corner, r_per_meter, cap_per_meter);
-
-  const float layer_width = block_->dbuToMicrons(layer->getWidth());
-  if (r_per_meter == 0.0) {
-    const float res_ohm_per_micron = layer->getResistance() / layer_width;
-    r_per_meter = 1E+6 * res_ohm_per_micron;  // ohm/meter
-  }
+  const float wire_length = dbuToMeters(wire_length_dbu);
+  res = r_per_meter_[corner_idx][layer] * wire_length;
+  cap = cap_per_meter_[corner_idx][layer] * wire_length;
+}
 
-  if (cap_per_meter == 0.0) {
-    const float cap_pf_per_micron = layer_width * layer->getCapacitance()
-                                    + 2 * layer->getEdgeCapacitance();
-    cap_per_meter = 1E+6 * 1E-12 * cap_pf_per_micron;  // F/meter
-  }
+void MakeWireParasitics::reportNonWireRoute(odb::dbNet* net) const
+{
+  logger_->warn(
+      GRT, 25, "Non wire or via route found on net {}.", net->getConstName());
+}
 
-  const float wire_length = dbuToMeters(wire_length_dbu);
-  res = r_per_meter * wire_length;
-  cap = cap_per_meter * wire_length;
+void MakeWireParasitics::reportMissingRoute(const Pin& pin) const
+{
+  logger_->warn(GRT, 26, "Missing route to pin {}.", pin.getName());
 }
 
 double MakeWireParasitics::dbuToMeters(int dbu) const
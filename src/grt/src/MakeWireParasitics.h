@@ -84,6 +84,13 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
                          GRoute& route,
                          rsz::SpefWriter* spef_writer = nullptr);
   void estimateParasitcs(odb::dbNet* net, GRoute& route) override;
+  // Estimate the parasitics of every routed net. The RC networks are
+  // computed on num_threads threads and added to the STA parasitics in
+  // route order, so the parasitics and the SPEF output match the serial
+  // estimation.
+  void estimateParasitcs(NetRouteMap& routes,
+                         int num_threads,
+                         rsz::SpefWriter* spef_writer = nullptr);
 
   void clearParasitics() override;
   // Return GRT layer lengths in dbu's for db_net's route indexed by routing
@@ -95,6 +102,45 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
  private:
   typedef std::map<RoutePt, sta::ParasiticNode*> NodeRoutePtMap;
 
+  // Resistor between two route nodes, indexed in creation order. A
+  // negative index marks a node below the min routing layer, in which case
+  // the resistor is skipped like in makeRouteParasitics.
+  struct WireRC
+  {
+    int node1;
+    int node2;
+    float res;
+    float cap;
+    bool is_wire_or_via;
+  };
+
+  // Resistor from a pin to its grid node, or a missing route when
+  // grid_node is negative.
+  struct PinRC
+  {
+    Pin* pin;
+    int grid_node;
+    float res;
+    float cap;
+  };
+
+  // RC network of one net for every corner, built without touching STA.
+  struct NetRC
+  {
+    odb::dbNet* db_net;
+    Net* net;
+    GRoute* route;
+    int num_nodes;
+    std::vector<std::vector<WireRC>> wires;
+    std::vector<std::vector<PinRC>> pins;
+  };
+
+  void initLayerRC();
+  void computeNetRC(NetRC& net_rc) const;
+  void makeNetParasitics(const NetRC& net_rc,
+                         const std::vector<sta::Corner*>& corners,
+                         rsz::SpefWriter* spef_writer);
+
   sta::Pin* staPin(Pin& pin) const;
   void makeRouteParasitics(odb::dbNet* net,
                            GRoute& route,
@@ -131,15 +177,18 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
                                   sta::ParasiticAnalysisPt* analysis_point,
                                   sta::Parasitic* parasitic,
                                   odb::dbNet* net);
+  // Wire RC from the cached layer tables; initLayerRC must be called first.
   void layerRC(int wire_length_dbu,
                int layer,
-               sta::Corner* corner,
+               int corner_idx,
                // Return values.
                float& res,
                float& cap) const;
   float getCutLayerRes(odb::dbTechLayer* cut_layer,
                        sta::Corner* corner,
                        int num_cuts = 1) const;
+  void reportNonWireRoute(odb::dbNet* net) const;
+  void reportMissingRoute(const Pin& pin) const;
   double dbuToMeters(int dbu) const;
 
   // Variables common to all nets.
@@ -154,6 +203,13 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
   sta::ArcDelayCalc* arc_delay_calc_;
   sta::MinMax* min_max_;
   size_t resistor_id_;
+
+  // Per corner and routing layer wire RC, and resistance of the cut layers
+  // below and above the routing layer.
+  std::vector<std::vector<double>> r_per_meter_;
+  std::vector<std::vector<double>> cap_per_meter_;
+  std::vector<std::vector<float>> lower_cut_res_;
+  std::vector<std::vector<float>> upper_cut_res_;
 };
 
 }  // namespace grt
@@ -38,6 +38,7 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <string>
@@ -444,7 +445,8 @@ void RepairAntennas::destroyNetWires(
   }
 }
 
-void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
+void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm,
+                                    const int num_threads)
 {
   int site_width = -1;
   r_tree fixed_insts;
@@ -478,6 +480,9 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
   setDiodesAndGatesPlacementStatus(odb::dbPlacementStatus::FIRM);
   getFixedInstances(fixed_insts);
 
+  // Diode instances are created serially in violation order so that names
+  // stay deterministic, then their locations are planned concurrently.
+  std::vector<DiodeInsertion> insertions;
   bool repair_failures = false;
   for (auto const& net_violations : antenna_violations_) {
     odb::dbNet* db_net = net_violations.first;
@@ -497,12 +502,8 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
           for (int j = 0; j < violation.diode_count_per_gate; j++) {
             odb::dbTechLayer* violation_layer
                 = tech->findRoutingLayer(violation.routing_level);
-            insertDiode(db_net,
-                        diode_mterm,
-                        gate,
-                        site_width,
-                        fixed_insts,
-                        violation_layer);
+            insertions.push_back(makeDiodeInsertion(
+                db_net, diode_mterm, gate, site_width, violation_layer));
             inserted_diodes = true;
           }
         }
@@ -516,6 +517,11 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
     logger_->warn(GRT, 243, "Unable to repair antennas on net with diodes.");
   }
 
+  placeDiodes(insertions, fixed_insts, num_threads);
+  for (const DiodeInsertion& insertion : insertions) {
+    commitDiode(insertion, diode_mterm);
+  }
+
   if (illegal_diode_placement_count_ > 0) {
     debugPrint(logger_,
                GRT,
@@ -534,42 +540,215 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
 
 void RepairAntennas::legalizePlacedCells()
 {
-  opendp_->detailedPlacement(0, 0, "");
+  if (!diode_insts_.empty()) {
+    // Only the new diodes and the cells near them can need legalizing, so
+    // every other placed cell is held in place while the detailed placer
+    // runs instead of legalizing the whole design.
+    std::vector<odb::dbInst*> insts_to_restore;
+    holdCellsAwayFromDiodes(insts_to_restore);
+    opendp_->detailedPlacement(0, 0, "");
+    for (odb::dbInst* inst : insts_to_restore) {
+      inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+    }
+  }
   // After legalize placement, diodes and violated insts don't need to be FIRM
   setDiodesAndGatesPlacementStatus(odb::dbPlacementStatus::PLACED);
 }
 
-void RepairAntennas::insertDiode(odb::dbNet* net,
-                                 odb::dbMTerm* diode_mterm,
-                                 odb::dbITerm* gate,
-                                 int site_width,
-                                 r_tree& fixed_insts,
-                                 odb::dbTechLayer* violation_layer)
+void RepairAntennas::holdCellsAwayFromDiodes(
+    std::vector<odb::dbInst*>& held_insts)
 {
+  // Cells within this many diode heights (rows) of a diode may move.
+  const int window_rows = 2;
+  r_tree windows;
+  const std::unordered_set<odb::dbInst*> diodes(diode_insts_.begin(),
+                                                diode_insts_.end());
+  for (odb::dbInst* diode_inst : diode_insts_) {
+    const odb::Rect diode_rect = diode_inst->getBBox()->getBox();
+    const int margin = diode_rect.dy() * window_rows;
+    box window(point(diode_rect.xMin() - margin, diode_rect.yMin() - margin),
+               point(diode_rect.xMax() + margin, diode_rect.yMax() + margin));
+    windows.insert(value(window, windows.size()));
+  }
+
+  for (odb::dbInst* inst : block_->getInsts()) {
+    if (inst->getPlacementStatus() != odb::dbPlacementStatus::PLACED
+        || diodes.find(inst) != diodes.end()) {
+      continue;
+    }
+    const odb::Rect inst_rect = inst->getBBox()->getBox();
+    box inst_box(point(inst_rect.xMin(), inst_rect.yMin()),
+                 point(inst_rect.xMax(), inst_rect.yMax()));
+    if (windows.qbegin(bgi::intersects(inst_box)) == windows.qend()) {
+      inst->setPlacementStatus(odb::dbPlacementStatus::FIRM);
+      held_insts.push_back(inst);
+    }
+  }
+}
+
+RepairAntennas::DiodeInsertion RepairAntennas::makeDiodeInsertion(
+    odb::dbNet* net,
+    odb::dbMTerm* diode_mterm,
+    odb::dbITerm* gate,
+    const int site_width,
+    odb::dbTechLayer* violation_layer)
+{
+  const int max_legalize_itr = 50;
   odb::dbMaster* diode_master = diode_mterm->getMaster();
   std::string diode_inst_name
       = "ANTENNA_" + std::to_string(unique_diode_index_++);
   odb::dbInst* diode_inst
       = odb::dbInst::create(block_, diode_master, diode_inst_name.c_str());
 
-  bool place_vertically
+  DiodeInsertion insertion;
+  insertion.net = net;
+  insertion.gate = gate;
+  insertion.diode_inst = diode_inst;
+  insertion.place_vertically
       = violation_layer->getDirection() == odb::dbTechLayerDir::VERTICAL;
-  bool legally_placed = setDiodeLoc(
-      diode_inst, gate, site_width, place_vertically, fixed_insts);
+  odb::dbBox* diode_bbox = diode_inst->getBBox();
+  insertion.diode_width = diode_bbox->xMax() - diode_bbox->xMin();
+  insertion.diode_height = diode_bbox->yMax() - diode_bbox->yMin();
+  insertion.pad_width
+      = (opendp_->padLeft(diode_inst) + opendp_->padRight(diode_inst))
+        * site_width;
+  insertion.legally_placed = false;
+
+  int inst_loc_x, inst_loc_y, inst_width, inst_height;
+  odb::dbOrientType inst_orient;
+  getInstancePlacementData(
+      gate, inst_loc_x, inst_loc_y, inst_width, inst_height, inst_orient);
+
+  // The candidates alternate around the gate and move away from it at each
+  // trial, independently of what is already placed.
+  bool place_at_left = true;
+  bool place_at_top = false;
+  int left_offset = 0, right_offset = 0;
+  int top_offset = 0, bottom_offset = 0;
+  int horizontal_offset = 0, vertical_offset = 0;
+  insertion.search_area.mergeInit();
+  for (int itr = 0; itr < max_legalize_itr; itr++) {
+    if (insertion.place_vertically) {
+      computeVerticalOffset(inst_height,
+                            top_offset,
+                            bottom_offset,
+                            place_at_top,
+                            vertical_offset);
+    } else {
+      computeHorizontalOffset(insertion.diode_width,
+                              inst_width,
+                              site_width,
+                              left_offset,
+                              right_offset,
+                              place_at_left,
+                              horizontal_offset);
+    }
+    const odb::Point loc(inst_loc_x + horizontal_offset,
+                         inst_loc_y + vertical_offset);
+    insertion.candidates.push_back(loc);
+    insertion.search_area.merge(
+        odb::Rect(loc.x() - insertion.pad_width,
+                  loc.y(),
+                  loc.x() + insertion.diode_width + insertion.pad_width,
+                  loc.y() + insertion.diode_height));
+  }
+  insertion.location = insertion.candidates.back();
+
+  return insertion;
+}
 
-  odb::Rect inst_rect = diode_inst->getBBox()->getBox();
+void RepairAntennas::placeDiodes(std::vector<DiodeInsertion>& insertions,
+                                 r_tree& fixed_insts,
+                                 const int num_threads)
+{
+  // A diode can only be blocked by the diodes placed before it whose search
+  // areas overlap its own. Each diode is put one level after the last of
+  // those, so the diodes of a level do not interact and each one sees the
+  // same diodes it would see if they were placed serially in violation
+  // order.
+  std::vector<int> diode_levels(insertions.size(), 0);
+  std::vector<std::vector<int>> levels;
+  r_tree search_areas;
+  for (int i = 0; i < insertions.size(); i++) {
+    const odb::Rect& search_area = insertions[i].search_area;
+    box b(point(search_area.xMin(), search_area.yMin()),
+          point(search_area.xMax(), search_area.yMax()));
+    for (auto it = search_areas.qbegin(bgi::intersects(b));
+         it != search_areas.qend();
+         ++it) {
+      diode_levels[i] = std::max(diode_levels[i], diode_levels[it->second] + 1);
+    }
+    search_areas.insert(value(b, i));
+    if (diode_levels[i] == levels.size()) {
+      levels.emplace_back();
+    }
+    levels[diode_levels[i]].push_back(i);
+  }
 
-  legally_placed = legally_placed && diodeInRow(inst_rect);
+  for (const std::vector<int>& level : levels) {
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int i = 0; i < level.size(); i++) {
+      placeDiode(insertions[level[i]], fixed_insts);
+    }
 
-  if (!legally_placed)
+    // Add the diodes to the R-tree of fixed instances
+    for (const int idx : level) {
+      const DiodeInsertion& insertion = insertions[idx];
+      const odb::Point& loc = insertion.location;
+      box b(point(loc.x(), loc.y()),
+            point(loc.x() + insertion.diode_width,
+                  loc.y() + insertion.diode_height));
+      fixed_insts.insert(value(b, fixed_insts.size()));
+    }
+  }
+}
+
+void RepairAntennas::placeDiode(DiodeInsertion& insertion,
+                                const r_tree& fixed_insts)
+{
+  // Use R-tree to check if diode will not overlap or cause 1-site spacing with
+  // other fixed cells
+  odb::Rect diode_rect;
+  for (const odb::Point& loc : insertion.candidates) {
+    insertion.location = loc;
+    diode_rect = odb::Rect(loc.x(),
+                           loc.y(),
+                           loc.x() + insertion.diode_width,
+                           loc.y() + insertion.diode_height);
+    if (checkDiodeLoc(diode_rect, insertion.pad_width, fixed_insts)) {
+      insertion.legally_placed = true;
+      break;
+    }
+  }
+
+  insertion.legally_placed = insertion.legally_placed && diodeInRow(diode_rect);
+}
+
+void RepairAntennas::commitDiode(const DiodeInsertion& insertion,
+                                 odb::dbMTerm* diode_mterm)
+{
+  odb::dbInst* diode_inst = insertion.diode_inst;
+  odb::dbInst* sink_inst = insertion.gate->getInst();
+  const odb::Point& loc = insertion.location;
+
+  diode_inst->setOrient(sink_inst->getOrient());
+  if (sink_inst->isBlock() || sink_inst->isPad()
+      || insertion.place_vertically) {
+    odb::Point diode_center(loc.x() + insertion.diode_width / 2,
+                            loc.y() + insertion.diode_height / 2);
+    diode_inst->setOrient(getRowOrient(diode_center));
+  }
+  diode_inst->setLocation(loc.x(), loc.y());
+
+  if (!insertion.legally_placed)
     illegal_diode_placement_count_++;
 
   // allow detailed placement to move diodes with geometry out of the core area,
   // or near macro pins (can be placed out of row), or illegal placed diodes
+  const odb::Rect inst_rect = diode_inst->getBBox()->getBox();
   const odb::Rect& core_area = block_->getCoreArea();
-  odb::dbInst* sink_inst = gate->getInst();
   if (core_area.contains(inst_rect) && !sink_inst->getMaster()->isBlock()
-      && legally_placed) {
+      && insertion.legally_placed) {
     diode_inst->setPlacementStatus(odb::dbPlacementStatus::FIRM);
   } else {
     diode_inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
@@ -577,16 +756,8 @@ void RepairAntennas::insertDiode(odb::dbNet* net,
 
   odb::dbITerm* diode_iterm
       = diode_inst->findITerm(diode_mterm->getConstName());
-  diode_iterm->connect(net);
+  diode_iterm->connect(insertion.net);
   diode_insts_.push_back(diode_inst);
-
-  // Add diode to the R-tree of fixed instances
-  int fixed_inst_id = fixed_insts.size();
-  box b(point(inst_rect.xMin(), inst_rect.yMin()),
-        point(inst_rect.xMax(), inst_rect.yMax()));
-  value v(b, fixed_inst_id);
-  fixed_insts.insert(v);
-  fixed_inst_id++;
 }
 
 void RepairAntennas::getFixedInstances(r_tree& fixed_insts)
@@ -641,67 +812,6 @@ void RepairAntennas::setInstsPlacementStatus(
   }
 }
 
-bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
-                                 odb::dbITerm* gate,
-                                 int site_width,
-                                 const bool place_vertically,
-                                 r_tree& fixed_insts)
-{
-  const int max_legalize_itr = 50;
-  bool place_at_left = true;
-  bool place_at_top = false;
-  int left_offset = 0, right_offset = 0;
-  int top_offset = 0, bottom_offset = 0;
-  int horizontal_offset = 0, vertical_offset = 0;
-  bool legally_placed = false;
-
-  int inst_loc_x, inst_loc_y, inst_width, inst_height;
-  odb::dbOrientType inst_orient;
-  getInstancePlacementData(
-      gate, inst_loc_x, inst_loc_y, inst_width, inst_height, inst_orient);
-
-  odb::dbBox* diode_bbox = diode_inst->getBBox();
-  int diode_width = diode_bbox->xMax() - diode_bbox->xMin();
-  int diode_height = diode_bbox->yMax() - diode_bbox->yMin();
-  odb::dbInst* sink_inst = gate->getInst();
-
-  // Use R-tree to check if diode will not overlap or cause 1-site spacing with
-  // other fixed cells
-  int legalize_itr = 0;
-  while (!legally_placed && legalize_itr < max_legalize_itr) {
-    if (place_vertically) {
-      computeVerticalOffset(inst_height,
-                            top_offset,
-                            bottom_offset,
-                            place_at_top,
-                            vertical_offset);
-    } else {
-      computeHorizontalOffset(diode_width,
-                              inst_width,
-                              site_width,
-                              left_offset,
-                              right_offset,
-                              place_at_left,
-                              horizontal_offset);
-    }
-    diode_inst->setOrient(inst_orient);
-    if (sink_inst->isBlock() || sink_inst->isPad() || place_vertically) {
-      int x_center = inst_loc_x + horizontal_offset + diode_width / 2;
-      int y_center = inst_loc_y + vertical_offset + diode_height / 2;
-      odb::Point diode_center(x_center, y_center);
-      odb::dbOrientType orient = getRowOrient(diode_center);
-      diode_inst->setOrient(orient);
-    }
-    diode_inst->setLocation(inst_loc_x + horizontal_offset,
-                            inst_loc_y + vertical_offset);
-
-    legally_placed = checkDiodeLoc(diode_inst, site_width, fixed_insts);
-    legalize_itr++;
-  }
-
-  return legally_placed;
-}
-
 void RepairAntennas::getInstancePlacementData(odb::dbITerm* gate,
                                               int& inst_loc_x,
                                               int& inst_loc_y,
@@ -718,23 +828,18 @@ void RepairAntennas::getInstancePlacementData(odb::dbITerm* gate,
   inst_orient = sink_inst->getOrient();
 }
 
-bool RepairAntennas::checkDiodeLoc(odb::dbInst* diode_inst,
-                                   const int site_width,
-                                   r_tree& fixed_insts)
+bool RepairAntennas::checkDiodeLoc(const odb::Rect& diode_rect,
+                                   const int pad_width,
+                                   const r_tree& fixed_insts)
 {
   const odb::Rect& core_area = block_->getCoreArea();
-  const int left_pad = opendp_->padLeft(diode_inst);
-  const int right_pad = opendp_->padRight(diode_inst);
-  odb::dbBox* instBox = diode_inst->getBBox();
-  box box(point(instBox->xMin() - ((left_pad + right_pad) * site_width) + 1,
-                instBox->yMin() + 1),
-          point(instBox->xMax() + ((left_pad + right_pad) * site_width) - 1,
-                instBox->yMax() - 1));
+  box box(point(diode_rect.xMin() - pad_width + 1, diode_rect.yMin() + 1),
+          point(diode_rect.xMax() + pad_width - 1, diode_rect.yMax() - 1));
 
   std::vector<value> overlap_insts;
   fixed_insts.query(bgi::intersects(box), std::back_inserter(overlap_insts));
 
-  return overlap_insts.empty() && core_area.contains(instBox->getBox());
+  return overlap_insts.empty() && core_area.contains(diode_rect);
 }
 
 void RepairAntennas::computeHorizontalOffset(const int diode_width,
@@ -106,7 +106,7 @@ class RepairAntennas
   void checkNetViolations(odb::dbNet* db_net,
                           odb::dbMTerm* diode_mterm,
                           float ratio_margin);
-  void repairAntennas(odb::dbMTerm* diode_mterm);
+  void repairAntennas(odb::dbMTerm* diode_mterm, int num_threads = 1);
   void legalizePlacedCells();
   AntennaViolations getAntennaViolations() { return antenna_violations_; }
   void setAntennaViolations(AntennaViolations antenna_violations)
@@ -130,30 +130,52 @@ class RepairAntennas
   typedef std::pair<box, int> value;
   typedef bgi::rtree<value, bgi::quadratic<8, 4>> r_tree;
 
-  void insertDiode(odb::dbNet* net,
-                   odb::dbMTerm* diode_mterm,
-                   odb::dbITerm* sink_iterm,
-                   int site_width,
+  // A diode waiting to be placed next to the gate it protects.
+  struct DiodeInsertion
+  {
+    odb::dbNet* net;
+    odb::dbITerm* gate;
+    odb::dbInst* diode_inst;
+    bool place_vertically;
+    int diode_width;
+    int diode_height;
+    // Horizontal keep-out around the diode from the placement padding.
+    int pad_width;
+    // Lower left corners of the candidate locations, in trial order.
+    std::vector<odb::Point> candidates;
+    // Union of all candidate boxes, padding included.
+    odb::Rect search_area;
+    odb::Point location;
+    bool legally_placed;
+  };
+
+  DiodeInsertion makeDiodeInsertion(odb::dbNet* net,
+                                    odb::dbMTerm* diode_mterm,
+                                    odb::dbITerm* gate,
+                                    int site_width,
+                                    odb::dbTechLayer* violation_layer);
+  void placeDiodes(std::vector<DiodeInsertion>& insertions,
                    r_tree& fixed_insts,
-                   odb::dbTechLayer* violation_layer);
+                   int num_threads);
+  void placeDiode(DiodeInsertion& insertion, const r_tree& fixed_insts);
+  void commitDiode(const DiodeInsertion& insertion,
+                   odb::dbMTerm* diode_mterm);
   void getFixedInstances(r_tree& fixed_insts);
   void setDiodesAndGatesPlacementStatus(
       odb::dbPlacementStatus placement_status);
   void setInstsPlacementStatus(std::vector<odb::dbInst*>& insts_to_restore);
-  bool setDiodeLoc(odb::dbInst* diode_inst,
-                   odb::dbITerm* gate,
-                   int site_width,
-                   bool place_vertically,
-                   r_tree& fixed_insts);
+  // Sets FIRM the placed cells that are not near a new diode and returns
+  // them in held_insts.
+  void holdCellsAwayFromDiodes(std::vector<odb::dbInst*>& held_insts);
   void getInstancePlacementData(odb::dbITerm* gate,
                                 int& inst_loc_x,
                                 int& inst_loc_y,
                                 int& inst_width,
                                 int& inst_height,
                                 odb::dbOrientType& inst_orient);
-  bool checkDiodeLoc(odb::dbInst* diode_inst,
-                     int site_width,
-                     r_tree& fixed_insts);
+  bool checkDiodeLoc(const odb::Rect& diode_rect,
+                     int pad_width,
+                     const r_tree& fixed_insts);
   void computeHorizontalOffset(int diode_width,
                                int inst_width,
                                int site_width,
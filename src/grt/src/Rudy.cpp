@@ -32,6 +32,8 @@
 
 #include "grt/Rudy.h"
 
+#include <algorithm>
+
 #include "grt/GRoute.h"
 #include "grt/GlobalRouter.h"
 #include "odb/dbShape.h"
@@ -83,6 +85,7 @@ void Rudy::setGridConfig(odb::Rect block, int tile_cnt_x, int tile_cnt_y)
   grid_block_ = block;
   tile_cnt_x_ = tile_cnt_x;
   tile_cnt_y_ = tile_cnt_y;
+  rudy_valid_ = false;
 }
 
 void Rudy::makeGrid()
@@ -113,22 +116,79 @@ void Rudy::makeGrid()
   }
 }
 
-void Rudy::getResourceReductions()
+void Rudy::getResourceReductions(std::vector<float>& reductions)
 {
   CapacityReductionData cap_usage_data;
   grouter_->getCapacityReductionData(cap_usage_data);
+  reductions.resize(grid_.size() * tile_cnt_y_);
   for (int x = 0; x < grid_.size(); x++) {
     for (int y = 0; y < grid_[x].size(); y++) {
-      Tile& tile = getEditableTile(x, y);
       uint8_t tile_cap = cap_usage_data[x][y].capacity;
       float tile_reduction = cap_usage_data[x][y].reduction;
       float cap_usage_data = tile_reduction / tile_cap;
-      tile.addRudy(cap_usage_data * 100);
+      reductions[x * tile_cnt_y_ + y] = cap_usage_data * 100;
+    }
+  }
+}
+
+void Rudy::applyResourceReductions()
+{
+  for (int x = 0; x < grid_.size(); x++) {
+    for (int y = 0; y < grid_[x].size(); y++) {
+      getEditableTile(x, y).addRudy(reductions_[x * tile_cnt_y_ + y]);
+    }
+  }
+}
+
+bool Rudy::collectNets()
+{
+  bool changed = false;
+  size_t idx = 0;
+  for (odb::dbNet* net : block_->getNets()) {
+    if (idx < nets_.size()) {
+      if (nets_[idx] != net) {
+        nets_[idx] = net;
+        changed = true;
+      }
+    } else {
+      nets_.push_back(net);
+      changed = true;
     }
+    idx++;
+  }
+  if (idx != nets_.size()) {
+    nets_.resize(idx);
+    changed = true;
+  }
+  return changed;
+}
+
+void Rudy::updateNetBoxes(std::vector<odb::Rect>& net_boxes)
+{
+  const int num_nets = nets_.size();
+  net_boxes.resize(num_nets);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < num_nets; i++) {
+    odb::dbNet* net = nets_[i];
+    net_boxes[i]
+        = net->getSigType().isSupply() ? odb::Rect() : net->getTermBBox();
   }
 }
 
+int Rudy::getNumBands() const
+{
+  return std::max(1, std::min(num_threads_, tile_cnt_x_));
+}
+
 void Rudy::calculateRudy()
+{
+  collectNets();
+  getResourceReductions(reductions_);
+  updateNetBoxes(net_boxes_);
+  accumulateRudy();
+}
+
+void Rudy::accumulateRudy()
 {
   // Clear previous computation
   for (auto& grid_column : grid_) {
@@ -137,18 +197,116 @@ void Rudy::calculateRudy()
     }
   }
 
-  getResourceReductions();
+  applyResourceReductions();
+
+  if (grid_.empty()) {
+    return;
+  }
 
   // refer: https://ieeexplore.ieee.org/document/4211973
-  for (auto net : block_->getNets()) {
-    if (!net->getSigType().isSupply()) {
-      const auto net_rect = net->getTermBBox();
-      processIntersectionSignalNet(net_rect);
+  // Every band of tile columns walks all nets in block order, so each tile
+  // sums its contributions in the same order regardless of the thread count.
+  const int num_bands = getNumBands();
+#pragma omp parallel for num_threads(num_bands) schedule(static, 1)
+  for (int band = 0; band < num_bands; band++) {
+    const int x_begin = band * tile_cnt_x_ / num_bands;
+    const int x_end = (band + 1) * tile_cnt_x_ / num_bands;
+    for (const odb::Rect& net_rect : net_boxes_) {
+      processIntersectionSignalNet(net_rect, x_begin, x_end);
     }
   }
+  rudy_valid_ = true;
 }
 
-void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
+void Rudy::updateRudy()
+{
+  if (!rudy_valid_ || collectNets()) {
+    calculateRudy();
+    return;
+  }
+
+  std::vector<float> reductions;
+  getResourceReductions(reductions);
+  std::vector<odb::Rect> net_boxes;
+  updateNetBoxes(net_boxes);
+
+  std::vector<int> moved_nets;
+  for (int i = 0; i < net_boxes.size(); i++) {
+    if (net_boxes[i] != net_boxes_[i]) {
+      moved_nets.push_back(i);
+    }
+  }
+
+  // Once a sizeable part of the design moved most tiles are dirty, so a
+  // full pass is cheaper.
+  if (reductions != reductions_ || moved_nets.size() * 4 > net_boxes.size()) {
+    reductions_.swap(reductions);
+    net_boxes_.swap(net_boxes);
+    accumulateRudy();
+    return;
+  }
+
+  if (moved_nets.empty()) {
+    return;
+  }
+
+  // Subtracting the old contribution of a net and adding the new one would
+  // make the float sums depend on the edit history. Instead the tiles the
+  // moved nets touch are summed again from scratch, in the same order as
+  // accumulateRudy.
+  std::vector<bool> dirty(reductions_.size(), false);
+  for (const int net_idx : moved_nets) {
+    markTiles(net_boxes_[net_idx], dirty);
+    markTiles(net_boxes[net_idx], dirty);
+  }
+  net_boxes_.swap(net_boxes);
+
+  for (int x = 0; x < grid_.size(); x++) {
+    for (int y = 0; y < grid_[x].size(); y++) {
+      const int idx = x * tile_cnt_y_ + y;
+      if (dirty[idx]) {
+        Tile& tile = getEditableTile(x, y);
+        tile.clearRudy();
+        tile.addRudy(reductions_[idx]);
+      }
+    }
+  }
+
+  const int num_bands = getNumBands();
+#pragma omp parallel for num_threads(num_bands) schedule(static, 1)
+  for (int band = 0; band < num_bands; band++) {
+    const int x_begin = band * tile_cnt_x_ / num_bands;
+    const int x_end = (band + 1) * tile_cnt_x_ / num_bands;
+    for (const odb::Rect& net_rect : net_boxes_) {
+      processIntersectionSignalNet(net_rect, x_begin, x_end, &dirty);
+    }
+  }
+}
+
+void Rudy::markTiles(const odb::Rect net_rect, std::vector<bool>& dirty) const
+{
+  if (net_rect.area() == 0) {
+    return;
+  }
+  const int min_x_index
+      = std::max(0, (net_rect.xMin() - grid_block_.xMin()) / tile_size_);
+  const int max_x_index = std::min(
+      tile_cnt_x_ - 1, (net_rect.xMax() - grid_block_.xMin()) / tile_size_);
+  const int min_y_index
+      = std::max(0, (net_rect.yMin() - grid_block_.yMin()) / tile_size_);
+  const int max_y_index = std::min(
+      tile_cnt_y_ - 1, (net_rect.yMax() - grid_block_.yMin()) / tile_size_);
+  for (int x = min_x_index; x <= max_x_index; ++x) {
+    for (int y = min_y_index; y <= max_y_index; ++y) {
+      dirty[x * tile_cnt_y_ + y] = true;
+    }
+  }
+}
+
+void Rudy::processIntersectionSignalNet(const odb::Rect net_rect,
+                                        const int x_begin,
+                                        const int x_end,
+                                        const std::vector<bool>* dirty)
 {
   const auto net_area = net_rect.area();
   if (net_area == 0) {
@@ -159,11 +317,11 @@ void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
   const auto wire_area = hpwl * wire_width_;
   const auto net_congestion = wire_area / net_area;
 
-  // Calculate the intersection range
-  const int min_x_index
-      = std::max(0, (net_rect.xMin() - grid_block_.xMin()) / tile_size_);
+  // Calculate the intersection range, limited to the columns of the band
+  const int min_x_index = std::max(
+      x_begin, (net_rect.xMin() - grid_block_.xMin()) / tile_size_);
   const int max_x_index = std::min(
-      tile_cnt_x_ - 1, (net_rect.xMax() - grid_block_.xMin()) / tile_size_);
+      x_end - 1, (net_rect.xMax() - grid_block_.xMin()) / tile_size_);
   const int min_y_index
       = std::max(0, (net_rect.yMin() - grid_block_.yMin()) / tile_size_);
   const int max_y_index = std::min(
@@ -172,6 +330,9 @@ void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
   // Iterate over the tiles in the calculated range
   for (int x = min_x_index; x <= max_x_index; ++x) {
     for (int y = min_y_index; y <= max_y_index; ++y) {
+      if (dirty != nullptr && !(*dirty)[x * tile_cnt_y_ + y]) {
+        continue;
+      }
       Tile& tile = getEditableTile(x, y);
       const auto tile_box = tile.getRect();
       if (net_rect.overlaps(tile_box)) {
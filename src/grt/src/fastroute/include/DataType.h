@@ -57,7 +57,7 @@ enum class RouteType
 
 std::ostream& operator<<(std::ostream& os, RouteType type);
 
-enum class Direction
+enum class Direction : uint8_t
 {
   North,
   East,
@@ -143,10 +143,8 @@ struct Edge  // An Edge is the routing track holder between two adjacent
   uint16_t usage;  // the usage of the edge
   uint16_t red;
   int16_t last_usage;
-  double est_usage;  // the estimated usage of the edge
 
   uint16_t usage_red() const { return usage + red; }
-  double est_usage_red() const { return est_usage + red; }
 };
 
 struct Edge3D
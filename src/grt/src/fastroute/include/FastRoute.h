@@ -95,8 +95,9 @@ using stt::Tree;
 
 struct parent3D
 {
+  // Grid coordinates fit in 16 bits, like the route grids of a tree edge.
   int16_t layer;
-  int x, y;
+  int16_t x, y;
 };
 
 class FastRouteCore
@@ -201,6 +202,7 @@ class FastRouteCore
   void incrementEdge3DUsage(int x1, int y1, int x2, int y2, int layer);
   void setMaxNetDegree(int);
   void setVerbose(bool v);
+  void setNumThreads(int num_threads);
   void setCriticalNetsPercentage(float u);
   float getCriticalNetsPercentage() { return critical_nets_percentage_; };
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
@@ -253,6 +255,15 @@ class FastRouteCore
   odb::Rect globalRoutingToBox(const GSegment& route);
   NetRouteMap getRoutes();
   NetRouteMap getPlanarRoutes();
+  // Estimated usage plus the capacity reduction of a 2D edge.
+  double hEstUsageRed(int y, int x) const
+  {
+    return h_est_usage_[y][x] + h_edges_[y][x].red;
+  }
+  double vEstUsageRed(int y, int x) const
+  {
+    return v_est_usage_[y][x] + v_edges_[y][x].red;
+  }
 
   // maze functions
   // Maze-routing in different orders
@@ -506,9 +517,14 @@ class FastRouteCore
                          bool horizontal,
                          int& best_cost,
                          multi_array<int, 2>& layer_grid);
-  void assignEdge(int netID, int edgeID, bool processDIR);
+  // Returns false, setting bad_layer to the ending layer, when the edge
+  // ends outside the layer range of its already assigned target node.
+  bool assignEdge(int netID, int edgeID, bool processDIR, int& bad_layer);
   void recoverEdge(int netID, int edgeID);
   void layerAssignmentV4();
+  // bad_layer is only set when an edge of the net fails to be assigned.
+  bool assignNetLayers(int netID, int& bad_layer);
+  bool claimNetFootprint(int netID, int batch, std::vector<int>& gcell_batch);
   void netpinOrderInc();
   void checkRoute3D();
   void StNetOrder();
@@ -574,6 +590,7 @@ class FastRouteCore
   bool has_2D_overflow_;
   int grid_hv_;
   bool verbose_;
+  int num_threads_;
   float critical_nets_percentage_;
   int via_cost_;
   int mazeedge_threshold_;
@@ -616,6 +633,11 @@ class FastRouteCore
 
   multi_array<Edge, 2> v_edges_;       // The way it is indexed is (Y, X)
   multi_array<Edge, 2> h_edges_;       // The way it is indexed is (Y, X)
+  // Estimated usage of the 2D edges, used by the pattern routing stages.
+  // It is kept apart from the edges so the maze routing reads only the
+  // fields it needs.
+  multi_array<double, 2> v_est_usage_;  // The way it is indexed is (Y, X)
+  multi_array<double, 2> h_est_usage_;  // The way it is indexed is (Y, X)
   multi_array<Edge3D, 3> h_edges_3D_;  // The way it is indexed is (Layer, Y, X)
   multi_array<Edge3D, 3> v_edges_3D_;  // The way it is indexed is (Layer, Y, X)
   multi_array<int, 2> corr_edge_;
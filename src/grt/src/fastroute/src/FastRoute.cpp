@@ -44,6 +44,7 @@
 #include "DataType.h"
 #include "odb/db.h"
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
 
 namespace grt {
 
@@ -76,6 +77,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       has_2D_overflow_(false),
       grid_hv_(0),
       verbose_(false),
+      num_threads_(1),
       critical_nets_percentage_(10),
       via_cost_(0),
       mazeedge_threshold_(0),
@@ -107,6 +109,8 @@ void FastRouteCore::clear()
 
   h_edges_.resize(boost::extents[0][0]);
   v_edges_.resize(boost::extents[0][0]);
+  h_est_usage_.resize(boost::extents[0][0]);
+  v_est_usage_.resize(boost::extents[0][0]);
   seglist_.clear();
 
   gxs_.clear();
@@ -218,16 +222,27 @@ void FastRouteCore::setGridsAndLayers(int x, int y, int nLayers)
   corr_edge_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
   pr_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
 
-  int64 total_size = static_cast<int64>(num_layers_) * y_range_ * x_range_;
+  // The 3D maze buffers only cover the routing grid. The priority queues
+  // are cleared before each use and grow to the largest search region.
+  const int64 total_size
+      = static_cast<int64>(num_layers_) * y_grid_ * x_grid_;
   pop_heap2_3D_.resize(total_size, false);
 
-  // allocate memory for priority queue
-  total_size = static_cast<int64>(y_grid_) * x_grid_ * num_layers_;
-  src_heap_3D_.resize(total_size);
-  dest_heap_3D_.resize(total_size);
-
-  d1_3D_.resize(boost::extents[num_layers_][y_range_][x_range_]);
-  d2_3D_.resize(boost::extents[num_layers_][y_range_][x_range_]);
+  d1_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
+  d2_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
+
+  debugPrint(logger_,
+             GRT,
+             "memory",
+             1,
+             "3D maze buffers for {}x{}x{} grid: {:.1f} MB.",
+             x_grid_,
+             y_grid_,
+             num_layers_,
+             total_size
+                 * (sizeof(Direction) + sizeof(int) + sizeof(parent3D)
+                    + 2 * sizeof(int))
+                 / 1e6);
 }
 
 void FastRouteCore::addVCapacity(short verticalCapacity, int layer)
@@ -364,6 +379,8 @@ void FastRouteCore::initEdges()
 
   h_edges_.resize(boost::extents[y_grid_][x_grid_ - 1]);
   v_edges_.resize(boost::extents[y_grid_ - 1][x_grid_]);
+  h_est_usage_.resize(boost::extents[y_grid_][x_grid_ - 1]);
+  v_est_usage_.resize(boost::extents[y_grid_ - 1][x_grid_]);
 
   v_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
   h_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
@@ -374,7 +391,7 @@ void FastRouteCore::initEdges()
       if (j < x_grid_ - 1) {
         h_edges_[i][j].cap = h_capacity_;
         h_edges_[i][j].usage = 0;
-        h_edges_[i][j].est_usage = 0;
+        h_est_usage_[i][j] = 0;
         h_edges_[i][j].red = 0;
         h_edges_[i][j].last_usage = 0;
       }
@@ -393,7 +410,7 @@ void FastRouteCore::initEdges()
       if (i < y_grid_ - 1) {
         v_edges_[i][j].cap = v_capacity_;
         v_edges_[i][j].usage = 0;
-        v_edges_[i][j].est_usage = 0;
+        v_est_usage_[i][j] = 0;
         v_edges_[i][j].red = 0;
         v_edges_[i][j].last_usage = 0;
       }
@@ -713,7 +730,7 @@ void FastRouteCore::initAuxVar()
 {
   tree_order_cong_.clear();
 
-  grid_hv_ = x_range_ * y_range_;
+  grid_hv_ = x_grid_ * y_grid_;
 
   parent_x1_.resize(boost::extents[y_grid_][x_grid_]);
   parent_y1_.resize(boost::extents[y_grid_][x_grid_]);
@@ -995,6 +1012,8 @@ NetRouteMap FastRouteCore::run()
     return getRoutes();
   }
 
+  utl::TraceZone run_zone("grt.fastroute");
+
   v_used_ggrid_.clear();
   h_used_ggrid_.clear();
 
@@ -1042,6 +1061,7 @@ NetRouteMap FastRouteCore::run()
 
   // call FLUTE to generate RSMT and break the nets into segments (2-pin nets)
 
+  utl::TraceZone pattern_zone("grt.pattern_route");
   via_cost_ = 0;
   gen_brk_RSMT(false, false, false, false, noADJ);
   routeLAll(true);
@@ -1055,6 +1075,7 @@ NetRouteMap FastRouteCore::run()
   int past_cong = getOverflow2D(&maxOverflow);
 
   convertToMazeroute();
+  pattern_zone.end();
 
   int enlarge_ = 10;
   int newTH = 10;
@@ -1133,6 +1154,7 @@ NetRouteMap FastRouteCore::run()
   float overflow_reduction_percent = -1;
   while (total_overflow_ > 0 && i <= overflow_iterations_
          && overflow_increases <= max_overflow_increases) {
+    utl::TraceZone iter_zone("grt.maze_route_iter");
     if (THRESH_M > 15) {
       THRESH_M -= thStep1;
     } else if (THRESH_M >= 2) {
@@ -1400,12 +1422,15 @@ NetRouteMap FastRouteCore::run()
 
   getOverflow2Dmaze(&maxOverflow, &tUsage);
 
+  utl::TraceZone layer_zone("grt.layer_assignment");
   layerAssignment();
+  layer_zone.end();
 
   costheight_ = 3;
   via_cost_ = 1;
 
   if (goingLV && past_cong == 0) {
+    utl::TraceZone maze3d_zone("grt.maze_route_3d");
     mazeRouteMSMDOrder3D(enlarge_, 0, 20);
     mazeRouteMSMDOrder3D(enlarge_, 0, 12);
   }
@@ -1440,6 +1465,11 @@ void FastRouteCore::setVerbose(bool v)
   verbose_ = v;
 }
 
+void FastRouteCore::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void FastRouteCore::setCriticalNetsPercentage(float u)
 {
   critical_nets_percentage_ = u;
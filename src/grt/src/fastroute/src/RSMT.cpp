@@ -429,7 +429,7 @@ void FastRouteCore::fluteCongest(const int netID,
       for (int k = ys[0]; k <= ys[d - 1]; k++)  // all grids in the column
       {
         for (int j = xs[i]; j < xs[i + 1]; j++)
-          usageH += h_edges_[k][j].est_usage_red();
+          usageH += hEstUsageRed(k, j);
       }
       if (x_seg[i] != 0 && usageH != 0) {
         x_seg[i]
@@ -440,7 +440,7 @@ void FastRouteCore::fluteCongest(const int netID,
       int usageV = 0;
       for (int j = ys[i]; j < ys[i + 1]; j++) {
         for (int k = xs[0]; k <= xs[d - 1]; k++)  // all grids in the row
-          usageV += v_edges_[j][k].est_usage_red();
+          usageV += vEstUsageRed(j, k);
       }
       if (y_seg[i] != 0 && usageV != 0) {
         y_seg[i]
@@ -478,14 +478,14 @@ bool FastRouteCore::netCongestion(const int netID)
       for (int i = seg.x1; i < seg.x2; i++) {
         const int cap = getEdgeCapacity(
             nets_[netID], i, seg.y1, EdgeDirection::Horizontal);
-        if (h_edges_[seg.y1][i].est_usage >= cap) {
+        if (h_est_usage_[seg.y1][i] >= cap) {
           return true;
         }
       }
       for (int i = ymin; i < ymax; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], seg.x2, i, EdgeDirection::Vertical);
-        if (v_edges_[i][seg.x2].est_usage >= cap) {
+        if (v_est_usage_[i][seg.x2] >= cap) {
           return true;
         }
       }
@@ -493,14 +493,14 @@ bool FastRouteCore::netCongestion(const int netID)
       for (int i = ymin; i < ymax; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], seg.x1, i, EdgeDirection::Vertical);
-        if (v_edges_[i][seg.x1].est_usage >= cap) {
+        if (v_est_usage_[i][seg.x1] >= cap) {
           return true;
         }
       }
       for (int i = seg.x1; i < seg.x2; i++) {
         const int cap = getEdgeCapacity(
             nets_[netID], i, seg.y2, EdgeDirection::Horizontal);
-        if (h_edges_[seg.y2][i].est_usage >= cap) {
+        if (h_est_usage_[seg.y2][i] >= cap) {
           return true;
         }
       }
@@ -600,26 +600,26 @@ float FastRouteCore::coeffADJ(const int netID)
   if (xmin == xmax) {
     for (int j = ymin; j < ymax; j++) {
       Vcap += getEdgeCapacity(nets_[netID], xmin, j, EdgeDirection::Vertical);
-      Vusage += v_edges_[j][xmin].est_usage;
+      Vusage += v_est_usage_[j][xmin];
     }
     coef = 1;
   } else if (ymin == ymax) {
     for (int i = xmin; i < xmax; i++) {
       Hcap += getEdgeCapacity(nets_[netID], i, ymin, EdgeDirection::Horizontal);
-      Husage += h_edges_[ymin][i].est_usage;
+      Husage += h_est_usage_[ymin][i];
     }
     coef = 1;
   } else {
     for (int j = ymin; j <= ymax; j++) {
       for (int i = xmin; i < xmax; i++) {
         Hcap += getEdgeCapacity(nets_[netID], i, j, EdgeDirection::Horizontal);
-        Husage += h_edges_[j][i].est_usage;
+        Husage += h_est_usage_[j][i];
       }
     }
     for (int j = ymin; j < ymax; j++) {
       for (int i = xmin; i <= xmax; i++) {
         Vcap += getEdgeCapacity(nets_[netID], i, j, EdgeDirection::Vertical);
-        Vusage += v_edges_[j][i].est_usage;
+        Vusage += v_est_usage_[j][i];
       }
     }
     // (Husage * Vcap) resulting in zero is unlikely, but
@@ -51,14 +51,14 @@ void FastRouteCore::ripupSegL(const Segment* seg)
   // remove L routing
   if (seg->xFirst) {
     for (int i = seg->x1; i < seg->x2; i++)
-      h_edges_[seg->y1][i].est_usage -= edgeCost;
+      h_est_usage_[seg->y1][i] -= edgeCost;
     for (int i = ymin; i < ymax; i++)
-      v_edges_[i][seg->x2].est_usage -= edgeCost;
+      v_est_usage_[i][seg->x2] -= edgeCost;
   } else {
     for (int i = ymin; i < ymax; i++)
-      v_edges_[i][seg->x1].est_usage -= edgeCost;
+      v_est_usage_[i][seg->x1] -= edgeCost;
     for (int i = seg->x1; i < seg->x2; i++)
-      h_edges_[seg->y2][i].est_usage -= edgeCost;
+      h_est_usage_[seg->y2][i] -= edgeCost;
   }
 }
 
@@ -72,35 +72,35 @@ void FastRouteCore::ripupSegZ(const Segment* seg)
   if (seg->x1 == seg->x2) {
     // remove V routing
     for (int i = ymin; i < ymax; i++)
-      v_edges_[i][seg->x1].est_usage -= edgeCost;
+      v_est_usage_[i][seg->x1] -= edgeCost;
   } else if (seg->y1 == seg->y2) {
     // remove H routing
     for (int i = seg->x1; i < seg->x2; i++)
-      h_edges_[seg->y1][i].est_usage -= edgeCost;
+      h_est_usage_[seg->y1][i] -= edgeCost;
   } else {
     // remove Z routing
     if (seg->HVH) {
       for (int i = seg->x1; i < seg->Zpoint; i++)
-        h_edges_[seg->y1][i].est_usage -= edgeCost;
+        h_est_usage_[seg->y1][i] -= edgeCost;
       for (int i = seg->Zpoint; i < seg->x2; i++)
-        h_edges_[seg->y2][i].est_usage -= edgeCost;
+        h_est_usage_[seg->y2][i] -= edgeCost;
       for (int i = ymin; i < ymax; i++)
-        v_edges_[i][seg->Zpoint].est_usage -= edgeCost;
+        v_est_usage_[i][seg->Zpoint] -= edgeCost;
     } else {
       if (seg->y1 < seg->y2) {
         for (int i = seg->y1; i < seg->Zpoint; i++)
-          v_edges_[i][seg->x1].est_usage -= edgeCost;
+          v_est_usage_[i][seg->x1] -= edgeCost;
         for (int i = seg->Zpoint; i < seg->y2; i++)
-          v_edges_[i][seg->x2].est_usage -= edgeCost;
+          v_est_usage_[i][seg->x2] -= edgeCost;
         for (int i = seg->x1; i < seg->x2; i++)
-          h_edges_[seg->Zpoint][i].est_usage -= 1;
+          h_est_usage_[seg->Zpoint][i] -= 1;
       } else {
         for (int i = seg->y2; i < seg->Zpoint; i++)
-          v_edges_[i][seg->x2].est_usage -= edgeCost;
+          v_est_usage_[i][seg->x2] -= edgeCost;
         for (int i = seg->Zpoint; i < seg->y1; i++)
-          v_edges_[i][seg->x1].est_usage -= edgeCost;
+          v_est_usage_[i][seg->x1] -= edgeCost;
         for (int i = seg->x1; i < seg->x2; i++)
-          h_edges_[seg->Zpoint][i].est_usage -= 1;
+          h_est_usage_[seg->Zpoint][i] -= 1;
       }
     }
   }
@@ -126,40 +126,40 @@ void FastRouteCore::newRipup(const TreeEdge* treeedge,
   {
     if (treeedge->route.xFirst) {
       for (int i = x1; i < x2; i++)
-        h_edges_[y1][i].est_usage -= edgeCost;
+        h_est_usage_[y1][i] -= edgeCost;
       for (int i = ymin; i < ymax; i++)
-        v_edges_[i][x2].est_usage -= edgeCost;
+        v_est_usage_[i][x2] -= edgeCost;
     } else {
       for (int i = ymin; i < ymax; i++)
-        v_edges_[i][x1].est_usage -= edgeCost;
+        v_est_usage_[i][x1] -= edgeCost;
       for (int i = x1; i < x2; i++)
-        h_edges_[y2][i].est_usage -= edgeCost;
+        h_est_usage_[y2][i] -= edgeCost;
     }
   } else if (ripuptype == RouteType::ZRoute) {
     // remove Z routing
     const int Zpoint = treeedge->route.Zpoint;
     if (treeedge->route.HVH) {
       for (int i = x1; i < Zpoint; i++)
-        h_edges_[y1][i].est_usage -= edgeCost;
+        h_est_usage_[y1][i] -= edgeCost;
       for (int i = Zpoint; i < x2; i++)
-        h_edges_[y2][i].est_usage -= edgeCost;
+        h_est_usage_[y2][i] -= edgeCost;
       for (int i = ymin; i < ymax; i++)
-        v_edges_[i][Zpoint].est_usage -= edgeCost;
+        v_est_usage_[i][Zpoint] -= edgeCost;
     } else {
       if (y1 < y2) {
         for (int i = y1; i < Zpoint; i++)
-          v_edges_[i][x1].est_usage -= edgeCost;
+          v_est_usage_[i][x1] -= edgeCost;
         for (int i = Zpoint; i < y2; i++)
-          v_edges_[i][x2].est_usage -= edgeCost;
+          v_est_usage_[i][x2] -= edgeCost;
         for (int i = x1; i < x2; i++)
-          h_edges_[Zpoint][i].est_usage -= edgeCost;
+          h_est_usage_[Zpoint][i] -= edgeCost;
       } else {
         for (int i = y2; i < Zpoint; i++)
-          v_edges_[i][x2].est_usage -= edgeCost;
+          v_est_usage_[i][x2] -= edgeCost;
         for (int i = Zpoint; i < y1; i++)
-          v_edges_[i][x1].est_usage -= edgeCost;
+          v_est_usage_[i][x1] -= edgeCost;
         for (int i = x1; i < x2; i++)
-          h_edges_[Zpoint][i].est_usage -= edgeCost;
+          h_est_usage_[Zpoint][i] -= edgeCost;
       }
     }
   } else if (ripuptype == RouteType::MazeRoute) {
@@ -168,10 +168,10 @@ void FastRouteCore::newRipup(const TreeEdge* treeedge,
     for (int i = 0; i < treeedge->route.routelen; i++) {
       if (gridsX[i] == gridsX[i + 1]) {  // a vertical edge
         const int ymin = std::min(gridsY[i], gridsY[i + 1]);
-        v_edges_[ymin][gridsX[i]].est_usage -= edgeCost;
+        v_est_usage_[ymin][gridsX[i]] -= edgeCost;
       } else if (gridsY[i] == gridsY[i + 1]) {  // a horizontal edge
         const int xmin = std::min(gridsX[i], gridsX[i + 1]);
-        h_edges_[gridsY[i]][xmin].est_usage -= edgeCost;
+        h_est_usage_[gridsY[i]][xmin] -= edgeCost;
       } else {
         logger_->error(GRT, 225, "Maze ripup wrong in newRipup.");
       }
@@ -202,7 +202,7 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
       for (int i = x1; i < x2; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], i, y1, EdgeDirection::Horizontal);
-        if (h_edges_[y1][i].est_usage > cap) {
+        if (h_est_usage_[y1][i] > cap) {
           needRipup = true;
           break;
         }
@@ -211,7 +211,7 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
       for (int i = ymin; i < ymax; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], x2, i, EdgeDirection::Vertical);
-        if (v_edges_[i][x2].est_usage > cap) {
+        if (v_est_usage_[i][x2] > cap) {
           needRipup = true;
           break;
         }
@@ -220,7 +220,7 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
       for (int i = ymin; i < ymax; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], x1, i, EdgeDirection::Vertical);
-        if (v_edges_[i][x1].est_usage > cap) {
+        if (v_est_usage_[i][x1] > cap) {
           needRipup = true;
           break;
         }
@@ -228,7 +228,7 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
       for (int i = x1; i < x2; i++) {
         const int cap
             = getEdgeCapacity(nets_[netID], i, y2, EdgeDirection::Horizontal);
-        if (h_edges_[y2][i].est_usage > cap) {
+        if (h_est_usage_[y2][i] > cap) {
           needRipup = true;
           break;
         }
@@ -247,9 +247,9 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
         treenodes[n2].status -= 1;
 
         for (int i = x1; i < x2; i++)
-          h_edges_[y1][i].est_usage -= edgeCost;
+          h_est_usage_[y1][i] -= edgeCost;
         for (int i = ymin; i < ymax; i++)
-          v_edges_[i][x2].est_usage -= edgeCost;
+          v_est_usage_[i][x2] -= edgeCost;
       } else {
         if (n2 >= deg) {
           treenodes[n2].status -= 2;
@@ -257,9 +257,9 @@ bool FastRouteCore::newRipupType2(const TreeEdge* treeedge,
         treenodes[n1].status -= 1;
 
         for (int i = ymin; i < ymax; i++)
-          v_edges_[i][x1].est_usage -= edgeCost;
+          v_est_usage_[i][x1] -= edgeCost;
         for (int i = x1; i < x2; i++)
-          h_edges_[y2][i].est_usage -= edgeCost;
+          h_est_usage_[y2][i] -= edgeCost;
       }
     }
     return needRipup;
@@ -522,40 +522,40 @@ void FastRouteCore::newRipupNet(const int netID)
       {
         if (treeedge->route.xFirst) {
           for (int i = x1; i < x2; i++)
-            h_edges_[y1][i].est_usage -= edgeCost;
+            h_est_usage_[y1][i] -= edgeCost;
           for (int i = ymin; i < ymax; i++)
-            v_edges_[i][x2].est_usage -= edgeCost;
+            v_est_usage_[i][x2] -= edgeCost;
         } else {
           for (int i = ymin; i < ymax; i++)
-            v_edges_[i][x1].est_usage -= edgeCost;
+            v_est_usage_[i][x1] -= edgeCost;
           for (int i = x1; i < x2; i++)
-            h_edges_[y2][i].est_usage -= edgeCost;
+            h_est_usage_[y2][i] -= edgeCost;
         }
       } else if (ripuptype == RouteType::ZRoute) {
         // remove Z routing
         const int Zpoint = treeedge->route.Zpoint;
         if (treeedge->route.HVH) {
           for (int i = x1; i < Zpoint; i++)
-            h_edges_[y1][i].est_usage -= edgeCost;
+            h_est_usage_[y1][i] -= edgeCost;
           for (int i = Zpoint; i < x2; i++)
-            h_edges_[y2][i].est_usage -= edgeCost;
+            h_est_usage_[y2][i] -= edgeCost;
           for (int i = ymin; i < ymax; i++)
-            v_edges_[i][Zpoint].est_usage -= edgeCost;
+            v_est_usage_[i][Zpoint] -= edgeCost;
         } else {
           if (y1 < y2) {
             for (int i = y1; i < Zpoint; i++)
-              v_edges_[i][x1].est_usage -= edgeCost;
+              v_est_usage_[i][x1] -= edgeCost;
             for (int i = Zpoint; i < y2; i++)
-              v_edges_[i][x2].est_usage -= edgeCost;
+              v_est_usage_[i][x2] -= edgeCost;
             for (int i = x1; i < x2; i++)
-              h_edges_[Zpoint][i].est_usage -= edgeCost;
+              h_est_usage_[Zpoint][i] -= edgeCost;
           } else {
             for (int i = y2; i < Zpoint; i++)
-              v_edges_[i][x2].est_usage -= edgeCost;
+              v_est_usage_[i][x2] -= edgeCost;
             for (int i = Zpoint; i < y1; i++)
-              v_edges_[i][x1].est_usage -= edgeCost;
+              v_est_usage_[i][x1] -= edgeCost;
             for (int i = x1; i < x2; i++)
-              h_edges_[Zpoint][i].est_usage -= edgeCost;
+              h_est_usage_[Zpoint][i] -= edgeCost;
           }
         }
       } else if (ripuptype == RouteType::MazeRoute) {
@@ -564,10 +564,10 @@ void FastRouteCore::newRipupNet(const int netID)
         for (int i = 0; i < treeedge->route.routelen; i++) {
           if (gridsX[i] == gridsX[i + 1]) {  // a vertical edge
             const int ymin = std::min(gridsY[i], gridsY[i + 1]);
-            v_edges_[ymin][gridsX[i]].est_usage -= edgeCost;
+            v_est_usage_[ymin][gridsX[i]] -= edgeCost;
           } else if (gridsY[i] == gridsY[i + 1]) {  // a horizontal edge
             const int xmin = std::min(gridsX[i], gridsX[i + 1]);
-            h_edges_[gridsY[i]][xmin].est_usage -= edgeCost;
+            h_est_usage_[gridsY[i]][xmin] -= edgeCost;
           } else {
             logger_->error(GRT,
                            123,
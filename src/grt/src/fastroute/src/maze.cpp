@@ -504,14 +504,14 @@ void FastRouteCore::convertToMazeroute()
   for (int i = 0; i < y_grid_; i++) {
     for (int j = 0; j < x_grid_ - 1; j++) {
       // Add to keep the usage values of the last incremental routing performed
-      h_edges_[i][j].usage += h_edges_[i][j].est_usage;
+      h_edges_[i][j].usage += h_est_usage_[i][j];
     }
   }
 
   for (int i = 0; i < y_grid_ - 1; i++) {
     for (int j = 0; j < x_grid_; j++) {
       // Add to keep the usage values of the last incremental routing performed
-      v_edges_[i][j].usage += v_edges_[i][j].est_usage;
+      v_edges_[i][j].usage += v_est_usage_[i][j];
     }
   }
 
@@ -2427,8 +2427,8 @@ int FastRouteCore::getOverflow2D(int* maxOverflow)
   int total_usage = 0;
 
   for (const auto& [i, j] : h_used_ggrid_) {
-    total_usage += h_edges_[i][j].est_usage;
-    const int overflow = h_edges_[i][j].est_usage - h_edges_[i][j].cap;
+    total_usage += h_est_usage_[i][j];
+    const int overflow = h_est_usage_[i][j] - h_edges_[i][j].cap;
     hCap += h_edges_[i][j].cap;
     if (overflow > 0) {
       H_overflow += overflow;
@@ -2438,8 +2438,8 @@ int FastRouteCore::getOverflow2D(int* maxOverflow)
   }
 
   for (const auto& [i, j] : v_used_ggrid_) {
-    total_usage += v_edges_[i][j].est_usage;
-    const int overflow = v_edges_[i][j].est_usage - v_edges_[i][j].cap;
+    total_usage += v_est_usage_[i][j];
+    const int overflow = v_est_usage_[i][j] - v_edges_[i][j].cap;
     vCap += v_edges_[i][j].cap;
     if (overflow > 0) {
       V_overflow += overflow;
@@ -2515,13 +2515,13 @@ void FastRouteCore::InitEstUsage()
 {
   for (int i = 0; i < y_grid_; i++) {
     for (int j = 0; j < x_grid_ - 1; j++) {
-      h_edges_[i][j].est_usage = 0;
+      h_est_usage_[i][j] = 0;
     }
   }
 
   for (int i = 0; i < y_grid_ - 1; i++) {
     for (int j = 0; j < x_grid_; j++) {
-      v_edges_[i][j].est_usage = 0;
+      v_est_usage_[i][j] = 0;
     }
   }
 }
@@ -876,8 +876,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
         // source subtree
         const int curL = ind1 / (grid_hv_);
         const int remd = ind1 % (grid_hv_);
-        const int curX = remd % x_range_;
-        const int curY = remd / x_range_;
+        const int curX = remd % x_grid_;
+        const int curY = remd / x_grid_;
         removeMin3D(src_heap_3D_);
 
         const bool Horizontal
@@ -1161,8 +1161,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
       // gridsY[] temporarily
 
       const int crossL = ind1 / (grid_hv_);
-      const int crossX = (ind1 % (grid_hv_)) % x_range_;
-      const int crossY = (ind1 % (grid_hv_)) / x_range_;
+      const int crossX = (ind1 % (grid_hv_)) % x_grid_;
+      const int crossY = (ind1 % (grid_hv_)) / x_grid_;
 
       int cnt = 0;
       int curX = crossX;
@@ -54,24 +54,24 @@ void FastRouteCore::estimateOneSeg(Segment* seg)
   // (x2,y1)-(x2,y2)
   if (seg->x1 == seg->x2) {  // a vertical segment
     for (int i = ymin; i < ymax; i++) {
-      v_edges_[i][seg->x1].est_usage += edgeCost;
+      v_est_usage_[i][seg->x1] += edgeCost;
       v_used_ggrid_.insert(std::make_pair(i, seg->x1));
     }
   } else if (seg->y1 == seg->y2) {  // a horizontal segment
     for (int i = seg->x1; i < seg->x2; i++) {
-      h_edges_[seg->y1][i].est_usage += edgeCost;
+      h_est_usage_[seg->y1][i] += edgeCost;
       h_used_ggrid_.insert(std::make_pair(seg->y1, i));
     }
   } else {  // a diagonal segment
     for (int i = ymin; i < ymax; i++) {
-      v_edges_[i][seg->x1].est_usage += edgeCost / 2.0f;
-      v_edges_[i][seg->x2].est_usage += edgeCost / 2.0f;
+      v_est_usage_[i][seg->x1] += edgeCost / 2.0f;
+      v_est_usage_[i][seg->x2] += edgeCost / 2.0f;
       v_used_ggrid_.insert(std::make_pair(i, seg->x1));
       v_used_ggrid_.insert(std::make_pair(i, seg->x2));
     }
     for (int i = seg->x1; i < seg->x2; i++) {
-      h_edges_[seg->y1][i].est_usage += edgeCost / 2.0f;
-      h_edges_[seg->y2][i].est_usage += edgeCost / 2.0f;
+      h_est_usage_[seg->y1][i] += edgeCost / 2.0f;
+      h_est_usage_[seg->y2][i] += edgeCost / 2.0f;
       h_used_ggrid_.insert(std::make_pair(seg->y1, i));
       h_used_ggrid_.insert(std::make_pair(seg->y2, i));
     }
@@ -86,7 +86,7 @@ void FastRouteCore::routeSegV(Segment* seg)
   const int ymax = std::max(seg->y1, seg->y2);
 
   for (int i = ymin; i < ymax; i++) {
-    v_edges_[i][seg->x1].est_usage += edgeCost;
+    v_est_usage_[i][seg->x1] += edgeCost;
     v_used_ggrid_.insert(std::make_pair(i, seg->x1));
   }
 }
@@ -96,7 +96,7 @@ void FastRouteCore::routeSegH(Segment* seg)
   const int edgeCost = nets_[seg->netID]->getEdgeCost();
 
   for (int i = seg->x1; i < seg->x2; i++) {
-    h_edges_[seg->y1][i].est_usage += edgeCost;
+    h_est_usage_[seg->y1][i] += edgeCost;
     h_used_ggrid_.insert(std::make_pair(seg->y1, i));
   }
 }
@@ -118,18 +118,18 @@ void FastRouteCore::routeSegL(Segment* seg)
     double costL2 = 0;
 
     for (int i = ymin; i < ymax; i++) {
-      const double tmp1 = v_edges_[i][seg->x1].est_usage_red() - v_capacity_lb_;
+      const double tmp1 = vEstUsageRed(i, seg->x1) - v_capacity_lb_;
       if (tmp1 > 0)
         costL1 += tmp1;
-      const double tmp2 = v_edges_[i][seg->x2].est_usage_red() - v_capacity_lb_;
+      const double tmp2 = vEstUsageRed(i, seg->x2) - v_capacity_lb_;
       if (tmp2 > 0)
         costL2 += tmp2;
     }
     for (int i = seg->x1; i < seg->x2; i++) {
-      const double tmp1 = h_edges_[seg->y2][i].est_usage_red() - h_capacity_lb_;
+      const double tmp1 = hEstUsageRed(seg->y2, i) - h_capacity_lb_;
       if (tmp1 > 0)
         costL1 += tmp1;
-      const double tmp2 = h_edges_[seg->y1][i].est_usage_red() - h_capacity_lb_;
+      const double tmp2 = hEstUsageRed(seg->y1, i) - h_capacity_lb_;
       if (tmp2 > 0)
         costL2 += tmp2;
     }
@@ -137,11 +137,11 @@ void FastRouteCore::routeSegL(Segment* seg)
     if (costL1 < costL2) {
       // two parts (x1, y1)-(x1, y2) and (x1, y2)-(x2, y2)
       for (int i = ymin; i < ymax; i++) {
-        v_edges_[i][seg->x1].est_usage += edgeCost;
+        v_est_usage_[i][seg->x1] += edgeCost;
         v_used_ggrid_.insert(std::make_pair(i, seg->x1));
       }
       for (int i = seg->x1; i < seg->x2; i++) {
-        h_edges_[seg->y2][i].est_usage += edgeCost;
+        h_est_usage_[seg->y2][i] += edgeCost;
         h_used_ggrid_.insert(std::make_pair(seg->y2, i));
       }
       seg->xFirst = false;
@@ -149,11 +149,11 @@ void FastRouteCore::routeSegL(Segment* seg)
     else {
       // two parts (x1, y1)-(x2, y1) and (x2, y1)-(x2, y2)
       for (int i = seg->x1; i < seg->x2; i++) {
-        h_edges_[seg->y1][i].est_usage += edgeCost;
+        h_est_usage_[seg->y1][i] += edgeCost;
         h_used_ggrid_.insert(std::make_pair(seg->y1, i));
       }
       for (int i = ymin; i < ymax; i++) {
-        v_edges_[i][seg->x2].est_usage += edgeCost;
+        v_est_usage_[i][seg->x2] += edgeCost;
         v_used_ggrid_.insert(std::make_pair(i, seg->y2));
       }
       seg->xFirst = true;
@@ -171,23 +171,23 @@ void FastRouteCore::routeSegLFirstTime(Segment* seg)
   double costL2 = 0;
 
   for (int i = ymin; i < ymax; i++) {
-    const double tmp = v_edges_[i][seg->x1].est_usage_red() - v_capacity_lb_;
+    const double tmp = vEstUsageRed(i, seg->x1) - v_capacity_lb_;
     if (tmp > 0)
       costL1 += tmp;
   }
   for (int i = ymin; i < ymax; i++) {
-    const double tmp = v_edges_[i][seg->x2].est_usage_red() - v_capacity_lb_;
+    const double tmp = vEstUsageRed(i, seg->x2) - v_capacity_lb_;
     if (tmp > 0)
       costL2 += tmp;
   }
 
   for (int i = seg->x1; i < seg->x2; i++) {
-    const double tmp = h_edges_[seg->y2][i].est_usage_red() - h_capacity_lb_;
+    const double tmp = hEstUsageRed(seg->y2, i) - h_capacity_lb_;
     if (tmp > 0)
       costL1 += tmp;
   }
   for (int i = seg->x1; i < seg->x2; i++) {
-    const double tmp = h_edges_[seg->y1][i].est_usage_red() - h_capacity_lb_;
+    const double tmp = hEstUsageRed(seg->y1, i) - h_capacity_lb_;
     if (tmp > 0)
       costL2 += tmp;
   }
@@ -197,26 +197,26 @@ void FastRouteCore::routeSegLFirstTime(Segment* seg)
   if (costL1 < costL2) {
     // two parts (x1, y1)-(x1, y2) and (x1, y2)-(x2, y2)
     for (int i = ymin; i < ymax; i++) {
-      v_edges_[i][seg->x1].est_usage += edgeCost / 2.0f;
-      v_edges_[i][seg->x2].est_usage -= edgeCost / 2.0f;
+      v_est_usage_[i][seg->x1] += edgeCost / 2.0f;
+      v_est_usage_[i][seg->x2] -= edgeCost / 2.0f;
       v_used_ggrid_.insert(std::make_pair(i, seg->x1));
     }
     for (int i = seg->x1; i < seg->x2; i++) {
-      h_edges_[seg->y2][i].est_usage += edgeCost / 2.0f;
-      h_edges_[seg->y1][i].est_usage -= edgeCost / 2.0f;
+      h_est_usage_[seg->y2][i] += edgeCost / 2.0f;
+      h_est_usage_[seg->y1][i] -= edgeCost / 2.0f;
       h_used_ggrid_.insert(std::make_pair(seg->y2, i));
     }
     seg->xFirst = false;
   } else {
     // two parts (x1, y1)-(x2, y1) and (x2, y1)-(x2, y2)
     for (int i = seg->x1; i < seg->x2; i++) {
-      h_edges_[seg->y1][i].est_usage += edgeCost / 2.0f;
-      h_edges_[seg->y2][i].est_usage -= edgeCost / 2.0f;
+      h_est_usage_[seg->y1][i] += edgeCost / 2.0f;
+      h_est_usage_[seg->y2][i] -= edgeCost / 2.0f;
       h_used_ggrid_.insert(std::make_pair(seg->y1, i));
     }
     for (int i = ymin; i < ymax; i++) {
-      v_edges_[i][seg->x2].est_usage += edgeCost / 2.0f;
-      v_edges_[i][seg->x1].est_usage -= edgeCost / 2.0f;
+      v_est_usage_[i][seg->x2] += edgeCost / 2.0f;
+      v_est_usage_[i][seg->x1] -= edgeCost / 2.0f;
       v_used_ggrid_.insert(std::make_pair(i, seg->x2));
     }
     seg->xFirst = true;
@@ -288,7 +288,7 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
       if (x1 == x2)  // V-routing
       {
         for (int j = ymin; j < ymax; j++) {
-          v_edges_[j][x1].est_usage += edgeCost;
+          v_est_usage_[j][x1] += edgeCost;
           v_used_ggrid_.insert(std::make_pair(j, x1));
         }
         treeedge->route.xFirst = false;
@@ -301,7 +301,7 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
       } else if (y1 == y2)  // H-routing
       {
         for (int j = x1; j < x2; j++) {
-          h_edges_[y1][j].est_usage += edgeCost;
+          h_est_usage_[y1][j] += edgeCost;
           h_used_ggrid_.insert(std::make_pair(y1, j));
         }
         treeedge->route.xFirst = true;
@@ -339,18 +339,18 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
         }
 
         for (int j = ymin; j < ymax; j++) {
-          const double tmp1 = v_edges_[j][x1].est_usage_red() - v_capacity_lb_;
+          const double tmp1 = vEstUsageRed(j, x1) - v_capacity_lb_;
           if (tmp1 > 0)
             costL1 += tmp1;
-          const double tmp2 = v_edges_[j][x2].est_usage_red() - v_capacity_lb_;
+          const double tmp2 = vEstUsageRed(j, x2) - v_capacity_lb_;
           if (tmp2 > 0)
             costL2 += tmp2;
         }
         for (int j = x1; j < x2; j++) {
-          const double tmp1 = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
+          const double tmp1 = hEstUsageRed(y2, j) - h_capacity_lb_;
           if (tmp1 > 0)
             costL1 += tmp1;
-          const double tmp2 = h_edges_[y1][j].est_usage_red() - h_capacity_lb_;
+          const double tmp2 = hEstUsageRed(y1, j) - h_capacity_lb_;
           if (tmp2 > 0)
             costL2 += tmp2;
         }
@@ -365,11 +365,11 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
 
           // two parts (x1, y1)-(x1, y2) and (x1, y2)-(x2, y2)
           for (int j = ymin; j < ymax; j++) {
-            v_edges_[j][x1].est_usage += edgeCost;
+            v_est_usage_[j][x1] += edgeCost;
             v_used_ggrid_.insert(std::make_pair(j, x1));
           }
           for (int j = x1; j < x2; j++) {
-            h_edges_[y2][j].est_usage += edgeCost;
+            h_est_usage_[y2][j] += edgeCost;
             h_used_ggrid_.insert(std::make_pair(y2, j));
           }
           treeedge->route.xFirst = false;
@@ -384,11 +384,11 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
 
           // two parts (x1, y1)-(x2, y1) and (x2, y1)-(x2, y2)
           for (int j = x1; j < x2; j++) {
-            h_edges_[y1][j].est_usage += edgeCost;
+            h_est_usage_[y1][j] += edgeCost;
             h_used_ggrid_.insert(std::make_pair(y1, j));
           }
           for (int j = ymin; j < ymax; j++) {
-            v_edges_[j][x2].est_usage += edgeCost;
+            v_est_usage_[j][x2] += edgeCost;
             v_used_ggrid_.insert(std::make_pair(j, x2));
           }
           treeedge->route.xFirst = true;
@@ -470,7 +470,7 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   // cost for V-segs
   for (int i = x1; i <= x2; i++) {
     for (int j = ymin; j < ymax; j++) {
-      const double tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
+      const double tmp = vEstUsageRed(j, i) - v_capacity_lb_;
       if (tmp > 0) {
         cost_v_[i - x1] += tmp;
         cost_v_test_[i - x1] += HCOST;
@@ -481,7 +481,7 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   }
   // cost for Top&Bot boundary segs (form Z with V-seg)
   for (int j = x1; j < x2; j++) {
-    const double tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
+    const double tmp = hEstUsageRed(y2, j) - h_capacity_lb_;
     if (tmp > 0) {
       cost_tb_[0] += tmp;
       cost_tb_test_[0] += HCOST;
@@ -491,16 +491,14 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   }
   for (int i = 1; i <= segWidth; i++) {
     cost_tb_[i] = cost_tb_[i - 1];
-    const double tmp1
-        = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
+    const double tmp1 = hEstUsageRed(y1, x1 + i - 1) - h_capacity_lb_;
     if (tmp1 > 0) {
       cost_tb_[i] += tmp1;
       cost_tb_test_[i] += HCOST;
     } else {
       cost_tb_test_[i] += tmp1;
     }
-    const double tmp2
-        = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
+    const double tmp2 = hEstUsageRed(y2, x1 + i - 1) - h_capacity_lb_;
     if (tmp2 > 0) {
       cost_tb_[i] -= tmp2;
       cost_tb_test_[i] -= HCOST;
@@ -528,15 +526,15 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   }
 
   for (int i = x1; i < bestZ; i++) {
-    h_edges_[y1][i].est_usage += edgeCost;
+    h_est_usage_[y1][i] += edgeCost;
     h_used_ggrid_.insert(std::make_pair(y1, i));
   }
   for (int i = bestZ; i < x2; i++) {
-    h_edges_[y2][i].est_usage += edgeCost;
+    h_est_usage_[y2][i] += edgeCost;
     h_used_ggrid_.insert(std::make_pair(y2, i));
   }
   for (int i = ymin; i < ymax; i++) {
-    v_edges_[i][bestZ].est_usage += edgeCost;
+    v_est_usage_[i][bestZ] += edgeCost;
     v_used_ggrid_.insert(std::make_pair(i, bestZ));
   }
   treeedge->route.HVH = true;
@@ -650,7 +648,7 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         // cost for V-segs
         for (int i = x1; i < x2; i++) {
           for (int j = ymin; j < ymax; j++) {
-            const double tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
+            const double tmp = vEstUsageRed(j, i) - v_capacity_lb_;
             if (tmp > 0) {
               cost_v_[i - x1] += tmp;
               cost_v_test_[i - x1] += HCOST;
@@ -661,7 +659,7 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         }
         // cost for Top&Bot boundary segs (form Z with V-seg)
         for (int j = x1; j < x2; j++) {
-          const double tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
+          const double tmp = hEstUsageRed(y2, j) - h_capacity_lb_;
           if (tmp > 0) {
             cost_tb_[0] += tmp;
             cost_tb_test_[0] += HCOST;
@@ -671,16 +669,14 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         }
         for (int i = 1; i < segWidth; i++) {
           cost_tb_[i] = cost_tb_[i - 1];
-          const double tmp1
-              = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
+          const double tmp1 = hEstUsageRed(y1, x1 + i - 1) - h_capacity_lb_;
           if (tmp1 > 0) {
             cost_tb_[i] += tmp1;
             cost_tb_test_[0] += HCOST;
           } else {
             cost_tb_test_[0] += tmp1;
           }
-          const double tmp2
-              = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
+          const double tmp2 = hEstUsageRed(y2, x1 + i - 1) - h_capacity_lb_;
           if (tmp2 > 0) {
             cost_tb_[i] -= tmp2;
             cost_tb_test_[0] -= HCOST;
@@ -691,7 +687,7 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         // cost for H-segs
         for (int i = ymin; i < ymax; i++) {
           for (int j = x1; j < x2; j++) {
-            const double tmp = h_edges_[i][j].est_usage_red() - h_capacity_lb_;
+            const double tmp = hEstUsageRed(i, j) - h_capacity_lb_;
             if (tmp > 0)
               cost_h_[i - ymin] += tmp;
           }
@@ -699,35 +695,31 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         // cost for Left&Right boundary segs (form Z with H-seg)
         if (y1Smaller) {
           for (int j = y1; j < y2; j++) {
-            const double tmp = v_edges_[j][x2].est_usage_red() - v_capacity_lb_;
+            const double tmp = vEstUsageRed(j, x2) - v_capacity_lb_;
             if (tmp > 0)
               cost_lr_[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
             cost_lr_[i] = cost_lr_[i - 1];
-            const double tmp1
-                = v_edges_[y1 + i - 1][x1].est_usage_red() - v_capacity_lb_;
+            const double tmp1 = vEstUsageRed(y1 + i - 1, x1) - v_capacity_lb_;
             if (tmp1 > 0)
               cost_lr_[i] += tmp1;
-            const double tmp2
-                = v_edges_[y1 + i - 1][x2].est_usage_red() - v_capacity_lb_;
+            const double tmp2 = vEstUsageRed(y1 + i - 1, x2) - v_capacity_lb_;
             if (tmp2 > 0)
               cost_lr_[i] -= tmp2;
           }
         } else {
           for (int j = y2; j < y1; j++) {
-            const double tmp = v_edges_[j][x1].est_usage - v_capacity_lb_;
+            const double tmp = v_est_usage_[j][x1] - v_capacity_lb_;
             if (tmp > 0)
               cost_lr_[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
             cost_lr_[i] = cost_lr_[i - 1];
-            const double tmp1
-                = v_edges_[y2 + i - 1][x2].est_usage_red() - v_capacity_lb_;
+            const double tmp1 = vEstUsageRed(y2 + i - 1, x2) - v_capacity_lb_;
             if (tmp1 > 0)
               cost_lr_[i] += tmp1;
-            const double tmp2
-                = v_edges_[y2 + i - 1][x1].est_usage_red() - v_capacity_lb_;
+            const double tmp2 = vEstUsageRed(y2 + i - 1, x1) - v_capacity_lb_;
             if (tmp2 > 0)
               cost_lr_[i] -= tmp2;
           }
@@ -772,15 +764,15 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           treenodes[n2a].hID++;
 
           for (int i = x1; i < bestZ; i++) {
-            h_edges_[y1][i].est_usage += edgeCost;
+            h_est_usage_[y1][i] += edgeCost;
             h_used_ggrid_.insert(std::make_pair(y1, i));
           }
           for (int i = bestZ; i < x2; i++) {
-            h_edges_[y2][i].est_usage += edgeCost;
+            h_est_usage_[y2][i] += edgeCost;
             h_used_ggrid_.insert(std::make_pair(y2, i));
           }
           for (int i = ymin; i < ymax; i++) {
-            v_edges_[i][bestZ].est_usage += edgeCost;
+            v_est_usage_[i][bestZ] += edgeCost;
             v_used_ggrid_.insert(std::make_pair(i, bestZ));
           }
           treeedge->route.HVH = HVH;
@@ -797,30 +789,30 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           treenodes[n2a].lID++;
           if (y1Smaller) {
             for (int i = y1; i < bestZ; i++) {
-              v_edges_[i][x1].est_usage += edgeCost;
+              v_est_usage_[i][x1] += edgeCost;
               v_used_ggrid_.insert(std::make_pair(i, x1));
             }
             for (int i = bestZ; i < y2; i++) {
-              v_edges_[i][x2].est_usage += edgeCost;
+              v_est_usage_[i][x2] += edgeCost;
               v_used_ggrid_.insert(std::make_pair(i, x2));
             }
             for (int i = x1; i < x2; i++) {
-              h_edges_[bestZ][i].est_usage += edgeCost;
+              h_est_usage_[bestZ][i] += edgeCost;
               h_used_ggrid_.insert(std::make_pair(bestZ, i));
             }
             treeedge->route.HVH = HVH;
             treeedge->route.Zpoint = bestZ;
           } else {
             for (int i = y2; i < bestZ; i++) {
-              v_edges_[i][x2].est_usage += edgeCost;
+              v_est_usage_[i][x2] += edgeCost;
               v_used_ggrid_.insert(std::make_pair(i, x2));
             }
             for (int i = bestZ; i < y1; i++) {
-              v_edges_[i][x1].est_usage += edgeCost;
+              v_est_usage_[i][x1] += edgeCost;
               v_used_ggrid_.insert(std::make_pair(i, x1));
             }
             for (int i = x1; i < x2; i++) {
-              h_edges_[bestZ][i].est_usage += edgeCost;
+              h_est_usage_[bestZ][i] += edgeCost;
               h_used_ggrid_.insert(std::make_pair(bestZ, i));
             }
             treeedge->route.HVH = HVH;
@@ -885,7 +877,7 @@ void FastRouteCore::spiralRoute(int netID, int edgeID)
   treeedge->route.type = RouteType::LRoute;
   if (x1 == x2) {  // V-routing
     for (int j = ymin; j < ymax; j++) {
-      v_edges_[j][x1].est_usage += edgeCost;
+      v_est_usage_[j][x1] += edgeCost;
       v_used_ggrid_.insert(std::make_pair(j, x1));
     }
     treeedge->route.xFirst = false;
@@ -904,7 +896,7 @@ void FastRouteCore::spiralRoute(int netID, int edgeID)
     }
   } else if (y1 == y2) {  // H-routing
     for (int j = x1; j < x2; j++) {
-      h_edges_[y1][j].est_usage += edgeCost;
+      h_est_usage_[y1][j] += edgeCost;
       h_used_ggrid_.insert(std::make_pair(y1, j));
     }
     treeedge->route.xFirst = true;
@@ -942,18 +934,18 @@ void FastRouteCore::spiralRoute(int netID, int edgeID)
     }
 
     for (int j = ymin; j < ymax; j++) {
-      const double tmp1 = v_edges_[j][x1].est_usage_red() - v_capacity_lb_;
+      const double tmp1 = vEstUsageRed(j, x1) - v_capacity_lb_;
       if (tmp1 > 0)
         costL1 += tmp1;
-      const double tmp2 = v_edges_[j][x2].est_usage_red() - v_capacity_lb_;
+      const double tmp2 = vEstUsageRed(j, x2) - v_capacity_lb_;
       if (tmp2 > 0)
         costL2 += tmp2;
     }
     for (int j = x1; j < x2; j++) {
-      const double tmp1 = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
+      const double tmp1 = hEstUsageRed(y2, j) - h_capacity_lb_;
       if (tmp1 > 0)
         costL1 += tmp1;
-      const double tmp2 = h_edges_[y1][j].est_usage_red() - h_capacity_lb_;
+      const double tmp2 = hEstUsageRed(y1, j) - h_capacity_lb_;
       if (tmp2 > 0)
         costL2 += tmp2;
     }
@@ -977,11 +969,11 @@ void FastRouteCore::spiralRoute(int netID, int edgeID)
 
       // two parts (x1, y1)-(x1, y2) and (x1, y2)-(x2, y2)
       for (int j = ymin; j < ymax; j++) {
-        v_edges_[j][x1].est_usage += edgeCost;
+        v_est_usage_[j][x1] += edgeCost;
         v_used_ggrid_.insert(std::make_pair(j, x1));
       }
       for (int j = x1; j < x2; j++) {
-        h_edges_[y2][j].est_usage += edgeCost;
+        h_est_usage_[y2][j] += edgeCost;
         h_used_ggrid_.insert(std::make_pair(y2, j));
       }
       treeedge->route.xFirst = false;
@@ -1005,11 +997,11 @@ void FastRouteCore::spiralRoute(int netID, int edgeID)
 
       // two parts (x1, y1)-(x2, y1) and (x2, y1)-(x2, y2)
       for (int j = x1; j < x2; j++) {
-        h_edges_[y1][j].est_usage += edgeCost;
+        h_est_usage_[y1][j] += edgeCost;
         h_used_ggrid_.insert(std::make_pair(y1, j));
       }
       for (int j = ymin; j < ymax; j++) {
-        v_edges_[j][x2].est_usage += edgeCost;
+        v_est_usage_[j][x2] += edgeCost;
         v_used_ggrid_.insert(std::make_pair(j, x2));
       }
       treeedge->route.xFirst = true;
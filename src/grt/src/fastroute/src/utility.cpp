@@ -442,7 +442,10 @@ void FastRouteCore::fixEdgeAssignment(int& net_layer,
   }
 }
 
-void FastRouteCore::assignEdge(int netID, int edgeID, bool processDIR)
+bool FastRouteCore::assignEdge(int netID,
+                               int edgeID,
+                               bool processDIR,
+                               int& bad_layer)
 {
   std::vector<std::vector<long>> gridD;
   int i, k, l, min_x, min_y, routelen, n1a, n2a, last_layer;
@@ -703,10 +706,8 @@ void FastRouteCore::assignEdge(int netID, int edgeID, bool processDIR)
     if (treenodes[n2a].assigned) {
       if (gridsL[routelen] > treenodes[n2a].topL
           || gridsL[routelen] < treenodes[n2a].botL) {
-        logger_->error(GRT,
-                       202,
-                       "Target ending layer ({}) out of range.",
-                       gridsL[routelen]);
+        bad_layer = gridsL[routelen];
+        return false;
       }
     }
 
@@ -828,16 +829,12 @@ void FastRouteCore::assignEdge(int netID, int edgeID, bool processDIR)
           += net->getLayerEdgeCost(gridsL[k]);
     }
   }
+  return true;
 }
 
 void FastRouteCore::layerAssignmentV4()
 {
-  int i, k, edgeID, nodeID, routeLen;
-  int n1, n2, connectionCNT;
-
-  int n1a, n2a;
-  std::queue<int> edgeQueue;
-
+  int edgeID, routeLen;
   TreeEdge* treeedge;
 
   for (const int& netID : net_ids_) {
@@ -853,119 +850,215 @@ void FastRouteCore::layerAssignmentV4()
   }
   netpinOrderInc();
 
-  for (i = 0; i < tree_order_pv_.size(); i++) {
-    int netID = tree_order_pv_[i].treeIndex;
+  // logger_->error throws, which must not happen inside a parallel region,
+  // so the failures are reported by the calling thread.
+  auto reportLayerOutOfRange = [this](const int layer) {
+    logger_->error(GRT, 202, "Target ending layer ({}) out of range.", layer);
+  };
 
-    auto& treeedges = sttrees_[netID].edges;
-    auto& treenodes = sttrees_[netID].nodes;
-    const int num_terminals = sttrees_[netID].num_terminals;
+  if (num_threads_ <= 1) {
+    for (const OrderNetPin& order : tree_order_pv_) {
+      int bad_layer;
+      if (!assignNetLayers(order.treeIndex, bad_layer)) {
+        reportLayerOutOfRange(bad_layer);
+      }
+    }
+    return;
+  }
+
+  // Nets are grouped in batches of consecutive nets, in the serial order,
+  // whose routes do not share any gcell. The nets in a batch read and
+  // update disjoint 3D edges, so they are assigned concurrently with the
+  // same result as the serial assignment.
+  std::vector<int> gcell_batch(x_grid_ * y_grid_, -1);
+  std::vector<int> batch;
+  int batch_id = 0;
+  auto assignBatch = [&]() {
+    const int batch_size = batch.size();
+    // Layer of the failed edge of each net, -1 when the net was assigned.
+    std::vector<int> bad_layers(batch_size, -1);
+    if (batch_size == 1) {
+      assignNetLayers(batch[0], bad_layers[0]);
+    } else {
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+      for (int j = 0; j < batch_size; j++) {
+        assignNetLayers(batch[j], bad_layers[j]);
+      }
+    }
+    for (const int bad_layer : bad_layers) {
+      if (bad_layer != -1) {
+        reportLayerOutOfRange(bad_layer);
+      }
+    }
+    batch.clear();
+    batch_id++;
+  };
+
+  for (const OrderNetPin& order : tree_order_pv_) {
+    const int netID = order.treeIndex;
+    if (!claimNetFootprint(netID, batch_id, gcell_batch)) {
+      assignBatch();
+      claimNetFootprint(netID, batch_id, gcell_batch);
+    }
+    batch.push_back(netID);
+  }
+  assignBatch();
+}
 
-    for (nodeID = 0; nodeID < num_terminals; nodeID++) {
-      for (k = 0; k < treenodes[nodeID].conCNT; k++) {
-        edgeID = treenodes[nodeID].eID[k];
-        if (!treeedges[edgeID].assigned) {
-          edgeQueue.push(edgeID);
-          treeedges[edgeID].assigned = true;
+bool FastRouteCore::claimNetFootprint(const int netID,
+                                      const int batch,
+                                      std::vector<int>& gcell_batch)
+{
+  const auto& treeedges = sttrees_[netID].edges;
+  const int num_edges = sttrees_[netID].num_edges();
+  for (int edgeID = 0; edgeID < num_edges; edgeID++) {
+    const TreeEdge& treeedge = treeedges[edgeID];
+    if (treeedge.len > 0) {
+      const std::vector<short>& gridsX = treeedge.route.gridsX;
+      const std::vector<short>& gridsY = treeedge.route.gridsY;
+      for (int k = 0; k <= treeedge.route.routelen; k++) {
+        if (gcell_batch[gridsY[k] * x_grid_ + gridsX[k]] == batch) {
+          return false;
         }
       }
     }
+  }
 
-    while (!edgeQueue.empty()) {
-      edgeID = edgeQueue.front();
-      edgeQueue.pop();
-      treeedge = &(treeedges[edgeID]);
-      if (treenodes[treeedge->n1a].assigned) {
-        assignEdge(netID, edgeID, 1);
-        treeedge->assigned = true;
-        if (!treenodes[treeedge->n2a].assigned) {
-          for (k = 0; k < treenodes[treeedge->n2a].conCNT; k++) {
-            edgeID = treenodes[treeedge->n2a].eID[k];
-            if (!treeedges[edgeID].assigned) {
-              edgeQueue.push(edgeID);
-              treeedges[edgeID].assigned = true;
-            }
+  for (int edgeID = 0; edgeID < num_edges; edgeID++) {
+    const TreeEdge& treeedge = treeedges[edgeID];
+    if (treeedge.len > 0) {
+      const std::vector<short>& gridsX = treeedge.route.gridsX;
+      const std::vector<short>& gridsY = treeedge.route.gridsY;
+      for (int k = 0; k <= treeedge.route.routelen; k++) {
+        gcell_batch[gridsY[k] * x_grid_ + gridsX[k]] = batch;
+      }
+    }
+  }
+  return true;
+}
+
+bool FastRouteCore::assignNetLayers(const int netID, int& bad_layer)
+{
+  int k, edgeID, nodeID, routeLen;
+  int n1, n2, connectionCNT;
+  int n1a, n2a;
+  std::queue<int> edgeQueue;
+  TreeEdge* treeedge;
+
+  auto& treeedges = sttrees_[netID].edges;
+  auto& treenodes = sttrees_[netID].nodes;
+  const int num_terminals = sttrees_[netID].num_terminals;
+
+  for (nodeID = 0; nodeID < num_terminals; nodeID++) {
+    for (k = 0; k < treenodes[nodeID].conCNT; k++) {
+      edgeID = treenodes[nodeID].eID[k];
+      if (!treeedges[edgeID].assigned) {
+        edgeQueue.push(edgeID);
+        treeedges[edgeID].assigned = true;
+      }
+    }
+  }
+
+  while (!edgeQueue.empty()) {
+    edgeID = edgeQueue.front();
+    edgeQueue.pop();
+    treeedge = &(treeedges[edgeID]);
+    if (treenodes[treeedge->n1a].assigned) {
+      if (!assignEdge(netID, edgeID, 1, bad_layer)) {
+        return false;
+      }
+      treeedge->assigned = true;
+      if (!treenodes[treeedge->n2a].assigned) {
+        for (k = 0; k < treenodes[treeedge->n2a].conCNT; k++) {
+          edgeID = treenodes[treeedge->n2a].eID[k];
+          if (!treeedges[edgeID].assigned) {
+            edgeQueue.push(edgeID);
+            treeedges[edgeID].assigned = true;
           }
-          treenodes[treeedge->n2a].assigned = true;
         }
-      } else {
-        assignEdge(netID, edgeID, 0);
-        treeedge->assigned = true;
-        if (!treenodes[treeedge->n1a].assigned) {
-          for (k = 0; k < treenodes[treeedge->n1a].conCNT; k++) {
-            edgeID = treenodes[treeedge->n1a].eID[k];
-            if (!treeedges[edgeID].assigned) {
-              edgeQueue.push(edgeID);
-              treeedges[edgeID].assigned = true;
-            }
+        treenodes[treeedge->n2a].assigned = true;
+      }
+    } else {
+      if (!assignEdge(netID, edgeID, 0, bad_layer)) {
+        return false;
+      }
+      treeedge->assigned = true;
+      if (!treenodes[treeedge->n1a].assigned) {
+        for (k = 0; k < treenodes[treeedge->n1a].conCNT; k++) {
+          edgeID = treenodes[treeedge->n1a].eID[k];
+          if (!treeedges[edgeID].assigned) {
+            edgeQueue.push(edgeID);
+            treeedges[edgeID].assigned = true;
           }
-          treenodes[treeedge->n1a].assigned = true;
         }
+        treenodes[treeedge->n1a].assigned = true;
       }
     }
+  }
 
-    for (nodeID = 0; nodeID < sttrees_[netID].num_nodes(); nodeID++) {
-      treenodes[nodeID].topL = -1;
-      treenodes[nodeID].botL = num_layers_;
-      treenodes[nodeID].conCNT = 0;
-      treenodes[nodeID].hID = BIG_INT;
-      treenodes[nodeID].lID = BIG_INT;
-      treenodes[nodeID].status = 0;
-      treenodes[nodeID].assigned = false;
+  for (nodeID = 0; nodeID < sttrees_[netID].num_nodes(); nodeID++) {
+    treenodes[nodeID].topL = -1;
+    treenodes[nodeID].botL = num_layers_;
+    treenodes[nodeID].conCNT = 0;
+    treenodes[nodeID].hID = BIG_INT;
+    treenodes[nodeID].lID = BIG_INT;
+    treenodes[nodeID].status = 0;
+    treenodes[nodeID].assigned = false;
 
-      if (nodeID < num_terminals) {
-        treenodes[nodeID].botL = nets_[netID]->getPinL()[nodeID];
-        treenodes[nodeID].topL = nets_[netID]->getPinL()[nodeID];
-        treenodes[nodeID].assigned = true;
-        treenodes[nodeID].status = 1;
-      }
+    if (nodeID < num_terminals) {
+      treenodes[nodeID].botL = nets_[netID]->getPinL()[nodeID];
+      treenodes[nodeID].topL = nets_[netID]->getPinL()[nodeID];
+      treenodes[nodeID].assigned = true;
+      treenodes[nodeID].status = 1;
     }
+  }
 
-    for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
-      treeedge = &(treeedges[edgeID]);
+  for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
+    treeedge = &(treeedges[edgeID]);
 
-      if (treeedge->len > 0) {
-        routeLen = treeedge->route.routelen;
+    if (treeedge->len > 0) {
+      routeLen = treeedge->route.routelen;
 
-        n1 = treeedge->n1;
-        n2 = treeedge->n2;
-        const std::vector<short>& gridsL = treeedge->route.gridsL;
+      n1 = treeedge->n1;
+      n2 = treeedge->n2;
+      const std::vector<short>& gridsL = treeedge->route.gridsL;
 
-        n1a = treenodes[n1].stackAlias;
-        n2a = treenodes[n2].stackAlias;
-        connectionCNT = treenodes[n1a].conCNT;
-        treenodes[n1a].heights[connectionCNT] = gridsL[0];
-        treenodes[n1a].eID[connectionCNT] = edgeID;
-        treenodes[n1a].conCNT++;
+      n1a = treenodes[n1].stackAlias;
+      n2a = treenodes[n2].stackAlias;
+      connectionCNT = treenodes[n1a].conCNT;
+      treenodes[n1a].heights[connectionCNT] = gridsL[0];
+      treenodes[n1a].eID[connectionCNT] = edgeID;
+      treenodes[n1a].conCNT++;
 
-        if (gridsL[0] > treenodes[n1a].topL) {
-          treenodes[n1a].hID = edgeID;
-          treenodes[n1a].topL = gridsL[0];
-        }
-        if (gridsL[0] < treenodes[n1a].botL) {
-          treenodes[n1a].lID = edgeID;
-          treenodes[n1a].botL = gridsL[0];
-        }
+      if (gridsL[0] > treenodes[n1a].topL) {
+        treenodes[n1a].hID = edgeID;
+        treenodes[n1a].topL = gridsL[0];
+      }
+      if (gridsL[0] < treenodes[n1a].botL) {
+        treenodes[n1a].lID = edgeID;
+        treenodes[n1a].botL = gridsL[0];
+      }
 
-        treenodes[n1a].assigned = true;
+      treenodes[n1a].assigned = true;
 
-        connectionCNT = treenodes[n2a].conCNT;
-        treenodes[n2a].heights[connectionCNT] = gridsL[routeLen];
-        treenodes[n2a].eID[connectionCNT] = edgeID;
-        treenodes[n2a].conCNT++;
-        if (gridsL[routeLen] > treenodes[n2a].topL) {
-          treenodes[n2a].hID = edgeID;
-          treenodes[n2a].topL = gridsL[routeLen];
-        }
-        if (gridsL[routeLen] < treenodes[n2a].botL) {
-          treenodes[n2a].lID = edgeID;
-          treenodes[n2a].botL = gridsL[routeLen];
-        }
+      connectionCNT = treenodes[n2a].conCNT;
+      treenodes[n2a].heights[connectionCNT] = gridsL[routeLen];
+      treenodes[n2a].eID[connectionCNT] = edgeID;
+      treenodes[n2a].conCNT++;
+      if (gridsL[routeLen] > treenodes[n2a].topL) {
+        treenodes[n2a].hID = edgeID;
+        treenodes[n2a].topL = gridsL[routeLen];
+      }
+      if (gridsL[routeLen] < treenodes[n2a].botL) {
+        treenodes[n2a].lID = edgeID;
+        treenodes[n2a].botL = gridsL[routeLen];
+      }
 
-        treenodes[n2a].assigned = true;
+      treenodes[n2a].assigned = true;
 
-      }  // edge len > 0
-    }    // eunmerating edges
-  }
+    }  // edge len > 0
+  }    // eunmerating edges
+  return true;
 }
 
 void FastRouteCore::layerAssignment()
@@ -1607,23 +1700,23 @@ void FastRouteCore::verify2DEdgesUsage()
   }
   for (int y = 0; y < y_grid_ - 1; ++y) {
     for (int x = 0; x < x_grid_; ++x) {
-      if (v_edges[y][x] != v_edges_[y][x].est_usage) {
+      if (v_edges[y][x] != v_est_usage_[y][x]) {
         logger_->error(GRT,
                        247,
                        "v_edge mismatch {} vs {}",
                        v_edges[y][x],
-                       v_edges_[y][x].est_usage);
+                       v_est_usage_[y][x]);
       }
     }
   }
   for (int y = 0; y < y_grid_; ++y) {
     for (int x = 0; x < x_grid_ - 1; ++x) {
-      if (h_edges[y][x] != h_edges_[y][x].est_usage) {
+      if (h_edges[y][x] != h_est_usage_[y][x]) {
         logger_->error(GRT,
                        248,
                        "h_edge mismatch {} vs {}",
                        h_edges[y][x],
-                       h_edges_[y][x].est_usage);
+                       h_est_usage_[y][x]);
       }
     }
   }
@@ -2137,7 +2230,7 @@ int FastRouteCore::edgeShift(Tree& t, int net)
           for (j = minY; j <= maxY; j++) {
             costH[j] = 0;
             for (k = t.branch[n1].x; k < t.branch[n2].x; k++) {
-              costH[j] += h_edges_[j][k].est_usage;
+              costH[j] += h_est_usage_[j][k];
             }
             // add the cost of all edges adjacent to the two steiner nodes
             for (l = 0; l < nbrCnt[n1]; l++) {
@@ -2160,12 +2253,12 @@ int FastRouteCore::edgeShift(Tree& t, int net)
                   bigY = j;
                 }
                 for (m = smallX; m < bigX; m++) {
-                  cost1 += h_edges_[smallY][m].est_usage;
-                  cost2 += h_edges_[bigY][m].est_usage;
+                  cost1 += h_est_usage_[smallY][m];
+                  cost2 += h_est_usage_[bigY][m];
                 }
                 for (m = smallY; m < bigY; m++) {
-                  cost1 += v_edges_[m][bigX].est_usage;
-                  cost2 += v_edges_[m][smallX].est_usage;
+                  cost1 += v_est_usage_[m][bigX];
+                  cost2 += v_est_usage_[m][smallX];
                 }
                 costH[j] += std::min(cost1, cost2);
               }  // if(n3!=n2)
@@ -2190,12 +2283,12 @@ int FastRouteCore::edgeShift(Tree& t, int net)
                   bigY = j;
                 }
                 for (m = smallX; m < bigX; m++) {
-                  cost1 += h_edges_[smallY][m].est_usage;
-                  cost2 += h_edges_[bigY][m].est_usage;
+                  cost1 += h_est_usage_[smallY][m];
+                  cost2 += h_est_usage_[bigY][m];
                 }
                 for (m = smallY; m < bigY; m++) {
-                  cost1 += v_edges_[m][bigX].est_usage;
-                  cost2 += v_edges_[m][smallX].est_usage;
+                  cost1 += v_est_usage_[m][bigX];
+                  cost2 += v_est_usage_[m][smallX];
                 }
                 costH[j] += std::min(cost1, cost2);
               }  // if(n3!=n1)
@@ -2248,7 +2341,7 @@ int FastRouteCore::edgeShift(Tree& t, int net)
           for (j = minX; j <= maxX; j++) {
             costV[j] = 0;
             for (k = t.branch[n1].y; k < t.branch[n2].y; k++) {
-              costV[j] += v_edges_[k][j].est_usage;
+              costV[j] += v_est_usage_[k][j];
             }
             // add the cost of all edges adjacent to the two steiner nodes
             for (l = 0; l < nbrCnt[n1]; l++) {
@@ -2271,12 +2364,12 @@ int FastRouteCore::edgeShift(Tree& t, int net)
                   bigY = t.branch[n1].y;
                 }
                 for (m = smallX; m < bigX; m++) {
-                  cost1 += h_edges_[smallY][m].est_usage;
-                  cost2 += h_edges_[bigY][m].est_usage;
+                  cost1 += h_est_usage_[smallY][m];
+                  cost2 += h_est_usage_[bigY][m];
                 }
                 for (m = smallY; m < bigY; m++) {
-                  cost1 += v_edges_[m][bigX].est_usage;
-                  cost2 += v_edges_[m][smallX].est_usage;
+                  cost1 += v_est_usage_[m][bigX];
+                  cost2 += v_est_usage_[m][smallX];
                 }
                 costV[j] += std::min(cost1, cost2);
               }  // if(n3!=n2)
@@ -2301,12 +2394,12 @@ int FastRouteCore::edgeShift(Tree& t, int net)
                   bigY = t.branch[n2].y;
                 }
                 for (m = smallX; m < bigX; m++) {
-                  cost1 += h_edges_[smallY][m].est_usage;
-                  cost2 += h_edges_[bigY][m].est_usage;
+                  cost1 += h_est_usage_[smallY][m];
+                  cost2 += h_est_usage_[bigY][m];
                 }
                 for (m = smallY; m < bigY; m++) {
-                  cost1 += v_edges_[m][bigX].est_usage;
-                  cost2 += v_edges_[m][smallX].est_usage;
+                  cost1 += v_est_usage_[m][bigX];
+                  cost2 += v_est_usage_[m][smallX];
                 }
                 costV[j] += std::min(cost1, cost2);
               }  // if(n3!=n1)
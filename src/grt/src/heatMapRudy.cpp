@@ -130,7 +130,7 @@ bool RUDYDataSource::populateMap()
     return false;
   }
 
-  rudy_->calculateRudy();
+  rudy_->updateRudy();
 
   for (int x = 0; x < x_grid_size; ++x) {
     for (int y = 0; y < y_grid_size; ++y) {
@@ -0,0 +1,136 @@
+// Measures the memory footprint and routing throughput of global routing on
+// a large grid. The gcd placement is spread over a die scale times wider
+// and taller, so the routing grid has about scale^2 times more gcells and
+// the nets span long maze searches.
+//
+// Usage (from src/grt/test): BenchGlobalRoute [scale]
+// ctest runs it on a small scale; it fails if no net is routed.
+
+#include <sys/resource.h>
+#include <tcl.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "AbstractRoutingCongestionDataSource.h"
+#include "db_sta/MakeDbSta.hh"
+#include "db_sta/dbSta.hh"
+#include "grt/GRoute.h"
+#include "grt/GlobalRouter.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "sta/Sta.hh"
+#include "stt/SteinerTreeBuilder.h"
+#include "utl/Logger.h"
+#include "utl/deleter.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The heat maps live in the gui, which the benchmark does not load.
+class NullCongestionDataSource : public grt::AbstractRoutingCongestionDataSource
+{
+ public:
+  void registerHeatMap() override {}
+  void update() override {}
+};
+
+// Peak resident set size of the process in MB.
+double peakRssMB()
+{
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+// Scales the die and the instance locations about the die origin.
+void spreadPlacement(odb::dbBlock* block, const int scale)
+{
+  const odb::Rect die = block->getDieArea();
+  for (odb::dbInst* inst : block->getInsts()) {
+    const odb::Point loc = inst->getLocation();
+    inst->setLocation(die.xMin() + (loc.x() - die.xMin()) * scale,
+                      die.yMin() + (loc.y() - die.yMin()) * scale);
+  }
+  block->setDieArea(odb::Rect(die.xMin(),
+                              die.yMin(),
+                              die.xMin() + die.dx() * scale,
+                              die.yMin() + die.dy() * scale));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const int scale = argc > 1 ? std::atoi(argv[1]) : 40;
+
+  utl::Logger logger;
+  utl::deleted_unique_ptr<odb::dbDatabase> db(odb::dbDatabase::create(),
+                                              &odb::dbDatabase::destroy);
+  sta::initSta();
+  std::unique_ptr<sta::dbSta> sta(ord::makeDbSta());
+  sta->initVars(Tcl_CreateInterp(), db.get(), &logger);
+
+  odb::lefin lef_reader(db.get(), &logger, /*ignore_non_routing_layers*/ false);
+  odb::dbLib* lib = lef_reader.createTechAndLib(
+      "Nangate45", "Nangate45.lef", "./Nangate45/Nangate45.lef");
+  sta->postReadLef(/*tech=*/nullptr, lib);
+
+  odb::defin def_reader(db.get(), &logger);
+  std::vector<odb::dbLib*> search_libs = {lib};
+  odb::dbChip* chip
+      = def_reader.createChip(search_libs, "./gcd.def", db->getTech());
+  odb::dbBlock* block = chip->getBlock();
+  sta->postReadDef(block);
+  spreadPlacement(block, scale);
+
+  stt::SteinerTreeBuilder stt;
+  stt.init(db.get(), &logger);
+  grt::GlobalRouter grouter;
+  grouter.init(&logger,
+               &stt,
+               db.get(),
+               sta.get(),
+               /*resizer=*/nullptr,
+               /*antenna_checker=*/nullptr,
+               /*opendp=*/nullptr,
+               std::make_unique<NullCongestionDataSource>(),
+               std::make_unique<NullCongestionDataSource>());
+  grouter.setAllowCongestion(true);
+  // Reports the size of the 3D maze buffers.
+  logger.setDebugLevel(utl::GRT, "memory", 1);
+
+  const double rss_before = peakRssMB();
+  const auto start = Clock::now();
+  grouter.globalRoute();
+  const double route_time
+      = std::chrono::duration<double>(Clock::now() - start).count();
+
+  int x_grids, y_grids;
+  grouter.getGridSize(x_grids, y_grids);
+  size_t num_segments = 0;
+  for (const auto& [db_net, route] : grouter.getRoutes()) {
+    num_segments += route.size();
+  }
+
+  std::printf("scale %d grid %dx%dx%d nets %zu segments %zu\n",
+              scale,
+              x_grids,
+              y_grids,
+              grouter.getMaxRoutingLayer(),
+              grouter.getRoutes().size(),
+              num_segments);
+  std::printf("global route %8.2f s, %.0f segments/s\n",
+              route_time,
+              num_segments / route_time);
+  std::printf("peak RSS %8.1f MB (%.1f MB before routing)\n",
+              peakRssMB(),
+              rss_before);
+
+  return num_segments > 0 ? 0 : 1;
+}
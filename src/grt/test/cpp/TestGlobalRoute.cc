@@ -0,0 +1,137 @@
+#include <tcl.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AbstractRoutingCongestionDataSource.h"
+#include "db_sta/MakeDbSta.hh"
+#include "db_sta/dbSta.hh"
+#include "grt/GRoute.h"
+#include "grt/GlobalRouter.h"
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "sta/Sta.hh"
+#include "stt/SteinerTreeBuilder.h"
+#include "utl/Logger.h"
+#include "utl/deleter.h"
+
+namespace grt {
+
+namespace {
+
+std::once_flag init_sta_flag;
+
+// The heat maps live in the gui, which the test does not load.
+class NullCongestionDataSource : public AbstractRoutingCongestionDataSource
+{
+ public:
+  void registerHeatMap() override {}
+  void update() override {}
+};
+
+class GlobalRouteTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    db_ = utl::deleted_unique_ptr<odb::dbDatabase>(odb::dbDatabase::create(),
+                                                   &odb::dbDatabase::destroy);
+    std::call_once(init_sta_flag, []() { sta::initSta(); });
+    sta_ = std::unique_ptr<sta::dbSta>(ord::makeDbSta());
+    sta_->initVars(Tcl_CreateInterp(), db_.get(), &logger_);
+
+    odb::lefin lef_reader(
+        db_.get(), &logger_, /*ignore_non_routing_layers*/ false);
+    odb::dbLib* lib = lef_reader.createTechAndLib(
+        "Nangate45", "Nangate45.lef", "./Nangate45/Nangate45.lef");
+    sta_->postReadLef(/*tech=*/nullptr, lib);
+
+    odb::defin def_reader(db_.get(), &logger_);
+    std::vector<odb::dbLib*> search_libs = {lib};
+    odb::dbChip* chip
+        = def_reader.createChip(search_libs, "./gcd.def", db_->getTech());
+    block_ = chip->getBlock();
+    sta_->postReadDef(block_);
+
+    stt_.init(db_.get(), &logger_);
+    grouter_.init(&logger_,
+                  &stt_,
+                  db_.get(),
+                  sta_.get(),
+                  /*resizer=*/nullptr,
+                  /*antenna_checker=*/nullptr,
+                  /*opendp=*/nullptr,
+                  std::make_unique<NullCongestionDataSource>(),
+                  std::make_unique<NullCongestionDataSource>());
+  }
+
+  // Stretches the die of gcd so the routing grid is about three times
+  // longer in one direction than in the other.
+  void stretchDie(const bool horizontal)
+  {
+    const odb::Rect die = block_->getDieArea();
+    const int width = horizontal ? die.dx() * 3 : die.dx();
+    const int height = horizontal ? die.dy() : die.dy() * 3;
+    block_->setDieArea(odb::Rect(
+        die.xMin(), die.yMin(), die.xMin() + width, die.yMin() + height));
+  }
+
+  // Every net is routed with gcell steps and vias that stay inside the
+  // die and the routing layers. A wrong decoding of the 3D maze indices
+  // breaks these steps on a non-square grid.
+  void checkRoutes()
+  {
+    const odb::Rect die = block_->getDieArea();
+    const int tile_size = grouter_.getTileSize();
+    const int max_layer = grouter_.getMaxRoutingLayer();
+    NetRouteMap& routes = grouter_.getRoutes();
+    EXPECT_FALSE(routes.empty());
+    for (auto& [db_net, route] : routes) {
+      for (const GSegment& seg : route) {
+        EXPECT_TRUE(die.intersects(odb::Point(seg.init_x, seg.init_y)))
+            << db_net->getName();
+        EXPECT_TRUE(die.intersects(odb::Point(seg.final_x, seg.final_y)))
+            << db_net->getName();
+        EXPECT_GE(std::min(seg.init_layer, seg.final_layer), 1);
+        EXPECT_LE(std::max(seg.init_layer, seg.final_layer), max_layer);
+        if (!seg.isVia()) {
+          EXPECT_EQ(seg.init_layer, seg.final_layer) << db_net->getName();
+          EXPECT_EQ(std::abs(seg.final_x - seg.init_x)
+                        + std::abs(seg.final_y - seg.init_y),
+                    tile_size)
+              << db_net->getName();
+        }
+      }
+    }
+  }
+
+  utl::Logger logger_;
+  utl::deleted_unique_ptr<odb::dbDatabase> db_;
+  std::unique_ptr<sta::dbSta> sta_;
+  stt::SteinerTreeBuilder stt_;
+  GlobalRouter grouter_;
+  odb::dbBlock* block_ = nullptr;
+};
+
+TEST_F(GlobalRouteTest, RoutesWideGrid)
+{
+  stretchDie(/*horizontal=*/true);
+  grouter_.globalRoute();
+  checkRoutes();
+}
+
+TEST_F(GlobalRouteTest, RoutesTallGrid)
+{
+  stretchDie(/*horizontal=*/false);
+  grouter_.globalRoute();
+  checkRoutes();
+}
+
+}  // namespace
+
+}  // namespace grt
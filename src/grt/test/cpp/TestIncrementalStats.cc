@@ -0,0 +1,64 @@
+#include "grt/IncrementalStats.h"
+
+#include "gtest/gtest.h"
+
+namespace grt {
+
+TEST(IncrementalStatsTest, UpdatesOutsideSessionsAreIgnored)
+{
+  IncrementalStats stats;
+  stats.recordUpdate(3, 1.0);
+  EXPECT_EQ(stats.depth(), 0);
+
+  stats.beginSession();
+  const IncrementalStats::Session session = stats.endSession();
+  EXPECT_EQ(session.updates, 0);
+  EXPECT_EQ(session.rerouted_nets, 0);
+  EXPECT_DOUBLE_EQ(session.seconds, 0.0);
+}
+
+TEST(IncrementalStatsTest, SessionCountsItsUpdates)
+{
+  IncrementalStats stats;
+  stats.beginSession();
+  stats.recordUpdate(3, 0.5);
+  stats.recordUpdate(2, 0.25);
+  const IncrementalStats::Session session = stats.endSession();
+  EXPECT_EQ(session.updates, 2);
+  EXPECT_EQ(session.rerouted_nets, 5);
+  EXPECT_DOUBLE_EQ(session.seconds, 0.75);
+  EXPECT_EQ(stats.depth(), 0);
+}
+
+// A nested session must not reset the enclosing one, and its updates are
+// part of the enclosing session.
+TEST(IncrementalStatsTest, NestedSessionAddsToEnclosingSession)
+{
+  IncrementalStats stats;
+  stats.beginSession();
+  stats.recordUpdate(4, 1.0);
+
+  stats.beginSession();
+  EXPECT_EQ(stats.depth(), 2);
+  stats.recordUpdate(1, 0.5);
+  const IncrementalStats::Session inner = stats.endSession();
+  EXPECT_EQ(inner.updates, 1);
+  EXPECT_EQ(inner.rerouted_nets, 1);
+  EXPECT_DOUBLE_EQ(inner.seconds, 0.5);
+
+  stats.recordUpdate(2, 0.25);
+  const IncrementalStats::Session outer = stats.endSession();
+  EXPECT_EQ(outer.updates, 3);
+  EXPECT_EQ(outer.rerouted_nets, 7);
+  EXPECT_DOUBLE_EQ(outer.seconds, 1.75);
+}
+
+TEST(IncrementalStatsTest, EndWithoutSessionIsEmpty)
+{
+  IncrementalStats stats;
+  const IncrementalStats::Session session = stats.endSession();
+  EXPECT_EQ(session.updates, 0);
+  EXPECT_EQ(stats.depth(), 0);
+}
+
+}  // namespace grt
@@ -0,0 +1,161 @@
+#include <tcl.h>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "AbstractRoutingCongestionDataSource.h"
+#include "db_sta/MakeDbSta.hh"
+#include "db_sta/dbSta.hh"
+#include "grt/GlobalRouter.h"
+#include "grt/Rudy.h"
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "sta/Sta.hh"
+#include "stt/SteinerTreeBuilder.h"
+#include "utl/Logger.h"
+#include "utl/deleter.h"
+
+namespace grt {
+
+namespace {
+
+std::once_flag init_sta_flag;
+
+// The heat maps live in the gui, which the test does not load.
+class NullCongestionDataSource : public AbstractRoutingCongestionDataSource
+{
+ public:
+  void registerHeatMap() override {}
+  void update() override {}
+};
+
+class RudyTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    db_ = utl::deleted_unique_ptr<odb::dbDatabase>(odb::dbDatabase::create(),
+                                                   &odb::dbDatabase::destroy);
+    std::call_once(init_sta_flag, []() { sta::initSta(); });
+    sta_ = std::unique_ptr<sta::dbSta>(ord::makeDbSta());
+    sta_->initVars(Tcl_CreateInterp(), db_.get(), &logger_);
+
+    odb::lefin lef_reader(
+        db_.get(), &logger_, /*ignore_non_routing_layers*/ false);
+    odb::dbLib* lib = lef_reader.createTechAndLib(
+        "Nangate45", "Nangate45.lef", "./Nangate45/Nangate45.lef");
+    sta_->postReadLef(/*tech=*/nullptr, lib);
+
+    odb::defin def_reader(db_.get(), &logger_);
+    std::vector<odb::dbLib*> search_libs = {lib};
+    odb::dbChip* chip
+        = def_reader.createChip(search_libs, "./gcd.def", db_->getTech());
+    block_ = chip->getBlock();
+    sta_->postReadDef(block_);
+
+    stt_.init(db_.get(), &logger_);
+    grouter_.init(&logger_,
+                  &stt_,
+                  db_.get(),
+                  sta_.get(),
+                  /*resizer=*/nullptr,
+                  /*antenna_checker=*/nullptr,
+                  /*opendp=*/nullptr,
+                  std::make_unique<NullCongestionDataSource>(),
+                  std::make_unique<NullCongestionDataSource>());
+  }
+
+  // Moves the first count placed instances to the middle of the die and
+  // returns their previous locations.
+  std::vector<std::pair<odb::dbInst*, odb::Point>> moveInsts(const int count)
+  {
+    const odb::Rect die = block_->getDieArea();
+    std::vector<std::pair<odb::dbInst*, odb::Point>> moved;
+    for (odb::dbInst* inst : block_->getInsts()) {
+      if (static_cast<int>(moved.size()) == count) {
+        break;
+      }
+      if (inst->getPlacementStatus() != odb::dbPlacementStatus::PLACED) {
+        continue;
+      }
+      moved.emplace_back(inst, inst->getLocation());
+      inst->setLocation(die.xCenter(), die.yCenter());
+    }
+    return moved;
+  }
+
+  static std::vector<float> tileValues(const Rudy& rudy)
+  {
+    std::vector<float> values;
+    const auto [x_grid_size, y_grid_size] = rudy.getGridSize();
+    for (int x = 0; x < x_grid_size; x++) {
+      for (int y = 0; y < y_grid_size; y++) {
+        values.push_back(rudy.getTile(x, y).getRudy());
+      }
+    }
+    return values;
+  }
+
+  std::vector<float> fullRudy()
+  {
+    Rudy rudy(block_, &grouter_);
+    rudy.calculateRudy();
+    return tileValues(rudy);
+  }
+
+  utl::Logger logger_;
+  utl::deleted_unique_ptr<odb::dbDatabase> db_;
+  std::unique_ptr<sta::dbSta> sta_;
+  stt::SteinerTreeBuilder stt_;
+  GlobalRouter grouter_;
+  odb::dbBlock* block_ = nullptr;
+};
+
+TEST_F(RudyTest, IncrementalUpdateMatchesFullRecompute)
+{
+  Rudy* rudy = grouter_.getRudy();
+  rudy->updateRudy();
+  moveInsts(5);
+  rudy->updateRudy();
+  EXPECT_EQ(tileValues(*rudy), fullRudy());
+}
+
+TEST_F(RudyTest, IncrementalUpdateDoesNotDependOnHistory)
+{
+  Rudy* rudy = grouter_.getRudy();
+  rudy->setNumThreads(4);
+  rudy->updateRudy();
+  const std::vector<float> initial = tileValues(*rudy);
+
+  for (const auto& [inst, location] : moveInsts(5)) {
+    rudy->updateRudy();
+    inst->setLocation(location.x(), location.y());
+  }
+  rudy->updateRudy();
+  EXPECT_EQ(tileValues(*rudy), initial);
+  EXPECT_EQ(initial, fullRudy());
+}
+
+TEST_F(RudyTest, WireWidthChangeRecomputes)
+{
+  Rudy* rudy = grouter_.getRudy();
+  rudy->updateRudy();
+  const std::vector<float> initial = tileValues(*rudy);
+
+  rudy->setWireWidth(200);
+  rudy->updateRudy();
+
+  Rudy expected(block_, &grouter_);
+  expected.setWireWidth(200);
+  expected.calculateRudy();
+  EXPECT_NE(tileValues(*rudy), initial);
+  EXPECT_EQ(tileValues(*rudy), tileValues(expected));
+}
+
+}  // namespace
+
+}  // namespace grt
@@ -0,0 +1,31 @@
+# parasitics estimated on 4 threads match the serial estimation
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+define_corners corner1 corner0
+read_liberty -corner corner0 Nangate45/Nangate45_typ.lib
+read_liberty -corner corner1 Nangate45/Nangate45_typ.lib
+read_def "gcd.def"
+
+set_layer_rc -corner corner0 -layer metal2 -resistance 2 -capacitance 1
+set_layer_rc -corner corner0 -layer metal3 -resistance 2 -capacitance 1
+set_layer_rc -corner corner0 -layer metal4 -resistance 2 -capacitance 1
+
+set_layer_rc -corner corner1 -layer metal2 -resistance 4 -capacitance 2
+set_layer_rc -corner corner1 -layer metal3 -resistance 4 -capacitance 2
+set_layer_rc -corner corner1 -layer metal4 -resistance 4 -capacitance 2
+
+set_routing_layers -signal metal2-metal10
+
+set serial_spef [make_result_file est_rc5_serial.spef]
+set threads_spef [make_result_file est_rc5_threads.spef]
+
+set_thread_count 1
+global_route
+estimate_parasitics -global_routing -spef_file $serial_spef
+
+set_thread_count 4
+global_route
+estimate_parasitics -global_routing -spef_file $threads_spef
+
+diff_files results/est_rc5_serial_corner0.spef results/est_rc5_threads_corner0.spef
+diff_files results/est_rc5_serial_corner1.spef results/est_rc5_threads_corner1.spef
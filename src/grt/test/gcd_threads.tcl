@@ -0,0 +1,13 @@
+# layer assignment on 4 threads matches the serial gcd guides
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set guide_file [make_result_file gcd_threads.guide]
+
+set_thread_count 4
+global_route -verbose
+
+write_guides $guide_file
+
+diff_file gcd.guideok $guide_file
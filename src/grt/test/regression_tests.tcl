@@ -16,8 +16,10 @@ record_tests {
   est_rc2
   est_rc3
   est_rc4
+  est_rc5
   gcd
   gcd_flute
+  gcd_threads
   inst_pin_out_of_die
   invalid_routing_layer
   invalid_pin_placement
@@ -50,6 +52,7 @@ record_tests {
   remove_buffers1
   remove_buffers2
   repair_antennas1
+  repair_antennas1_threads
   repair_antennas2
   repair_antennas3
   repair_antennas4
@@ -199,6 +199,13 @@ void LayoutTabs::fullRepaint()
   }
 }
 
+void LayoutTabs::refresh()
+{
+  for (auto viewer : viewers_) {
+    viewer->refresh();
+  }
+}
+
 void LayoutTabs::startRulerBuild()
 {
   if (current_viewer_) {
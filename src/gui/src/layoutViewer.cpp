@@ -146,6 +146,7 @@ LayoutViewer::LayoutViewer(
       snap_edge_showing_(false),
       animate_selection_(nullptr),
       repaint_requested_(false),
+      refresh_pending_(false),
       logger_(nullptr),
       layout_context_menu_(new QMenu(tr("Layout Menu"), this)),
       focus_nets_(focus_nets),
@@ -169,6 +170,10 @@ LayoutViewer::LayoutViewer(
           &LayoutViewer::handleLoadingIndication);
 
   connect(&search_, &Search::modified, this, &LayoutViewer::fullRepaint);
+  connect(&search_,
+          &Search::modifiedRegion,
+          this,
+          &LayoutViewer::regionModified);
 
   connect(&search_, &Search::newBlock, this, &LayoutViewer::setBlock);
 }
@@ -952,6 +957,7 @@ void LayoutViewer::selectAt(odb::Rect region, std::vector<Selected>& selections)
       if (options_->areInstancePinsVisible()
           && options_->areInstancePinsSelectable()) {
         const odb::dbTransform xform = inst->getTransform();
+        std::lock_guard<std::mutex> lock(cell_boxes_mutex_);
         for (const auto& [layer, boxes] : cell_boxes_[inst->getMaster()]) {
           if (options_->isVisible(layer) && options_->isSelectable(layer)) {
             for (const auto& [mterm, geoms] : boxes.mterms) {
@@ -1319,7 +1325,8 @@ void LayoutViewer::updateScaleAndCentering(const QSize& new_size)
                  ((new_area.height() + bounds.dy() * pixels_per_dbu_) / 2
                   + bounds.yMin() * pixels_per_dbu_));
 
-    fullRepaint();
+    // the render thread drops the tiles when the transform changes
+    refresh();
   }
 }
 
@@ -1410,6 +1417,7 @@ void LayoutViewer::boxesByLayer(dbMaster* master, LayerBoxes& boxes)
 const LayoutViewer::Boxes* LayoutViewer::boxesByLayer(dbMaster* master,
                                                       dbTechLayer* layer)
 {
+  std::lock_guard<std::mutex> lock(cell_boxes_mutex_);
   auto it = cell_boxes_.find(master);
   if (it == cell_boxes_.end()) {
     LayerBoxes& boxes = cell_boxes_[master];
@@ -1888,10 +1896,29 @@ void LayoutViewer::paintEvent(QPaintEvent* event)
 }
 
 void LayoutViewer::fullRepaint()
+{
+  viewer_thread_.invalidateTiles();
+  refresh();
+}
+
+void LayoutViewer::regionModified(const odb::Rect& region)
+{
+  viewer_thread_.invalidateTiles(region);
+
+  // coalesce the callbacks of a batch of edits into a single repaint
+  if (!refresh_pending_) {
+    refresh_pending_ = true;
+    QTimer::singleShot(0, this, [this]() {
+      refresh_pending_ = false;
+      refresh();
+    });
+  }
+}
+
+void LayoutViewer::refresh()
 {
   if (command_executing_ && !paused_) {
-    QTimer::singleShot(
-        5 /*ms*/, this, &LayoutViewer::fullRepaint);  // retry later
+    QTimer::singleShot(5 /*ms*/, this, &LayoutViewer::refresh);  // retry later
     return;
   }
 
@@ -2010,7 +2037,7 @@ void LayoutViewer::setScroller(LayoutScroll* scroller)
   connect(scroller_,
           &LayoutScroll::centerChanged,
           this,
-          &LayoutViewer::fullRepaint);
+          &LayoutViewer::refresh);
 }
 
 void LayoutViewer::viewportUpdated()
@@ -2031,7 +2058,7 @@ void LayoutViewer::viewportUpdated()
   if (!zoomed_in) {
     resize(scroller_->maximumViewportSize());
   }
-  fullRepaint();
+  refresh();
 }
 
 void LayoutViewer::saveImage(const QString& filepath,
@@ -2457,7 +2484,10 @@ void LayoutViewer::executionPaused()
 
 void LayoutViewer::resetCache()
 {
-  cell_boxes_.clear();
+  {
+    std::lock_guard<std::mutex> lock(cell_boxes_mutex_);
+    cell_boxes_.clear();
+  }
   fullRepaint();
 }
 
@@ -49,6 +49,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "gui/gui.h"
@@ -246,6 +247,12 @@ class LayoutViewer : public QWidget
   // signals that the cache should be flushed and a full repaint should occur.
   void fullRepaint();
 
+  // repaint the view reusing the cached layout tiles.
+  void refresh();
+
+  // flush the cached layout tiles covering region and repaint.
+  void regionModified(const odb::Rect& region);
+
   odb::Point getVisibleCenter();
 
   void selectHighlightConnectedInst(bool select_flag);
@@ -387,6 +394,7 @@ class LayoutViewer : public QWidget
   int max_depth_;
   Search search_;
   CellBoxes cell_boxes_;
+  std::mutex cell_boxes_mutex_;  // tiles are rendered concurrently
   QRect rubber_band_;  // screen coordinates
   QPoint mouse_press_pos_;
   QPoint mouse_move_pos_;
@@ -421,6 +429,7 @@ class LayoutViewer : public QWidget
   std::unique_ptr<AnimatedSelected> animate_selection_;
 
   bool repaint_requested_;
+  bool refresh_pending_;
 
   utl::Logger* logger_;
 
@@ -192,11 +192,9 @@ MainWindow::MainWindow(QWidget* parent)
         addRuler(x0, y0, x1, y1, "", "", default_ruler_style_->isChecked());
       });
 
-  connect(
-      this, &MainWindow::selectionChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(
-      this, &MainWindow::highlightChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::fullRepaint);
+  connect(this, &MainWindow::selectionChanged, viewers_, &LayoutTabs::refresh);
+  connect(this, &MainWindow::highlightChanged, viewers_, &LayoutTabs::refresh);
+  connect(this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::refresh);
 
   connect(controls_, &DisplayControls::selected, [=](const Selected& selected) {
     setSelected(selected);
@@ -221,7 +219,7 @@ MainWindow::MainWindow(QWidget* parent)
   connect(inspector_,
           &Inspector::selectedItemChanged,
           viewers_,
-          &LayoutTabs::fullRepaint);
+          &LayoutTabs::refresh);
   connect(inspector_,
           &Inspector::selectedItemChanged,
           this,
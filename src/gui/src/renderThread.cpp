@@ -33,6 +33,10 @@
 #include "renderThread.h"
 
 #include <QPainterPath>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
 
 #include "layoutViewer.h"
 #include "odb/dbShape.h"
@@ -124,13 +128,7 @@ void RenderThread::run()
                  QImage::Format_ARGB32_Premultiplied);
     // drawing can be interrupted by setting restart_
     try {
-      draw(image,
-           draw_bounds,
-           selected,
-           highlighted,
-           rulers,
-           1.0,
-           Qt::transparent);
+      drawTiled(image, draw_bounds, selected, highlighted, rulers);
     } catch (const std::exception& e) {
       logger_->warn(
           GUI, 102, "An exception occurred during rendering: {}", e.what());
@@ -221,7 +219,8 @@ void RenderThread::draw(QImage& image,
     image.fill(background);
   }
 
-  drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  setupIOPins(viewer_->block_, dbu_bounds);
+  drawBlock(&painter, viewer_->block_, dbu_bounds, 0, true);
 
   // draw selected and over top level and fast painting events
   drawSelected(gui_painter, selected);
@@ -230,6 +229,448 @@ void RenderThread::draw(QImage& image,
   drawRulers(gui_painter, rulers);
 }
 
+void RenderThread::drawTiled(QImage& image,
+                             const QRect& draw_bounds,
+                             const SelectionSet& selected,
+                             const HighlightSet& highlighted,
+                             const Rulers& rulers)
+{
+  if (image.isNull()) {
+    return;
+  }
+  // Prevent a paintEvent and a save_image call from interfering
+  // (eg search RTree construction)
+  std::lock_guard<std::mutex> lock(drawing_mutex_);
+  QPainter painter(&image);
+  painter.setRenderHints(QPainter::Antialiasing);
+
+  image.fill(Qt::transparent);
+
+  dbBlock* block = viewer_->block_;
+  QTransform dbu_to_screen;
+  dbu_to_screen.translate(viewer_->centering_shift_.x(),
+                          viewer_->centering_shift_.y());
+  dbu_to_screen.scale(viewer_->pixels_per_dbu_, -viewer_->pixels_per_dbu_);
+  const QTransform screen_to_image
+      = QTransform::fromTranslate(-draw_bounds.left(), -draw_bounds.top());
+
+  painter.setTransform(dbu_to_screen * screen_to_image);
+
+  const Rect dbu_bounds = viewer_->screenToDBU(draw_bounds);
+
+  GuiPainter gui_painter(&painter,
+                         viewer_->options_,
+                         dbu_bounds,
+                         viewer_->pixels_per_dbu_,
+                         block->getDbUnitsPerMicron());
+
+  if (!is_first_render_done_ && !restart_) {
+    drawDesignLoadingMessage(gui_painter, dbu_bounds);
+    emit done(image, draw_bounds);
+
+    // Erase the first render indication so it does not remain on the screen
+    // when the design is drawn for the first time
+    image.fill(Qt::transparent);
+  }
+
+  utl::Timer tiles_timer;
+  Tiles tiles;
+  QTransform tiles_transform = dbu_to_screen;
+  std::vector<TileIndex> missing;
+  Tiles preview_tiles;
+  QTransform preview_transform;
+  int generation;
+  {
+    std::lock_guard<std::mutex> tiles_lock(tiles_mutex_);
+    if (tiles_block_ != block || tiles_view_size_ != draw_bounds.size()) {
+      tile_levels_.clear();
+      tiles_block_ = block;
+      tiles_view_size_ = draw_bounds.size();
+    }
+    tiles_frame_++;
+
+    TileLevel* level = findTileLevel(dbu_to_screen);
+    const Rect block_bounds = block->getBBox()->getBox();
+    if (level == nullptr && dbu_bounds.contains(block_bounds)) {
+      // Zoomed out past the whole block so reuse a finer level scaled down.
+      level = findCoarseTileLevel(dbu_to_screen, block_bounds);
+    }
+    if (level == nullptr) {
+      if (tile_levels_.size() >= max_tile_levels_) {
+        tile_levels_.erase(std::min_element(
+            tile_levels_.begin(),
+            tile_levels_.end(),
+            [](const TileLevel& lhs, const TileLevel& rhs) {
+              return lhs.last_used < rhs.last_used;
+            }));
+      }
+      level = &tile_levels_.emplace_back();
+      level->transform = dbu_to_screen;
+    }
+    level->last_used = tiles_frame_;
+    tiles_transform = level->transform;
+
+    const QRectF visible
+        = (dbu_to_screen.inverted() * tiles_transform)
+              .mapRect(QRectF(draw_bounds));
+    const int first_col = std::floor(visible.left() / tile_size_);
+    const int last_col = std::floor(visible.right() / tile_size_);
+    const int first_row = std::floor(visible.top() / tile_size_);
+    const int last_row = std::floor(visible.bottom() / tile_size_);
+    for (int col = first_col; col <= last_col; col++) {
+      for (int row = first_row; row <= last_row; row++) {
+        auto itr = level->tiles.find({col, row});
+        if (itr != level->tiles.end()) {
+          tiles.emplace_back(itr->first, itr->second);
+        } else if (tiles_transform == dbu_to_screen) {
+          missing.emplace_back(col, row);
+        }
+      }
+    }
+
+    // Preview from the most recently used other level while the missing
+    // tiles are rendered.
+    if (!missing.empty()) {
+      const TileLevel* preview = nullptr;
+      for (const TileLevel& other : tile_levels_) {
+        if (&other != level && !other.tiles.empty()
+            && (preview == nullptr || other.last_used > preview->last_used)) {
+          preview = &other;
+        }
+      }
+      if (preview != nullptr) {
+        preview_tiles.assign(preview->tiles.begin(), preview->tiles.end());
+        preview_transform = preview->transform;
+      }
+    }
+    generation = tiles_generation_;
+  }
+
+  if (!preview_tiles.empty() && is_first_render_done_) {
+    drawTiles(&painter,
+              draw_bounds,
+              preview_tiles,
+              preview_transform,
+              dbu_to_screen);
+    drawRenderers(gui_painter, block);
+    emit done(image, draw_bounds);
+    image.fill(Qt::transparent);
+  }
+  preview_tiles.clear();
+
+  if (!missing.empty()) {
+    // The pins are shared by all the tiles so set them up once.
+    setupIOPins(block, dbu_bounds);
+
+    std::vector<QImage> rendered(missing.size());
+    std::atomic<size_t> next_tile{0};
+    auto render_tiles = [&]() {
+      for (size_t i = next_tile++; i < missing.size(); i = next_tile++) {
+        if (restart_) {
+          break;
+        }
+        rendered[i] = renderTile(missing[i], dbu_to_screen, block);
+      }
+    };
+    const int thread_count = std::min<int>(
+        missing.size(), std::max(1, QThread::idealThreadCount()));
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count - 1);
+    for (int i = 1; i < thread_count; i++) {
+      workers.emplace_back(render_tiles);
+    }
+    render_tiles();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    if (!restart_) {
+      std::lock_guard<std::mutex> tiles_lock(tiles_mutex_);
+      // Tiles invalidated while rendering are only used for this frame.
+      TileLevel* level = nullptr;
+      if (generation == tiles_generation_ && tiles_block_ == block) {
+        level = findTileLevel(dbu_to_screen);
+      }
+      for (size_t i = 0; i < missing.size(); i++) {
+        if (level != nullptr) {
+          level->tiles[missing[i]] = rendered[i];
+        }
+        tiles.emplace_back(missing[i], std::move(rendered[i]));
+      }
+      if (level != nullptr) {
+        evictTiles(dbu_to_screen, draw_bounds);
+      }
+    }
+  }
+  debugPrint(logger_,
+             GUI,
+             "draw",
+             1,
+             "tiles {} cached {} rendered {} coarse {}",
+             tiles_timer,
+             tiles.size() - missing.size(),
+             missing.size(),
+             tiles_transform != dbu_to_screen);
+
+  drawTiles(&painter, draw_bounds, tiles, tiles_transform, dbu_to_screen);
+
+  drawRenderers(gui_painter, block);
+
+  // draw selected and over top level and fast painting events
+  drawSelected(gui_painter, selected);
+  // Always last so on top
+  drawHighlighted(gui_painter, highlighted);
+  drawRulers(gui_painter, rulers);
+}
+
+QImage RenderThread::renderTile(const TileIndex& tile,
+                                const QTransform& dbu_to_screen,
+                                dbBlock* block)
+{
+  const QRect tile_rect(tile.first * tile_size_,
+                        tile.second * tile_size_,
+                        tile_size_,
+                        tile_size_);
+
+  QImage image(tile_size_, tile_size_, QImage::Format_ARGB32_Premultiplied);
+  image.fill(Qt::transparent);
+
+  QPainter painter(&image);
+  painter.setRenderHints(QPainter::Antialiasing);
+  painter.setTransform(
+      dbu_to_screen
+      * QTransform::fromTranslate(-tile_rect.left(), -tile_rect.top()));
+
+  drawBlock(&painter, block, viewer_->screenToDBU(tile_rect), 0, false);
+
+  return image;
+}
+
+void RenderThread::drawTiles(QPainter* painter,
+                             const QRect& draw_bounds,
+                             const Tiles& tiles,
+                             const QTransform& tiles_transform,
+                             const QTransform& dbu_to_screen)
+{
+  // Map the tile pixels to dbu and then to the image pixels.
+  const QTransform tiles_to_image
+      = tiles_transform.inverted() * dbu_to_screen
+        * QTransform::fromTranslate(-draw_bounds.left(), -draw_bounds.top());
+  const QRectF visible = tiles_to_image.inverted().mapRect(
+      QRectF(0, 0, draw_bounds.width(), draw_bounds.height()));
+
+  painter->save();
+  painter->setTransform(tiles_to_image);
+  if (tiles_transform != dbu_to_screen) {
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+  }
+  for (const auto& [tile, tile_image] : tiles) {
+    const QRectF tile_rect(tile.first * tile_size_,
+                           tile.second * tile_size_,
+                           tile_size_,
+                           tile_size_);
+    if (tile_rect.intersects(visible)) {
+      painter->drawImage(tile_rect.topLeft(), tile_image);
+    }
+  }
+  painter->restore();
+}
+
+RenderThread::TileLevel* RenderThread::findTileLevel(
+    const QTransform& dbu_to_screen)
+{
+  for (TileLevel& level : tile_levels_) {
+    if (level.transform == dbu_to_screen) {
+      return &level;
+    }
+  }
+  return nullptr;
+}
+
+// A view showing the whole block is drawn from a level at up to twice the
+// zoom if that level has every tile of the block cached.  This keeps
+// zooming out from re-rendering the full chip at each step.
+RenderThread::TileLevel* RenderThread::findCoarseTileLevel(
+    const QTransform& dbu_to_screen,
+    const Rect& block_bounds)
+{
+  const double scale = dbu_to_screen.m11();
+  for (TileLevel& level : tile_levels_) {
+    const double ratio = level.transform.m11() / scale;
+    if (ratio <= 1.0 || ratio > 2.0) {
+      continue;
+    }
+    // Leave room for the pin markers drawn outside the block.
+    const QRectF block_rect = level.transform
+                                  .mapRect(QRectF(block_bounds.xMin(),
+                                                  block_bounds.yMin(),
+                                                  block_bounds.dx(),
+                                                  block_bounds.dy()))
+                                  .adjusted(-16, -16, 16, 16);
+    const int first_col = std::floor(block_rect.left() / tile_size_);
+    const int last_col = std::floor(block_rect.right() / tile_size_);
+    const int first_row = std::floor(block_rect.top() / tile_size_);
+    const int last_row = std::floor(block_rect.bottom() / tile_size_);
+    bool complete = true;
+    for (int col = first_col; complete && col <= last_col; col++) {
+      for (int row = first_row; complete && row <= last_row; row++) {
+        complete = level.tiles.find({col, row}) != level.tiles.end();
+      }
+    }
+    if (complete) {
+      return &level;
+    }
+  }
+  return nullptr;
+}
+
+void RenderThread::evictTiles(const QTransform& dbu_to_screen,
+                              const QRect& draw_bounds)
+{
+  size_t tile_count = 0;
+  for (const TileLevel& level : tile_levels_) {
+    tile_count += level.tiles.size();
+  }
+
+  // Drop the other zoom levels first, least recently used first.
+  std::sort(tile_levels_.begin(),
+            tile_levels_.end(),
+            [](const TileLevel& lhs, const TileLevel& rhs) {
+              return lhs.last_used > rhs.last_used;
+            });
+  while (tile_count > max_cached_tiles_
+         && tile_levels_.back().transform != dbu_to_screen) {
+    tile_count -= tile_levels_.back().tiles.size();
+    tile_levels_.pop_back();
+  }
+  if (tile_count <= max_cached_tiles_) {
+    return;
+  }
+
+  // Drop the tiles farthest from the current view.
+  TileLevel* level = findTileLevel(dbu_to_screen);
+  const size_t keep = level->tiles.size() - (tile_count - max_cached_tiles_);
+  const QPointF center = QRectF(draw_bounds).center() / tile_size_;
+  std::vector<std::pair<double, TileIndex>> distances;
+  distances.reserve(level->tiles.size());
+  for (const auto& [tile, image] : level->tiles) {
+    const double dx = tile.first + 0.5 - center.x();
+    const double dy = tile.second + 0.5 - center.y();
+    distances.emplace_back(dx * dx + dy * dy, tile);
+  }
+  std::nth_element(
+      distances.begin(), distances.begin() + keep, distances.end());
+  for (auto itr = distances.begin() + keep; itr != distances.end(); itr++) {
+    level->tiles.erase(itr->second);
+  }
+}
+
+void RenderThread::invalidateTiles(const odb::Rect& region)
+{
+  std::lock_guard<std::mutex> lock(tiles_mutex_);
+  tiles_generation_++;
+
+  for (TileLevel& level : tile_levels_) {
+    if (level.tiles.empty()) {
+      continue;
+    }
+    // Grow by a couple of pixels to cover cosmetic pens and antialiasing.
+    const QRectF screen_region
+        = level.transform
+              .mapRect(QRectF(
+                  region.xMin(), region.yMin(), region.dx(), region.dy()))
+              .adjusted(-2, -2, 2, 2);
+    const int first_col = std::floor(screen_region.left() / tile_size_);
+    const int last_col = std::floor(screen_region.right() / tile_size_);
+    const int first_row = std::floor(screen_region.top() / tile_size_);
+    const int last_row = std::floor(screen_region.bottom() / tile_size_);
+    const double range_size
+        = (last_col - first_col + 1.0) * (last_row - first_row + 1.0);
+    if (range_size <= level.tiles.size()) {
+      // Typical for edits of a few objects, eg. moving an instance
+      for (int col = first_col; col <= last_col; col++) {
+        for (int row = first_row; row <= last_row; row++) {
+          level.tiles.erase({col, row});
+        }
+      }
+      continue;
+    }
+    for (auto itr = level.tiles.begin(); itr != level.tiles.end();) {
+      const auto& [col, row] = itr->first;
+      if (first_col <= col && col <= last_col && first_row <= row
+          && row <= last_row) {
+        itr = level.tiles.erase(itr);
+      } else {
+        itr++;
+      }
+    }
+  }
+}
+
+void RenderThread::invalidateTiles()
+{
+  std::lock_guard<std::mutex> lock(tiles_mutex_);
+  tiles_generation_++;
+  tile_levels_.clear();
+}
+
+// Renderers change often, eg. heat maps and tool debug views, so they are
+// drawn over the tiles on every frame rather than into them.
+void RenderThread::drawRenderers(GuiPainter& gui_painter, dbBlock* block)
+{
+  const auto& renderers = Gui::get()->renderers();
+  if (renderers.empty()) {
+    return;
+  }
+  utl::Timer renderers_timer;
+  for (dbTechLayer* layer : getDrawLayers(block)) {
+    if (!viewer_->options_->isVisible(layer)) {
+      continue;
+    }
+    for (auto* renderer : renderers) {
+      if (restart_) {
+        return;
+      }
+      gui_painter.saveState();
+      renderer->drawLayer(layer, gui_painter);
+      gui_painter.restoreState();
+    }
+  }
+  for (auto* renderer : renderers) {
+    if (restart_) {
+      return;
+    }
+    gui_painter.saveState();
+    renderer->drawObjects(gui_painter);
+    gui_painter.restoreState();
+  }
+  debugPrint(logger_, GUI, "draw", 1, "renderers {}", renderers_timer);
+}
+
+// The layers of the child techs are drawn first.
+std::vector<dbTechLayer*> RenderThread::getDrawLayers(dbBlock* block)
+{
+  dbTech* tech = block->getTech();
+  std::set<dbTech*> child_techs;
+  for (auto child : block->getChildren()) {
+    dbTech* child_tech = child->getTech();
+    if (child_tech != tech) {
+      child_techs.insert(child_tech);
+    }
+  }
+
+  std::vector<dbTechLayer*> layers;
+  for (dbTech* child_tech : child_techs) {
+    for (dbTechLayer* layer : child_tech->getLayers()) {
+      layers.push_back(layer);
+    }
+  }
+  for (dbTechLayer* layer : tech->getLayers()) {
+    layers.push_back(layer);
+  }
+  return layers;
+}
+
 QColor RenderThread::getColor(dbTechLayer* layer)
 {
   return viewer_->options_->color(layer);
@@ -554,7 +995,8 @@ void RenderThread::drawInstanceShapes(dbTechLayer* layer,
         }
       }
 
-      drawLayer(painter, child, layer, child_insts, bbox, gui_painter);
+      drawLayer(
+          painter, child, layer, child_insts, bbox, gui_painter, false);
       continue;
     }
 
@@ -882,7 +1324,8 @@ void RenderThread::drawLayer(QPainter* painter,
                              dbTechLayer* layer,
                              const std::vector<dbInst*>& insts,
                              const Rect& bounds,
-                             GuiPainter& gui_painter)
+                             GuiPainter& gui_painter,
+                             bool draw_renderers)
 {
   if (!viewer_->options_->isVisible(layer)) {
     return;
@@ -890,11 +1333,15 @@ void RenderThread::drawLayer(QPainter* painter,
   utl::Timer layer_timer;
 
   const int shape_limit = viewer_->shapeSizeLimit();
+  // Tiles are drawn concurrently so the map must not be modified here.
+  auto cut_maximum_size = [this](dbTechLayer* cut_layer) {
+    auto itr = viewer_->cut_maximum_size_.find(cut_layer);
+    return itr == viewer_->cut_maximum_size_.end() ? 0 : itr->second;
+  };
 
   // Skip the cut layer if the cuts will be too small to see
-  const bool draw_shapes
-      = !(layer->getType() == dbTechLayerType::CUT
-          && viewer_->cut_maximum_size_[layer] < shape_limit);
+  const bool draw_shapes = !(layer->getType() == dbTechLayerType::CUT
+                             && cut_maximum_size(layer) < shape_limit);
   const bool layer_is_routing = layer->getType() == dbTechLayerType::CUT
                                 || layer->getType() == dbTechLayerType::ROUTING;
 
@@ -952,12 +1399,12 @@ void RenderThread::drawLayer(QPainter* painter,
         // will be too small based on the cut size (enclosure shapes
         // are generally only slightly larger).
         if (auto upper = layer->getUpperLayer()) {
-          if (viewer_->cut_maximum_size_[upper] >= shape_limit) {
+          if (cut_maximum_size(upper) >= shape_limit) {
             drawViaShapes(painter, block, upper, layer, bounds, shape_limit);
           }
         }
         if (auto lower = layer->getLowerLayer()) {
-          if (viewer_->cut_maximum_size_[lower] >= shape_limit) {
+          if (cut_maximum_size(lower) >= shape_limit) {
             drawViaShapes(painter, block, lower, layer, bounds, shape_limit);
           }
         }
@@ -1035,13 +1482,15 @@ void RenderThread::drawLayer(QPainter* painter,
     drawNetTracks(gui_painter, layer);
   }
 
-  for (auto* renderer : Gui::get()->renderers()) {
-    if (restart_) {
-      break;
+  if (draw_renderers) {
+    for (auto* renderer : Gui::get()->renderers()) {
+      if (restart_) {
+        break;
+      }
+      gui_painter.saveState();
+      renderer->drawLayer(layer, gui_painter);
+      gui_painter.restoreState();
     }
-    gui_painter.saveState();
-    renderer->drawLayer(layer, gui_painter);
-    gui_painter.restoreState();
   }
   debugPrint(logger_,
              GUI,
@@ -1057,7 +1506,8 @@ void RenderThread::drawLayer(QPainter* painter,
 void RenderThread::drawBlock(QPainter* painter,
                              dbBlock* block,
                              const Rect& bounds,
-                             int depth)
+                             int depth,
+                             bool draw_renderers)
 {
   utl::Timer timer;
 
@@ -1108,10 +1558,6 @@ void RenderThread::drawBlock(QPainter* painter,
   }
   debugPrint(logger_, GUI, "draw", 1, "inst search {}", inst_timer);
 
-  utl::Timer io_pins_setup;
-  setupIOPins(block, bounds);
-  debugPrint(logger_, GUI, "draw", 1, "io pins setup {}", io_pins_setup);
-
   utl::Timer insts_outline;
   drawInstanceOutlines(painter, insts);
   debugPrint(logger_, GUI, "draw", 1, "inst outline render {}", insts_outline);
@@ -1121,29 +1567,12 @@ void RenderThread::drawBlock(QPainter* painter,
   drawBlockages(painter, block, bounds);
   debugPrint(logger_, GUI, "draw", 1, "blockages {}", inst_blockages);
 
-  dbTech* tech = block->getTech();
-  std::set<dbTech*> child_techs;
-  for (auto child : block->getChildren()) {
-    dbTech* child_tech = child->getTech();
-    if (child_tech != tech) {
-      child_techs.insert(child_tech);
-    }
-  }
-
-  for (dbTech* child_tech : child_techs) {
-    for (dbTechLayer* layer : child_tech->getLayers()) {
-      if (restart_) {
-        break;
-      }
-      drawLayer(painter, block, layer, insts, bounds, gui_painter);
-    }
-  }
-
-  for (dbTechLayer* layer : tech->getLayers()) {
+  for (dbTechLayer* layer : getDrawLayers(block)) {
     if (restart_) {
       break;
     }
-    drawLayer(painter, block, layer, insts, bounds, gui_painter);
+    drawLayer(
+        painter, block, layer, insts, bounds, gui_painter, draw_renderers);
   }
 
   utl::Timer inst_names;
@@ -1177,13 +1606,15 @@ void RenderThread::drawBlock(QPainter* painter,
   debugPrint(logger_, GUI, "draw", 1, "save cell grid {}", inst_cell_grid);
 
   utl::Timer inst_save_restore;
-  for (auto* renderer : Gui::get()->renderers()) {
-    if (restart_) {
-      break;
+  if (draw_renderers) {
+    for (auto* renderer : Gui::get()->renderers()) {
+      if (restart_) {
+        break;
+      }
+      gui_painter.saveState();
+      renderer->drawObjects(gui_painter);
+      gui_painter.restoreState();
     }
-    gui_painter.saveState();
-    renderer->drawObjects(gui_painter);
-    gui_painter.restoreState();
   }
   debugPrint(logger_, GUI, "draw", 1, "renderers {}", inst_save_restore);
 
@@ -1527,10 +1958,11 @@ void RenderThread::drawIOPins(Painter& painter,
                               const odb::Rect& bounds,
                               odb::dbTechLayer* layer)
 {
-  const auto& pins = pins_[layer];
-  if (pins.empty()) {
+  auto pins_itr = pins_.find(layer);
+  if (pins_itr == pins_.end() || pins_itr->second.empty()) {
     return;
   }
+  const auto& pins = pins_itr->second;
 
   const auto die_area = block->getDieArea();
 
@@ -35,8 +35,13 @@
 #include <QMutex>
 #include <QPainter>
 #include <QThread>
+#include <QTransform>
 #include <QWaitCondition>
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "gui/gui.h"
 #include "odb/db.h"
@@ -76,24 +81,65 @@ class RenderThread : public QThread
   bool isFirstRenderDone() { return is_first_render_done_; };
   bool isRendering() { return is_rendering_; };
 
+  // Drop the cached tiles overlapping region (in DBU) or all of them.
+  void invalidateTiles(const odb::Rect& region);
+  void invalidateTiles();
+
  signals:
   void done(const QImage& image, const QRect& bounds);
 
  private:
+  using TileIndex = std::pair<int, int>;  // column, row
+  using Tiles = std::vector<std::pair<TileIndex, QImage>>;
+
+  // The tiles rendered at one zoom level.
+  struct TileLevel
+  {
+    QTransform transform;  // dbu to screen transform the tiles used
+    std::map<TileIndex, QImage> tiles;
+    int last_used = 0;
+  };
+
   void run() override;
 
+  // Draws the layout from cached tiles, rendering the missing ones in
+  // parallel, then draws the overlays on top.
+  void drawTiled(QImage& image,
+                 const QRect& draw_bounds,
+                 const SelectionSet& selected,
+                 const HighlightSet& highlighted,
+                 const Rulers& rulers);
+  QImage renderTile(const TileIndex& tile,
+                    const QTransform& dbu_to_screen,
+                    odb::dbBlock* block);
+  // Draws tiles rendered with tiles_transform, scaling them if the view
+  // uses a different zoom.
+  void drawTiles(QPainter* painter,
+                 const QRect& draw_bounds,
+                 const Tiles& tiles,
+                 const QTransform& tiles_transform,
+                 const QTransform& dbu_to_screen);
+  TileLevel* findTileLevel(const QTransform& dbu_to_screen);
+  TileLevel* findCoarseTileLevel(const QTransform& dbu_to_screen,
+                                 const odb::Rect& block_bounds);
+  void evictTiles(const QTransform& dbu_to_screen, const QRect& draw_bounds);
+  void drawRenderers(GuiPainter& gui_painter, odb::dbBlock* block);
+  std::vector<odb::dbTechLayer*> getDrawLayers(odb::dbBlock* block);
+
   void setupIOPins(odb::dbBlock* block, const odb::Rect& bounds);
 
   void drawBlock(QPainter* painter,
                  odb::dbBlock* block,
                  const odb::Rect& bounds,
-                 int depth);
+                 int depth,
+                 bool draw_renderers);
   void drawLayer(QPainter* painter,
                  odb::dbBlock* block,
                  odb::dbTechLayer* layer,
                  const std::vector<odb::dbInst*>& insts,
                  const odb::Rect& bounds,
-                 GuiPainter& gui_painter);
+                 GuiPainter& gui_painter,
+                 bool draw_renderers);
   void drawRegions(QPainter* painter, odb::dbBlock* block);
   void drawTracks(odb::dbTechLayer* layer,
                   QPainter* painter,
@@ -172,11 +218,25 @@ class RenderThread : public QThread
 
   QMutex mutex_;
   QWaitCondition condition_;
-  bool restart_ = false;
+  // read by the tile threads while the view thread sets it
+  std::atomic<bool> restart_ = false;
   bool abort_ = false;
   bool is_rendering_ = false;
   bool is_first_render_done_ = false;
 
+  // Tiles of rendered block shapes in screen pixels for the most recently
+  // used zoom levels. Renderers, selection, highlights and rulers change
+  // often and are drawn over the tiles on every frame instead.
+  static constexpr int tile_size_ = 256;             // pixels
+  static constexpr size_t max_cached_tiles_ = 1024;  // 256MB
+  static constexpr size_t max_tile_levels_ = 4;
+  std::mutex tiles_mutex_;
+  std::vector<TileLevel> tile_levels_;
+  odb::dbBlock* tiles_block_ = nullptr;
+  QSize tiles_view_size_;  // the pin markers are sized by the view
+  int tiles_generation_ = 0;
+  int tiles_frame_ = 0;
+
   QFont pin_font_;
   bool pin_draw_names_ = false;
   double pin_max_size_ = 0.0;
@@ -32,6 +32,9 @@
 
 #include "search.h"
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
 #include <tuple>
 #include <utility>
 
@@ -39,6 +42,102 @@
 
 namespace gui {
 
+// Move the shapes collected by a thread to the pending values of the
+// layer rtrees.
+template <typename Value, typename Tree>
+static void appendShapes(Search::LayerMap<std::vector<Value>>& shapes,
+                         Search::LayerMap<Search::LazyRtree<Tree>>& trees)
+{
+  for (auto& [layer, layer_shapes] : shapes) {
+    trees[layer].append(layer_shapes);
+  }
+  shapes.clear();
+}
+
+// Reset the trees in place as the render threads may be searching the map.
+template <typename Tree>
+static void clearTrees(Search::LayerMap<Search::LazyRtree<Tree>>& trees)
+{
+  for (auto& [layer, tree] : trees) {
+    tree.clear();
+  }
+}
+
+template <typename Tree>
+const Tree& Search::LazyRtree<Tree>::get(ReadLock& lock)
+{
+  while (true) {
+    lock = std::make_shared<std::shared_lock<std::shared_mutex>>(mutex_);
+    if (built_) {
+      return tree_;
+    }
+    lock.reset();
+
+    std::unique_lock<std::shared_mutex> write_lock(mutex_);
+    if (!built_) {
+      // The range constructor bulk loads using the packing algorithm
+      tree_ = Tree(values_.begin(), values_.end());
+      values_.clear();
+      values_.shrink_to_fit();
+      built_ = true;
+    }
+  }
+}
+
+template <typename Tree>
+void Search::LazyRtree<Tree>::clear()
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  tree_.clear();
+  values_.clear();
+  built_ = false;
+}
+
+template <typename Tree>
+void Search::LazyRtree<Tree>::append(std::vector<Value>& values)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (built_) {
+    tree_.insert(values.begin(), values.end());
+  } else {
+    values_.insert(values_.end(),
+                   std::make_move_iterator(values.begin()),
+                   std::make_move_iterator(values.end()));
+  }
+  values.clear();
+}
+
+template <typename Tree>
+void Search::LazyRtree<Tree>::insert(const Value& value)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (built_) {
+    tree_.insert(value);
+  } else {
+    values_.push_back(value);
+  }
+}
+
+template <typename Tree>
+template <typename Predicate>
+void Search::LazyRtree<Tree>::remove(const odb::Rect& box,
+                                     const Predicate& pred)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (!built_) {
+    values_.erase(std::remove_if(values_.begin(), values_.end(), pred),
+                  values_.end());
+    return;
+  }
+
+  std::vector<Value> found;
+  tree_.query(bgi::intersects(box) && bgi::satisfies(pred),
+              std::back_inserter(found));
+  for (const Value& value : found) {
+    tree_.remove(value);
+  }
+}
+
 Search::~Search()
 {
   if (top_block_ != nullptr) {
@@ -54,14 +153,21 @@ void Search::inDbNetDestroy(odb::dbNet* net)
 void Search::inDbInstDestroy(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    removeInst(inst);
+  }
+}
+
+void Search::inDbInstSwapMasterBefore(odb::dbInst* inst, odb::dbMaster* master)
+{
+  if (inst->isPlaced()) {
+    removeInst(inst);
   }
 }
 
 void Search::inDbInstSwapMasterAfter(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    addInst(inst);
   }
 }
 
@@ -69,14 +175,25 @@ void Search::inDbInstPlacementStatusBefore(odb::dbInst* inst,
                                            const odb::dbPlacementStatus& status)
 {
   if (inst->getPlacementStatus().isPlaced() != status.isPlaced()) {
-    clearInsts();
+    if (status.isPlaced()) {
+      addInst(inst);
+    } else {
+      removeInst(inst);
+    }
+  }
+}
+
+void Search::inDbPreMoveInst(odb::dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    removeInst(inst);
   }
 }
 
 void Search::inDbPostMoveInst(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    addInst(inst);
   }
 }
 
@@ -92,7 +209,22 @@ void Search::inDbBPinDestroy(odb::dbBPin* pin)
 
 void Search::inDbFillCreate(odb::dbFill* fill)
 {
-  clearFills();
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.fills_init_mutex_);
+    if (data.fills_init_) {
+      auto it = data.fills_.find(fill->getTechLayer());
+      if (it != data.fills_.end()) {
+        it->second.insert(fill);
+      } else {
+        data.fills_init_ = false;
+      }
+    }
+  }
+
+  odb::Rect rect;
+  fill->getRect(rect);
+  emit modifiedRegion(rect);
 }
 
 void Search::inDbWireCreate(odb::dbWire* wire)
@@ -117,27 +249,63 @@ void Search::inDbSWireDestroy(odb::dbSWire* wire)
 
 void Search::inDbSWireAddSBox(odb::dbSBox* box)
 {
-  clearShapes();
+  addSBox(box);
 }
 
 void Search::inDbSWireRemoveSBox(odb::dbSBox* box)
 {
-  clearShapes();
+  removeSBox(box);
 }
 
 void Search::inDbBlockageCreate(odb::dbBlockage* blockage)
 {
-  clearBlockages();
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.blockages_init_mutex_);
+    if (data.blockages_init_) {
+      data.blockages_.insert(blockage);
+    }
+  }
+
+  emit modifiedRegion(blockage->getBBox()->getBox());
 }
 
 void Search::inDbObstructionCreate(odb::dbObstruction* obs)
 {
-  clearObstructions();
+  odb::dbBox* bbox = obs->getBBox();
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.obstructions_init_mutex_);
+    if (data.obstructions_init_) {
+      auto it = data.obstructions_.find(bbox->getTechLayer());
+      if (it != data.obstructions_.end()) {
+        it->second.insert(obs);
+      } else {
+        data.obstructions_init_ = false;
+      }
+    }
+  }
+
+  emit modifiedRegion(bbox->getBox());
 }
 
 void Search::inDbObstructionDestroy(odb::dbObstruction* obs)
 {
-  clearObstructions();
+  odb::dbBox* bbox = obs->getBBox();
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.obstructions_init_mutex_);
+    if (data.obstructions_init_) {
+      auto it = data.obstructions_.find(bbox->getTechLayer());
+      if (it != data.obstructions_.end()) {
+        it->second.remove(bbox->getBox(), [obs](odb::dbObstruction* other) {
+          return other == obs;
+        });
+      }
+    }
+  }
+
+  emit modifiedRegion(bbox->getBox());
 }
 
 void Search::inDbBlockSetDieArea(odb::dbBlock* block)
@@ -204,6 +372,111 @@ void Search::announceModified(std::atomic_bool& flag)
   }
 }
 
+void Search::addInst(odb::dbInst* inst)
+{
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.insts_init_mutex_);
+    if (data.insts_init_) {
+      data.insts_.insert(inst);
+    }
+  }
+
+  emit modifiedRegion(inst->getBBox()->getBox());
+}
+
+void Search::removeInst(odb::dbInst* inst)
+{
+  // The rtree locates the instance by its current bbox so this must be
+  // called before it changes.
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.insts_init_mutex_);
+    if (data.insts_init_) {
+      data.insts_.remove(inst->getBBox()->getBox(),
+                         [inst](odb::dbInst* other) { return other == inst; });
+    }
+  }
+
+  emit modifiedRegion(inst->getBBox()->getBox());
+}
+
+void Search::addSBox(odb::dbSBox* box)
+{
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.shapes_init_mutex_);
+    if (data.shapes_init_) {
+      odb::dbNet* net = box->getSWire()->getNet();
+      if (box->isVia()) {
+        auto it = data.snet_via_shapes_.find(getSNetViaLayer(box));
+        if (it != data.snet_via_shapes_.end()) {
+          it->second.insert({box, net});
+        } else {
+          data.shapes_init_ = false;
+        }
+      } else {
+        auto it = data.snet_shapes_.find(box->getTechLayer());
+        if (it == data.snet_shapes_.end()) {
+          data.shapes_init_ = false;
+        } else if (box->getDirection() == odb::dbSBox::OCTILINEAR) {
+          it->second.insert({box, odb::Polygon(box->getOct()), net});
+        } else {
+          it->second.insert({box, odb::Polygon(box->getBox()), net});
+        }
+      }
+    }
+  }
+
+  emit modifiedRegion(box->getBox());
+}
+
+void Search::removeSBox(odb::dbSBox* box)
+{
+  BlockData& data = top_block_data_;
+  {
+    std::lock_guard<std::mutex> lock(data.shapes_init_mutex_);
+    if (data.shapes_init_) {
+      if (box->isVia()) {
+        auto it = data.snet_via_shapes_.find(getSNetViaLayer(box));
+        if (it != data.snet_via_shapes_.end()) {
+          it->second.remove(box->getBox(),
+                            [box](const SNetDBoxValue<odb::dbNet*>& value) {
+                              return value.first == box;
+                            });
+        }
+      } else {
+        auto it = data.snet_shapes_.find(box->getTechLayer());
+        if (it != data.snet_shapes_.end()) {
+          it->second.remove(box->getBox(),
+                            [box](const SNetValue<odb::dbNet*>& value) {
+                              return std::get<0>(value) == box;
+                            });
+        }
+      }
+    }
+  }
+
+  emit modifiedRegion(box->getBox());
+}
+
+odb::dbTechLayer* Search::getSNetViaLayer(odb::dbSBox* box) const
+{
+  if (auto via = box->getTechVia()) {
+    return via->getBottomLayer()->getUpperLayer();
+  }
+  auto block_via = box->getBlockVia();
+  return block_via->getBottomLayer()->getUpperLayer();
+}
+
+template <typename T>
+void Search::addTechLayers(odb::dbBlock* block, LayerMap<T>& layers)
+{
+  for (odb::dbTechLayer* layer : block->getTech()->getLayers()) {
+    layers[layer];
+  }
+}
+
 void Search::clear()
 {
   child_block_data_.clear();
@@ -258,30 +531,57 @@ void Search::updateShapes(odb::dbBlock* block)
     return;  // already done by another thread
   }
 
-  data.box_shapes_.clear();
-  data.snet_via_shapes_.clear();
-  data.snet_shapes_.clear();
+  clearTrees(data.box_shapes_);
+  clearTrees(data.snet_via_shapes_);
+  clearTrees(data.snet_shapes_);
+  addTechLayers(block, data.box_shapes_);
+  addTechLayers(block, data.snet_via_shapes_);
+  addTechLayers(block, data.snet_shapes_);
 
-  LayerMap<std::vector<SNetValue<odb::dbNet*>>> snet_shapes;
-  LayerMap<std::vector<SNetDBoxValue<odb::dbNet*>>> snet_net_via_shapes;
+  // Walking the wires dominates so the nets are split into chunks that are
+  // collected concurrently and then appended in order.
+  std::vector<odb::dbNet*> nets;
+  nets.reserve(block->getNets().size());
   for (odb::dbNet* net : block->getNets()) {
-    addSNet(net, snet_shapes, snet_net_via_shapes);
-  }
-  for (const auto& [layer, layer_shapes] : snet_shapes) {
-    data.snet_shapes_[layer] = RtreeSNetShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
+    nets.push_back(net);
+  }
+  const size_t min_nets_per_thread = 1000;
+  const size_t thread_count = std::max<size_t>(
+      1,
+      std::min<size_t>(std::thread::hardware_concurrency(),
+                       nets.size() / min_nets_per_thread));
+  struct Shapes
+  {
+    LayerMap<std::vector<SNetValue<odb::dbNet*>>> snet_shapes;
+    LayerMap<std::vector<SNetDBoxValue<odb::dbNet*>>> snet_via_shapes;
+    LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
+  };
+  std::vector<Shapes> chunks(thread_count);
+  auto collect = [&](size_t chunk) {
+    Shapes& shapes = chunks[chunk];
+    const size_t begin = nets.size() * chunk / thread_count;
+    const size_t end = nets.size() * (chunk + 1) / thread_count;
+    for (size_t i = begin; i < end; i++) {
+      addSNet(nets[i], shapes.snet_shapes, shapes.snet_via_shapes);
+      addNet(nets[i], shapes.net_shapes);
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (size_t chunk = 1; chunk < thread_count; chunk++) {
+    threads.emplace_back(collect, chunk);
   }
-  snet_shapes.clear();
-  for (const auto& [layer, layer_shapes] : snet_net_via_shapes) {
-    data.snet_via_shapes_[layer] = RtreeSNetDBoxShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
+  collect(0);
+  for (auto& thread : threads) {
+    thread.join();
   }
-  snet_net_via_shapes.clear();
 
-  LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
-  for (odb::dbNet* net : block->getNets()) {
-    addNet(net, net_shapes);
+  for (Shapes& shapes : chunks) {
+    appendShapes(shapes.snet_shapes, data.snet_shapes_);
+    appendShapes(shapes.snet_via_shapes, data.snet_via_shapes_);
+    appendShapes(shapes.net_shapes, data.box_shapes_);
   }
+  chunks.clear();
 
   for (odb::dbBTerm* term : block->getBTerms()) {
     for (odb::dbBPin* pin : term->getBPins()) {
@@ -295,14 +595,10 @@ void Search::updateShapes(odb::dbBlock* block)
           continue;
         }
         odb::dbTechLayer* layer = box->getTechLayer();
-        net_shapes[layer].emplace_back(box->getBox(), false, term->getNet());
+        data.box_shapes_[layer].insert({box->getBox(), false, term->getNet()});
       }
     }
   }
-  for (const auto& [layer, layer_shapes] : net_shapes) {
-    data.box_shapes_[layer] = RtreeRoutingShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
 
   data.shapes_init_ = true;
 }
@@ -315,14 +611,11 @@ void Search::updateFills(odb::dbBlock* block)
     return;  // already done by another thread
   }
 
-  data.fills_.clear();
+  clearTrees(data.fills_);
+  addTechLayers(block, data.fills_);
 
-  LayerMap<std::vector<odb::dbFill*>> fills;
   for (odb::dbFill* fill : block->getFills()) {
-    fills[fill->getTechLayer()].push_back(fill);
-  }
-  for (const auto& [layer, layer_fill] : fills) {
-    data.fills_[layer] = RtreeFill(layer_fill.begin(), layer_fill.end());
+    data.fills_[fill->getTechLayer()].insert(fill);
   }
 
   data.fills_init_ = true;
@@ -344,7 +637,7 @@ void Search::updateInsts(odb::dbBlock* block)
       insts.push_back(inst);
     }
   }
-  data.insts_ = RtreeDBox<odb::dbInst*>(insts.begin(), insts.end());
+  data.insts_.append(insts);
 
   data.insts_init_ = true;
 }
@@ -363,8 +656,7 @@ void Search::updateBlockages(odb::dbBlock* block)
   for (odb::dbBlockage* blockage : block->getBlockages()) {
     blockages.push_back(blockage);
   }
-  data.blockages_
-      = RtreeDBox<odb::dbBlockage*>(blockages.begin(), blockages.end());
+  data.blockages_.append(blockages);
 
   data.blockages_init_ = true;
 }
@@ -377,16 +669,12 @@ void Search::updateObstructions(odb::dbBlock* block)
     return;  // already done by another thread
   }
 
-  data.obstructions_.clear();
+  clearTrees(data.obstructions_);
+  addTechLayers(block, data.obstructions_);
 
-  LayerMap<std::vector<odb::dbObstruction*>> obstructions;
   for (odb::dbObstruction* obs : block->getObstructions()) {
     odb::dbBox* bbox = obs->getBBox();
-    obstructions[bbox->getTechLayer()].push_back(obs);
-  }
-  for (const auto& [layer, layer_obs] : obstructions) {
-    data.obstructions_[layer]
-        = RtreeDBox<odb::dbObstruction*>(layer_obs.begin(), layer_obs.end());
+    data.obstructions_[bbox->getTechLayer()].insert(obs);
   }
 
   data.obstructions_init_ = true;
@@ -406,7 +694,7 @@ void Search::updateRows(odb::dbBlock* block)
   for (odb::dbRow* row : block->getRows()) {
     rows.emplace_back(row->getBBox(), row);
   }
-  data.rows_ = RtreeRect<odb::dbRow*>(rows.begin(), rows.end());
+  data.rows_.append(rows);
 
   data.rows_init_ = true;
 }
@@ -443,14 +731,7 @@ void Search::addSNet(
   for (odb::dbSWire* swire : net->getSWires()) {
     for (odb::dbSBox* box : swire->getWires()) {
       if (box->isVia()) {
-        odb::dbTechLayer* layer;
-        if (auto via = box->getTechVia()) {
-          layer = via->getBottomLayer()->getUpperLayer();
-        } else {
-          auto block_via = box->getBlockVia();
-          layer = block_via->getBottomLayer()->getUpperLayer();
-        }
-        via_shapes[layer].emplace_back(box, net);
+        via_shapes[getSNetViaLayer(box)].emplace_back(box, net);
       } else {
         if (box->getDirection() == odb::dbSBox::OCTILINEAR) {
           net_shapes[box->getTechLayer()].emplace_back(box, box->getOct(), net);
@@ -604,18 +885,21 @@ Search::RoutingRange Search::searchBoxShapes(odb::dbBlock* block,
     return RoutingRange();
   }
 
-  auto& rtree = it->second;
+  ReadLock lock;
+  auto& rtree = it->second.get(lock);
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_size > 0) {
     return RoutingRange(
+        lock,
         rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinSizePredicate<odb::dbNet*>(min_size))),
         rtree.qend());
   }
 
-  return RoutingRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
+  return RoutingRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::SNetSBoxRange Search::searchSNetViaShapes(odb::dbBlock* block,
@@ -636,18 +920,21 @@ Search::SNetSBoxRange Search::searchSNetViaShapes(odb::dbBlock* block,
     return SNetSBoxRange();
   }
 
-  auto& rtree = it->second;
+  ReadLock lock;
+  auto& rtree = it->second.get(lock);
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_size > 0) {
     return SNetSBoxRange(
+        lock,
         rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinSizePredicate<odb::dbNet*>(min_size))),
         rtree.qend());
   }
 
-  return SNetSBoxRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
+  return SNetSBoxRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::SNetShapeRange Search::searchSNetShapes(odb::dbBlock* block,
@@ -668,11 +955,13 @@ Search::SNetShapeRange Search::searchSNetShapes(odb::dbBlock* block,
     return SNetShapeRange();
   }
 
-  auto& rtree = it->second;
+  ReadLock lock;
+  auto& rtree = it->second.get(lock);
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_size > 0) {
     return SNetShapeRange(
+        lock,
         rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinSizePredicate<odb::dbNet*>(min_size))
@@ -681,6 +970,7 @@ Search::SNetShapeRange Search::searchSNetShapes(odb::dbBlock* block,
   }
 
   return SNetShapeRange(
+      lock,
       rtree.qbegin(
           bgi::intersects(query)
           && bgi::satisfies(PolygonIntersectPredicate<odb::dbNet*>(query))),
@@ -705,17 +995,20 @@ Search::FillRange Search::searchFills(odb::dbBlock* block,
     return FillRange();
   }
 
-  auto& rtree = it->second;
+  ReadLock lock;
+  auto& rtree = it->second.get(lock);
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_size > 0) {
     return FillRange(
+        lock,
         rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinSizePredicate<odb::dbFill*>(min_size))),
         rtree.qend());
   }
 
-  return FillRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
+  return FillRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::InstRange Search::searchInsts(odb::dbBlock* block,
@@ -730,17 +1023,21 @@ Search::InstRange Search::searchInsts(odb::dbBlock* block,
     updateInsts(block);
   }
 
+  ReadLock lock;
+  auto& rtree = data.insts_.get(lock);
+
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_height > 0) {
     return InstRange(
-        data.insts_.qbegin(
+        lock,
+        rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinHeightPredicate<odb::dbInst*>(min_height))),
-        data.insts_.qend());
+        rtree.qend());
   }
 
-  return InstRange(data.insts_.qbegin(bgi::intersects(query)),
-                   data.insts_.qend());
+  return InstRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::BlockageRange Search::searchBlockages(odb::dbBlock* block,
@@ -755,18 +1052,22 @@ Search::BlockageRange Search::searchBlockages(odb::dbBlock* block,
     updateBlockages(block);
   }
 
+  ReadLock lock;
+  auto& rtree = data.blockages_.get(lock);
+
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_height > 0) {
     return BlockageRange(
-        data.blockages_.qbegin(
+        lock,
+        rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(
                 MinHeightPredicate<odb::dbBlockage*>(min_height))),
-        data.blockages_.qend());
+        rtree.qend());
   }
 
-  return BlockageRange(data.blockages_.qbegin(bgi::intersects(query)),
-                       data.blockages_.qend());
+  return BlockageRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::ObstructionRange Search::searchObstructions(odb::dbBlock* block,
@@ -787,17 +1088,20 @@ Search::ObstructionRange Search::searchObstructions(odb::dbBlock* block,
     return ObstructionRange();
   }
 
-  auto& rtree = it->second;
+  ReadLock lock;
+  auto& rtree = it->second.get(lock);
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_size > 0) {
     return ObstructionRange(
+        lock,
         rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinSizePredicate<odb::dbObstruction*>(min_size))),
         rtree.qend());
   }
 
-  return ObstructionRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
+  return ObstructionRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 Search::RowRange Search::searchRows(odb::dbBlock* block,
@@ -812,16 +1116,21 @@ Search::RowRange Search::searchRows(odb::dbBlock* block,
     updateRows(block);
   }
 
+  ReadLock lock;
+  auto& rtree = data.rows_.get(lock);
+
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
   if (min_height > 0) {
     return RowRange(
-        data.rows_.qbegin(
+        lock,
+        rtree.qbegin(
             bgi::intersects(query)
             && bgi::satisfies(MinHeightPredicate<odb::dbRow*>(min_height))),
-        data.rows_.qend());
+        rtree.qend());
   }
 
-  return RowRange(data.rows_.qbegin(bgi::intersects(query)), data.rows_.qend());
+  return RowRange(
+      lock, rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
 }  // namespace gui
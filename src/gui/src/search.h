@@ -33,9 +33,14 @@
 #pragma once
 
 #include <QObject>
+#include <atomic>
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
@@ -51,8 +56,15 @@ namespace bgi = boost::geometry::index;
 // rtree.  OpenDB also has some code for this purpose but I
 // find it confusing so just made a simpler solution for now.
 //
-// Currently this class is static once built and doesn't follow
-// db changes.  TODO: this should be into an observer of OpenDB.
+// The shapes are collected in parallel the first time a category is
+// searched but the per layer rtrees are only packed when their layer is
+// first searched.  Instance, fill, blockage, obstruction and special wire
+// edits are applied incrementally from the db callbacks; other changes
+// cause the category to be rebuilt.
+//
+// The render threads iterate the returned ranges while the db callbacks
+// edit the rtrees so each range holds a shared lock on its rtree until it
+// is destroyed.  Edits and rebuilds take the lock exclusively.
 class Search : public QObject, public odb::dbBlockCallBackObj
 {
   Q_OBJECT
@@ -121,6 +133,37 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   using RtreeFill
       = bgi::rtree<odb::dbFill*, bgi::quadratic<16>, FillIndexableGetter>;
 
+  using ReadLock = std::shared_ptr<std::shared_lock<std::shared_mutex>>;
+
+  // An rtree whose values are gathered up front but which is only
+  // bulk loaded (packed) when it is first searched.  Edits made before
+  // that are applied to the pending values.
+  template <typename Tree>
+  class LazyRtree
+  {
+   public:
+    using Value = typename Tree::value_type;
+
+    // Returns the packed tree.  lock is set to a shared lock that must
+    // be held while the tree is searched.
+    const Tree& get(ReadLock& lock);
+
+    // Drop all the values so the tree can be refilled
+    void clear();
+    // Moves the values to the pending ones
+    void append(std::vector<Value>& values);
+    void insert(const Value& value);
+    // Remove the values overlapping box that satisfy pred
+    template <typename Predicate>
+    void remove(const odb::Rect& box, const Predicate& pred);
+
+   private:
+    std::vector<Value> values_;
+    Tree tree_;
+    bool built_{false};
+    std::shared_mutex mutex_;
+  };
+
   // This is an iterator range for return values
   template <typename Tree>
   class Range
@@ -129,7 +172,8 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     using Iterator = typename Tree::const_query_iterator;
 
     Range() = default;
-    Range(const Iterator& begin, const Iterator& end) : begin_(begin), end_(end)
+    Range(const ReadLock& lock, const Iterator& begin, const Iterator& end)
+        : lock_(lock), begin_(begin), end_(end)
     {
     }
 
@@ -137,6 +181,7 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     Iterator end() { return end_; }
 
    private:
+    ReadLock lock_;
     Iterator begin_;
     Iterator end_;
   };
@@ -238,10 +283,13 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   // From dbBlockCallBackObj
   void inDbNetDestroy(odb::dbNet* net) override;
   void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                odb::dbMaster* master) override;
   void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
   void inDbInstPlacementStatusBefore(
       odb::dbInst* inst,
       const odb::dbPlacementStatus& status) override;
+  void inDbPreMoveInst(odb::dbInst* inst) override;
   void inDbPostMoveInst(odb::dbInst* inst) override;
   void inDbBPinCreate(odb::dbBPin* pin) override;
   void inDbBPinDestroy(odb::dbBPin* pin) override;
@@ -264,6 +312,8 @@ class Search : public QObject, public odb::dbBlockCallBackObj
 
  signals:
   void modified();
+  // only the shapes overlapping region need to be redrawn
+  void modifiedRegion(const odb::Rect& region);
   void newBlock(odb::dbBlock* block);
 
  private:
@@ -292,32 +342,44 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void announceModified(std::atomic_bool& flag);
   BlockData& getData(odb::dbBlock* block);
 
+  // Incremental updates of the top block's structures
+  void addInst(odb::dbInst* inst);
+  void removeInst(odb::dbInst* inst);
+  void addSBox(odb::dbSBox* box);
+  void removeSBox(odb::dbSBox* box);
+  odb::dbTechLayer* getSNetViaLayer(odb::dbSBox* box) const;
+
+  // Create an (empty) entry for every layer so that incremental updates
+  // never need to add to the maps while they are being searched.
+  template <typename T>
+  void addTechLayers(odb::dbBlock* block, LayerMap<T>& layers);
+
   odb::dbBlock* top_block_{nullptr};
 
   struct BlockData
   {
     // The net is used for filter shapes by net type
-    LayerMap<RtreeRoutingShapes<odb::dbNet*>> box_shapes_;
+    LayerMap<LazyRtree<RtreeRoutingShapes<odb::dbNet*>>> box_shapes_;
     // Special net vias may be large multi-cut vias.  It is more efficient
     // to store the dbSBox (ie the via) than all the cuts.  This is
     // particularly true when you have parallel straps like m1 & m2 in asap7.
-    LayerMap<RtreeSNetDBoxShapes<odb::dbNet*>> snet_via_shapes_;
-    LayerMap<RtreeSNetShapes<odb::dbNet*>> snet_shapes_;
+    LayerMap<LazyRtree<RtreeSNetDBoxShapes<odb::dbNet*>>> snet_via_shapes_;
+    LayerMap<LazyRtree<RtreeSNetShapes<odb::dbNet*>>> snet_shapes_;
     std::atomic_bool shapes_init_{false};
     std::mutex shapes_init_mutex_;
-    LayerMap<RtreeFill> fills_;
+    LayerMap<LazyRtree<RtreeFill>> fills_;
     std::atomic_bool fills_init_{false};
     std::mutex fills_init_mutex_;
-    RtreeDBox<odb::dbInst*> insts_;
+    LazyRtree<RtreeDBox<odb::dbInst*>> insts_;
     std::atomic_bool insts_init_{false};
     std::mutex insts_init_mutex_;
-    RtreeDBox<odb::dbBlockage*> blockages_;
+    LazyRtree<RtreeDBox<odb::dbBlockage*>> blockages_;
     std::atomic_bool blockages_init_{false};
     std::mutex blockages_init_mutex_;
-    LayerMap<RtreeDBox<odb::dbObstruction*>> obstructions_;
+    LayerMap<LazyRtree<RtreeDBox<odb::dbObstruction*>>> obstructions_;
     std::atomic_bool obstructions_init_{false};
     std::mutex obstructions_init_mutex_;
-    RtreeRect<odb::dbRow*> rows_;
+    LazyRtree<RtreeRect<odb::dbRow*>> rows_;
     std::atomic_bool rows_init_{false};
     std::mutex rows_init_mutex_;
   };
@@ -0,0 +1,118 @@
+#define BOOST_TEST_MODULE TestSearch
+#include <atomic>
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+#include "search.h"
+
+namespace gui {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+constexpr int num_insts = 100;
+
+struct F_SEARCH
+{
+  F_SEARCH()
+  {
+    db = odb::createSimpleDB();
+    block = db->getChip()->getBlock();
+    odb::dbMaster* and2 = db->findMaster("and2");
+    for (int i = 0; i < num_insts; i++) {
+      const std::string name = "inst" + std::to_string(i);
+      odb::dbInst* inst = odb::dbInst::create(block, and2, name.c_str());
+      inst->setLocation(i * 2000, 0);
+      inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+      insts.push_back(inst);
+    }
+    search.setTopBlock(block);
+  }
+  ~F_SEARCH() { odb::dbDatabase::destroy(db); }
+
+  std::vector<odb::dbInst*> find(int x_lo, int y_lo, int x_hi, int y_hi)
+  {
+    std::vector<odb::dbInst*> found;
+    auto range = search.searchInsts(block, x_lo, y_lo, x_hi, y_hi);
+    for (odb::dbInst* inst : range) {
+      found.push_back(inst);
+    }
+    return found;
+  }
+
+  odb::dbDatabase* db;
+  odb::dbBlock* block;
+  std::vector<odb::dbInst*> insts;
+  Search search;
+};
+
+BOOST_FIXTURE_TEST_CASE(incremental_insts, F_SEARCH)
+{
+  // Build the rtree before the edits so they take the incremental path
+  BOOST_TEST(find(0, 0, num_insts * 2000, 1000).size() == num_insts);
+
+  odb::dbInst* moved = insts[10];
+  moved->setLocation(0, 100000);
+  BOOST_TEST(find(20000, 0, 21000, 1000).empty());
+  const auto at_new = find(0, 100000, 1000, 101000);
+  BOOST_TEST(at_new.size() == 1);
+  BOOST_TEST(at_new[0] == moved);
+
+  odb::dbInst::destroy(insts[20]);
+  BOOST_TEST(find(40000, 0, 41000, 1000).empty());
+  BOOST_TEST(find(0, 0, num_insts * 2000, 200000).size() == num_insts - 1);
+
+  insts[30]->setPlacementStatus(odb::dbPlacementStatus::UNPLACED);
+  BOOST_TEST(find(0, 0, num_insts * 2000, 200000).size() == num_insts - 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(edits_while_searching, F_SEARCH)
+{
+  // The render threads iterate while the db callbacks edit the rtree.  A
+  // move removes and then reinserts the instance so a reader may miss the
+  // one being moved.
+  std::atomic_bool done = false;
+  std::atomic_int min_count = num_insts;
+  std::atomic_int max_count = 0;
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([&] {
+      while (!done) {
+        int count = 0;
+        for (odb::dbInst* inst :
+             search.searchInsts(block, 0, 0, num_insts * 2000, 200000)) {
+          count += inst != nullptr;
+        }
+        int prev = min_count;
+        while (count < prev && !min_count.compare_exchange_weak(prev, count)) {
+        }
+        prev = max_count;
+        while (count > prev && !max_count.compare_exchange_weak(prev, count)) {
+        }
+      }
+    });
+  }
+
+  for (int pass = 0; pass < 20; pass++) {
+    for (int i = 0; i < num_insts; i++) {
+      insts[i]->setLocation(i * 2000, (pass % 2) * 100000);
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  BOOST_TEST(min_count >= num_insts - 1);
+  BOOST_TEST(max_count <= num_insts);
+  BOOST_TEST(find(0, 100000, num_insts * 2000, 101000).size() == num_insts);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace gui
@@ -918,6 +918,20 @@ class dbBlock : public dbObject
   ///
   dbBox* getBBox();
 
+  ///
+  /// Freeze or thaw this block. While a block is frozen, lazily computed
+  /// data (such as the bounding box) is brought up to date and creating,
+  /// destroying, moving or reconnecting objects is an error. Getters,
+  /// name lookups and dbSet iteration on a frozen block may then be used
+  /// from any number of threads without locking.
+  ///
+  void setFrozen(bool frozen);
+
+  ///
+  /// Returns true if the block is frozen.
+  ///
+  bool isFrozen();
+
   ///
   /// Get the chip this block belongs too.
   ///
@@ -1064,6 +1078,13 @@ class dbBlock : public dbObject
   ///
   dbInst* findInst(const char* name);
 
+  ///
+  /// Find the instance named by the hierarchical name of parent,
+  /// divider and name without building the full name.
+  /// Returns nullptr if the object was not found.
+  ///
+  dbInst* findInst(dbModInst* parent, const char* name, char divider = '/');
+
   ///
   /// Find a specific module in this block.
   /// Returns nullptr if the object was not found.
@@ -1166,6 +1187,13 @@ class dbBlock : public dbObject
   ///
   dbNet* findNet(const char* name);
 
+  ///
+  /// Find the net named by the hierarchical name of parent,
+  /// divider and name without building the full name.
+  /// Returns nullptr if the object was not found.
+  ///
+  dbNet* findNet(dbModInst* parent, const char* name, char divider = '/');
+
   ///
   /// Find a set of nets. Each name can be real name, or Nxxx, or xxx,
   /// where xxx is the net oid.
@@ -3837,6 +3865,15 @@ class dbWire : public dbObject
   ///
   bool getViaBoxes(int via_shape_id, std::vector<dbShape>& shapes);
 
+  ///
+  /// Decode all the shapes of this wire into shapes, replacing its
+  /// contents. The result matches a walk with dbWireShapeItr, but the wire
+  /// is decoded in a single pass and junctions are resolved from an index
+  /// built during the pass. Reusing the buffer across wires avoids
+  /// reallocating it per wire.
+  ///
+  void getShapes(std::vector<dbShape>& shapes);
+
   ///
   /// Returns true if this wire is a global-wire
   ///
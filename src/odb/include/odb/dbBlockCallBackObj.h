@@ -80,12 +80,14 @@ class dbBlockCallBackObj
   virtual void inDbInstSwapMasterAfter(dbInst*) {}
   virtual void inDbPreMoveInst(dbInst*) {}
   virtual void inDbPostMoveInst(dbInst*) {}
+  virtual void inDbInstPostRename(dbInst*) {}
   // dbInst End
 
   // dbNet Start
   virtual void inDbNetCreate(dbNet*) {}
   virtual void inDbNetDestroy(dbNet*) {}
   virtual void inDbNetPreMerge(dbNet*, dbNet*) {}
+  virtual void inDbNetPostRename(dbNet*) {}
   // dbNet End
 
   // dbITerm Start
@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace odb {
+
+//
+// dbWireCompact - A compact encoding of a wire's opcode and operand arrays.
+//
+// Each entry is stored as its opcode byte followed by the operand as a
+// zigzag varint.  X and Y coordinates are stored relative to the previous
+// coordinate on the same axis and junction references relative to the
+// entry that holds them, so a routed wire typically needs two or three
+// bytes per entry instead of five.
+//
+// The encoding is only used to store wires in .odb files; it is decoded as
+// a whole since the in memory wire keeps the arrays.
+//
+class dbWireCompact
+{
+ public:
+  void encode(const std::vector<unsigned char>& opcodes,
+              const std::vector<int>& data);
+
+  // Decode every entry into the caller's buffers, which are resized to
+  // the entry count.  Returns false if the bytes are truncated or do not
+  // hold exactly the entry count.
+  bool decode(std::vector<unsigned char>& opcodes,
+              std::vector<int>& data) const;
+
+  // Number of wire entries.
+  int size() const { return count_; }
+  // Bytes used by the encoding.
+  size_t byteSize() const { return bytes_.size(); }
+
+  const std::vector<unsigned char>& getBytes() const { return bytes_; }
+  // Adopt an encoding produced by getBytes.
+  void setBytes(std::vector<unsigned char> bytes, int count);
+
+ private:
+  std::vector<unsigned char> bytes_;
+  int count_ = 0;
+};
+
+}  // namespace odb
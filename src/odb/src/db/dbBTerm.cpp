@@ -702,6 +702,7 @@ dbBTerm* dbBTerm::create(dbNet* net_, const char* name)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("create a bterm");
 
   if (block->_bterm_hash.hasMember(name)) {
     return nullptr;
@@ -807,6 +808,7 @@ void dbBTerm::destroy(dbBTerm* bterm_)
 {
   _dbBTerm* bterm = (_dbBTerm*) bterm_;
   _dbBlock* block = (_dbBlock*) bterm->getOwner();
+  block->checkNotFrozen("destroy a bterm");
 
   if (bterm->_net) {
     _dbNet* net = block->_net_tbl->getPtr(bterm->_net);
@@ -35,6 +35,7 @@
 #include <errno.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <set>
@@ -97,6 +98,7 @@
 #include "dbModuleModNetModBTermItr.h"
 #include "dbModuleModNetModITermItr.h"
 #include "dbNameCache.h"
+#include "dbNameIndex.hpp"
 #include "dbNet.h"
 #include "dbNetTrack.h"
 #include "dbNetTrackItr.h"
@@ -160,8 +162,6 @@ static void unlink_child_from_parent(_dbBlock* child, _dbBlock* parent);
 // TODO: Bounding box updates...
 template class dbTable<_dbBlock>;
 
-template class dbHashTable<_dbNet>;
-template class dbHashTable<_dbInst>;
 template class dbIntHashTable<_dbInstHdr>;
 template class dbHashTable<_dbBTerm>;
 
@@ -345,8 +345,8 @@ _dbBlock::_dbBlock(_dbDatabase* db)
   dft_ptr->initialize();
   _dft = dft_ptr->getId();
 
-  _net_hash.setTable(_net_tbl);
-  _inst_hash.setTable(_inst_tbl);
+  _net_index.setTable(_net_tbl);
+  _inst_index.setTable(_inst_tbl);
   _module_hash.setTable(_module_tbl);
   _modinst_hash.setTable(_modinst_tbl);
   _modbterm_hash.setTable(_modbterm_tbl);
@@ -422,6 +422,7 @@ _dbBlock::_dbBlock(_dbDatabase* db)
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _frozen = false;
 }
 
 _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
@@ -445,8 +446,6 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
       _parent_block(block._parent_block),
       _parent_inst(block._parent_inst),
       _top_module(block._top_module),
-      _net_hash(block._net_hash),
-      _inst_hash(block._inst_hash),
       _module_hash(block._module_hash),
       _modinst_hash(block._modinst_hash),
       _powerdomain_hash(block._powerdomain_hash),
@@ -563,8 +562,8 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
 
   _dft_tbl = new dbTable<_dbDft>(db, this, *block._dft_tbl);
 
-  _net_hash.setTable(_net_tbl);
-  _inst_hash.setTable(_inst_tbl);
+  _net_index.setTable(_net_tbl);
+  _inst_index.setTable(_inst_tbl);
   _module_hash.setTable(_module_tbl);
   _modinst_hash.setTable(_modinst_tbl);
   _group_hash.setTable(_group_tbl);
@@ -632,6 +631,9 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
   _extmi = block._extmi;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _frozen = false;
+
+  buildNameIndexes();
 }
 
 _dbBlock::~_dbBlock()
@@ -966,8 +968,6 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << block._parent_block;
   stream << block._parent_inst;
   stream << block._top_module;
-  stream << block._net_hash;
-  stream << block._inst_hash;
   stream << block._module_hash;
   stream << block._modinst_hash;
   if (db->isSchema(db_schema_update_hierarchy)) {
@@ -1089,8 +1089,13 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._parent_block;
   stream >> block._parent_inst;
   stream >> block._top_module;
-  stream >> block._net_hash;
-  stream >> block._inst_hash;
+  if (!db->isSchema(db_schema_block_name_index)) {
+    // The names are indexed by buildNameIndexes
+    dbHashTable<_dbNet> net_hash;
+    dbHashTable<_dbInst> inst_hash;
+    stream >> net_hash;
+    stream >> inst_hash;
+  }
   stream >> block._module_hash;
   stream >> block._modinst_hash;
   if (db->isSchema(db_schema_update_hierarchy)) {
@@ -1181,6 +1186,8 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
     stream >> *block._dft_tbl;
   }
 
+  block.buildNameIndexes();
+
   //---------------------------------------------------------- stream in
   // properties
   // TOM
@@ -1315,14 +1322,6 @@ bool _dbBlock::operator==(const _dbBlock& rhs) const
     return false;
   }
 
-  if (_net_hash != rhs._net_hash) {
-    return false;
-  }
-
-  if (_inst_hash != rhs._inst_hash) {
-    return false;
-  }
-
   if (_module_hash != rhs._module_hash) {
     return false;
   }
@@ -1587,8 +1586,6 @@ void _dbBlock::differences(dbDiff& diff,
   DIFF_FIELD(_top_module);
 
   if (!diff.deepDiff()) {
-    DIFF_HASH_TABLE(_net_hash);
-    DIFF_HASH_TABLE(_inst_hash);
     DIFF_HASH_TABLE(_module_hash);
     DIFF_HASH_TABLE(_modinst_hash);
     DIFF_HASH_TABLE(_powerdomain_hash);
@@ -1688,8 +1685,6 @@ void _dbBlock::out(dbDiff& diff, char side, const char* field) const
   DIFF_OUT_FIELD(_top_module);
 
   if (!diff.deepDiff()) {
-    DIFF_OUT_HASH_TABLE(_net_hash);
-    DIFF_OUT_HASH_TABLE(_inst_hash);
     DIFF_OUT_HASH_TABLE(_module_hash);
     DIFF_OUT_HASH_TABLE(_modinst_hash);
     DIFF_OUT_HASH_TABLE(_powerdomain_hash);
@@ -1786,6 +1781,29 @@ dbBox* dbBlock::getBBox()
   return (dbBox*) bbox;
 }
 
+void dbBlock::setFrozen(bool frozen)
+{
+  _dbBlock* block = (_dbBlock*) this;
+
+  if (frozen && block->_flags._valid_bbox == 0) {
+    ComputeBBox();
+  }
+
+  block->_frozen = frozen;
+}
+
+bool dbBlock::isFrozen()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  return block->_frozen;
+}
+
+void _dbBlock::reportFrozen(const char* action)
+{
+  getLogger()->error(
+      utl::ODB, 447, "Cannot {} while block {} is frozen.", action, _name);
+}
+
 void dbBlock::ComputeBBox()
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2043,7 +2061,39 @@ void dbBlock::setComponentMaskShift(const std::vector<dbTechLayer*>& layers)
 dbInst* dbBlock::findInst(const char* name)
 {
   _dbBlock* block = (_dbBlock*) this;
-  return (dbInst*) block->_inst_hash.find(name);
+  return (dbInst*) block->_inst_index.find(name);
+}
+
+// Build the parts of the name of a child of parent without concatenating
+// them, matching the names built with dbModInst::getHierarchicalName.
+static void hierarchicalNameParts(dbBlock* block,
+                                  dbModInst* parent,
+                                  const char* divider,
+                                  const char* name,
+                                  std::vector<const char*>& parts)
+{
+  dbModule* top_module = block->getTopModule();
+  for (dbModInst* mod_inst = parent;;) {
+    parts.push_back(mod_inst->getName());
+    dbModule* module = mod_inst->getParent();
+    if (module == top_module) {
+      break;
+    }
+    parts.push_back("/");
+    mod_inst = module->getModInst();
+  }
+  std::reverse(parts.begin(), parts.end());
+  parts.push_back(divider);
+  parts.push_back(name);
+}
+
+dbInst* dbBlock::findInst(dbModInst* parent, const char* name, char divider)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  const char divider_str[2] = {divider, '\0'};
+  std::vector<const char*> parts;
+  hierarchicalNameParts(this, parent, divider_str, name, parts);
+  return (dbInst*) block->_inst_index.find(parts);
 }
 
 dbModule* dbBlock::findModule(const char* name)
@@ -2157,7 +2207,16 @@ dbSet<dbCapNode> dbBlock::getCapNodes()
 dbNet* dbBlock::findNet(const char* name)
 {
   _dbBlock* block = (_dbBlock*) this;
-  return (dbNet*) block->_net_hash.find(name);
+  return (dbNet*) block->_net_index.find(name);
+}
+
+dbNet* dbBlock::findNet(dbModInst* parent, const char* name, char divider)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  const char divider_str[2] = {divider, '\0'};
+  std::vector<const char*> parts;
+  hierarchicalNameParts(this, parent, divider_str, name, parts);
+  return (dbNet*) block->_net_index.find(parts);
 }
 
 bool dbBlock::findSomeMaster(const char* names, std::vector<dbMaster*>& masters)
@@ -2205,7 +2264,7 @@ bool dbBlock::findSomeNet(const char* names, std::vector<dbNet*>& nets)
   char* netName;
   for (int ii = 0; ii < parser->getWordCnt(); ii++) {
     netName = parser->get(ii);
-    net = (dbNet*) block->_net_hash.find(netName);
+    net = (dbNet*) block->_net_index.find(netName);
     if (!net) {
       noid = netName[0] == 'N' ? atoi(&netName[1]) : atoi(&netName[0]);
       net = dbNet::getValidNet(this, noid);
@@ -2232,7 +2291,7 @@ bool dbBlock::findSomeInst(const char* names, std::vector<dbInst*>& insts)
   char* instName;
   for (int ii = 0; ii < parser->getWordCnt(); ii++) {
     instName = parser->get(ii);
-    inst = (dbInst*) block->_inst_hash.find(instName);
+    inst = (dbInst*) block->_inst_index.find(instName);
     if (!inst) {
       ioid = instName[0] == 'I' ? atoi(&instName[1]) : atoi(&instName[0]);
       inst = dbInst::getValidInst(this, ioid);
@@ -4098,6 +4157,31 @@ int dbBlock::addGlobalConnect(dbRegion* region,
   return 0;
 }
 
+// Move the instance and net names of a block that was read or copied,
+// which are allocated one at a time, into the name arena and index them.
+void _dbBlock::buildNameIndexes()
+{
+  _inst_index.clear();
+  dbSet<dbInst> insts(this, _inst_tbl);
+  for (dbInst* inst : insts) {
+    _dbInst* obj = (_dbInst*) inst;
+    char* name = _name_arena.add(obj->_name);
+    free((void*) obj->_name);
+    obj->_name = name;
+    _inst_index.insert(obj);
+  }
+
+  _net_index.clear();
+  dbSet<dbNet> nets(this, _net_tbl);
+  for (dbNet* net : nets) {
+    _dbNet* obj = (_dbNet*) net;
+    char* name = _name_arena.add(obj->_name);
+    free((void*) obj->_name);
+    obj->_name = name;
+    _net_index.insert(obj);
+  }
+}
+
 int _dbBlock::globalConnect(const std::vector<dbGlobalConnect*>& connects)
 {
   _dbBlock* dbblock = (_dbBlock*) this;
@@ -32,12 +32,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <vector>
 
 #include "dbCore.h"
 #include "dbHashTable.h"
 #include "dbIntHashTable.h"
+#include "dbNameArena.h"
+#include "dbNameIndex.h"
 #include "dbPagedVector.h"
 #include "dbVector.h"
 #include "odb/dbTransform.h"
@@ -176,8 +179,6 @@ class _dbBlock : public _dbObject
   dbId<_dbBlock> _parent_block;  // Up hierarchy: TWG
   dbId<_dbInst> _parent_inst;    // Up hierarchy: TWG
   dbId<_dbModule> _top_module;
-  dbHashTable<_dbNet> _net_hash;
-  dbHashTable<_dbInst> _inst_hash;
   dbHashTable<_dbModule> _module_hash;
   dbHashTable<_dbModInst> _modinst_hash;
   dbHashTable<_dbPowerDomain> _powerdomain_hash;
@@ -254,6 +255,8 @@ class _dbBlock : public _dbObject
   dbExtControl* _extControl;
 
   // NON-PERSISTANT-NON-STREAMED-MEMBERS
+  // Read by worker threads while a writer holds the block frozen.
+  std::atomic<bool> _frozen;
   dbNetBTermItr* _net_bterm_itr;
   dbNetITermItr* _net_iterm_itr;
   dbInstITermItr* _inst_iterm_itr;
@@ -295,9 +298,24 @@ class _dbBlock : public _dbObject
   dbJournal* _journal;
   dbJournal* _journal_pending;
 
+  // Instance and net names and the indexes used to find them by name.
+  // The indexes are not persistent; they are rebuilt when a block is read.
+  dbNameArena _name_arena;
+  dbNameIndex<_dbNet> _net_index;
+  dbNameIndex<_dbInst> _inst_index;
+
   _dbBlock(_dbDatabase* db);
   _dbBlock(_dbDatabase* db, const _dbBlock& block);
   ~_dbBlock();
+
+  // Raises an error if the block is frozen; action names the mutation.
+  void checkNotFrozen(const char* action)
+  {
+    if (_frozen) {
+      reportFrozen(action);
+    }
+  }
+  void reportFrozen(const char* action);
   void add_rect(const Rect& rect);
   void add_oct(const Oct& oct);
   void remove_rect(const Rect& rect);
@@ -313,6 +331,7 @@ class _dbBlock : public _dbObject
   void differences(dbDiff& diff, const char* field, const _dbBlock& rhs) const;
   void out(dbDiff& diff, char side, const char* field) const;
 
+  void buildNameIndexes();
   int globalConnect(const std::vector<dbGlobalConnect*>& connects);
   _dbTech* getTech();
 
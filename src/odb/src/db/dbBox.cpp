@@ -62,6 +62,15 @@ namespace odb {
 
 template class dbTable<_dbBox>;
 
+// Boxes owned by a block may not change while the block is frozen.
+static void checkBlockNotFrozen(_dbBox* box, const char* action)
+{
+  dbObject* owner = box->getOwner();
+  if (owner->getObjectType() == dbBlockObj) {
+    ((_dbBlock*) owner)->checkNotFrozen(action);
+  }
+}
+
 bool _dbBox::isOct() const
 {
   return _flags._octilinear;
@@ -682,6 +691,7 @@ int dbBox::getDesignRuleWidth() const
 void dbBox::setDesignRuleWidth(int width)
 {
   _dbBox* box = (_dbBox*) this;
+  checkBlockNotFrozen(box, "change a box design rule width");
   box->design_rule_width_ = width;
 }
 
@@ -806,6 +816,7 @@ uint dbBox::getLayerMask()
 void dbBox::setLayerMask(uint mask)
 {
   _dbBox* box = (_dbBox*) this;
+  checkBlockNotFrozen(box, "change a box mask");
   box->checkMask(mask);
 
   if (box->_flags._layer_id == 0 && mask != 0) {
@@ -826,6 +837,7 @@ dbBox* dbBox::create(dbBPin* bpin_,
 {
   _dbBPin* bpin = (_dbBPin*) bpin_;
   _dbBlock* block = (_dbBlock*) bpin->getOwner();
+  block->checkNotFrozen("create a box");
 
   _dbBox* box = block->_box_tbl->create();
   box->_flags._octilinear = false;
@@ -862,6 +874,7 @@ dbBox* dbBox::create(dbVia* via_,
 {
   _dbVia* via = (_dbVia*) via_;
   _dbBlock* block = (_dbBlock*) via->getOwner();
+  block->checkNotFrozen("create a box");
   _dbBox* box = block->_box_tbl->create();
   box->_flags._octilinear = false;
   box->_flags._layer_id = layer_->getImpl()->getOID();
@@ -1083,6 +1096,7 @@ dbBox* dbBox::create(dbRegion* region_, int x1, int y1, int x2, int y2)
 {
   _dbRegion* region = (_dbRegion*) region_;
   _dbBlock* block = (_dbBlock*) region->getOwner();
+  block->checkNotFrozen("create a box");
   _dbBox* box = block->_box_tbl->create();
   box->_flags._octilinear = false;
   box->_flags._owner_type = dbBoxOwner::REGION;
@@ -1102,6 +1116,7 @@ dbBox* dbBox::create(dbInst* inst_, int x1, int y1, int x2, int y2)
 {
   _dbInst* inst = (_dbInst*) inst_;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("create a box");
 
   if (inst->_halo) {
     return nullptr;
@@ -1142,6 +1157,7 @@ bool dbBox::isVisited()
 void dbBox::setVisited(bool value)
 {
   _dbBox* box = (_dbBox*) this;
+  checkBlockNotFrozen(box, "mark a box visited");
   box->_flags._visited = (value == true) ? 1 : 0;
 }
 
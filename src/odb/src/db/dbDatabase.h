@@ -70,7 +70,13 @@ namespace odb {
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
 
-const uint db_schema_minor = 90;  // Current revision number
+const uint db_schema_minor = 92;  // Current revision number
+
+// Revision where the dbBlock instance and net name hash tables were removed
+const uint db_schema_block_name_index = 92;
+
+// Revision where dbWire is stored with the compact delta encoding
+const uint db_schema_compact_wire = 91;
 
 // Revision where via layer was added to dbGuide
 const uint db_schema_db_guide_via_layer = 90;
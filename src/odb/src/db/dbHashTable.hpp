@@ -37,9 +37,10 @@
 
 namespace odb {
 
-inline unsigned int hash_string(const char* str)
+// Continue hash with the characters of str, so the hash of a name can be
+// computed one segment at a time.
+inline unsigned int hash_string(unsigned int hash, const char* str)
 {
-  unsigned int hash = 0;
   int c;
 
   while ((c = static_cast<unsigned char>(*str++)) != '\0') {
@@ -49,6 +50,11 @@ inline unsigned int hash_string(const char* str)
   return hash;
 }
 
+inline unsigned int hash_string(const char* str)
+{
+  return hash_string(0, str);
+}
+
 template <class T>
 dbHashTable<T>::dbHashTable()
 {
@@ -388,6 +388,7 @@ void dbITerm::connect(dbNet* net_)
   _dbITerm* iterm = (_dbITerm*) this;
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) iterm->getOwner();
+  block->checkNotFrozen("connect an iterm");
 
   _dbInst* inst = iterm->getInst();
   if (!net_) {
@@ -480,6 +481,7 @@ void dbITerm::connect(dbModNet* mod_net)
   _dbITerm* iterm = (_dbITerm*) this;
   _dbModNet* _mod_net = (_dbModNet*) mod_net;
   _dbBlock* block = (_dbBlock*) iterm->getOwner();
+  block->checkNotFrozen("connect an iterm");
 
   if (iterm->_mnet == _mod_net->getId()) {
     return;
@@ -515,6 +517,7 @@ void dbITerm::connect(dbModNet* mod_net)
 void dbITerm::disconnect()
 {
   _dbITerm* iterm = (_dbITerm*) this;
+  ((_dbBlock*) iterm->getOwner())->checkNotFrozen("disconnect an iterm");
 
   if (iterm->_net == 0) {
     return;
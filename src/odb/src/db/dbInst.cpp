@@ -53,6 +53,7 @@
 #include "dbMTerm.h"
 #include "dbMaster.h"
 #include "dbModule.h"
+#include "dbNameIndex.hpp"
 #include "dbNet.h"
 #include "dbNullIterator.h"
 #include "dbRegion.h"
@@ -135,7 +136,6 @@ _dbInst::_dbInst(_dbDatabase*, const _dbInst& i)
       _x(i._x),
       _y(i._y),
       _weight(i._weight),
-      _next_entry(i._next_entry),
       _inst_hdr(i._inst_hdr),
       _bbox(i._bbox),
       _region(i._region),
@@ -159,9 +159,7 @@ _dbInst::_dbInst(_dbDatabase*, const _dbInst& i)
 
 _dbInst::~_dbInst()
 {
-  if (_name) {
-    free((void*) _name);
-  }
+  // _name is owned by the block name arena.
 }
 
 dbOStream& operator<<(dbOStream& stream, const _dbInst& inst)
@@ -172,7 +170,6 @@ dbOStream& operator<<(dbOStream& stream, const _dbInst& inst)
   stream << inst._x;
   stream << inst._y;
   stream << inst._weight;
-  stream << inst._next_entry;
   stream << inst._inst_hdr;
   stream << inst._bbox;
   stream << inst._region;
@@ -198,7 +195,11 @@ dbIStream& operator>>(dbIStream& stream, _dbInst& inst)
   stream >> inst._x;
   stream >> inst._y;
   stream >> inst._weight;
-  stream >> inst._next_entry;
+  _dbDatabase* db = inst.getImpl()->getDatabase();
+  if (!db->isSchema(db_schema_block_name_index)) {
+    dbId<_dbInst> next_entry;  // link of the removed name hash table
+    stream >> next_entry;
+  }
   stream >> inst._inst_hdr;
   stream >> inst._bbox;
   stream >> inst._region;
@@ -276,10 +277,6 @@ bool _dbInst::operator==(const _dbInst& rhs) const
     return false;
   }
 
-  if (_next_entry != rhs._next_entry) {
-    return false;
-  }
-
   if (_inst_hdr != rhs._inst_hdr) {
     return false;
   }
@@ -359,7 +356,6 @@ void _dbInst::differences(dbDiff& diff,
   DIFF_FIELD(_x);
   DIFF_FIELD(_y);
   DIFF_FIELD(_weight);
-  DIFF_FIELD_NO_DEEP(_next_entry);
   DIFF_FIELD_NO_DEEP(_inst_hdr);
   DIFF_OBJECT(_bbox, lhs_blk->_box_tbl, rhs_blk->_box_tbl);
   DIFF_FIELD(_region);
@@ -415,7 +411,6 @@ void _dbInst::out(dbDiff& diff, char side, const char* field) const
   DIFF_OUT_FIELD(_x);
   DIFF_OUT_FIELD(_y);
   DIFF_OUT_FIELD(_weight);
-  DIFF_OUT_FIELD_NO_DEEP(_next_entry);
   DIFF_OUT_FIELD_NO_DEEP(_inst_hdr);
   DIFF_OUT_OBJECT(_bbox, blk->_box_tbl);
   DIFF_OUT_FIELD(_region);
@@ -479,16 +474,20 @@ bool dbInst::rename(const char* name)
 {
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("rename an instance");
 
-  if (block->_inst_hash.hasMember(name)) {
+  if (block->_inst_index.find(name)) {
     return false;
   }
 
-  block->_inst_hash.remove(inst);
-  free((void*) inst->_name);
-  inst->_name = strdup(name);
-  ZALLOCATED(inst->_name);
-  block->_inst_hash.insert(inst);
+  block->_inst_index.remove(inst);
+  block->_name_arena.remove(inst->_name);
+  inst->_name = block->_name_arena.add(name);
+  block->_inst_index.insert(inst);
+
+  for (auto callback : block->_callbacks) {
+    callback->inDbInstPostRename(this);
+  }
 
   return true;
 }
@@ -503,6 +502,7 @@ void dbInst::setOrigin(int x, int y)
 {
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("move an instance");
   int prev_x = inst->_x;
   int prev_y = inst->_y;
   const auto placement_status = getPlacementStatus();
@@ -605,6 +605,7 @@ void dbInst::setOrient(dbOrientType orient)
   }
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("orient an instance");
 
   if (getPlacementStatus().isFixed()) {
     inst->getLogger()->error(
@@ -648,6 +649,7 @@ void dbInst::setPlacementStatus(dbPlacementStatus status)
 {
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("change a placement status");
 
   if (inst->_flags._status == status) {
     return;
@@ -1212,6 +1214,7 @@ bool dbInst::swapMaster(dbMaster* new_master_)
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
   dbMaster* old_master_ = getMaster();
+  block->checkNotFrozen("swap an instance master");
 
   if (inst->_flags._dont_touch) {
     inst->getLogger()->error(
@@ -1391,6 +1394,7 @@ dbInst* dbInst::create(dbBlock* block_,
                        dbModule* parent_module)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create an instance");
   _dbMaster* master = (_dbMaster*) master_;
   _dbInstHdr* inst_hdr = block->_inst_hdr_hash.find(master->_id);
   if (inst_hdr == nullptr) {
@@ -1399,7 +1403,7 @@ dbInst* dbInst::create(dbBlock* block_,
     ZASSERT(inst_hdr);
   }
 
-  if (block->_inst_hash.hasMember(name_)) {
+  if (block->_inst_index.find(name_)) {
     block->getImpl()->getLogger()->error(
         utl::ODB,
         385,
@@ -1425,10 +1429,9 @@ dbInst* dbInst::create(dbBlock* block_,
     block->_journal->endAction();
   }
 
-  inst->_name = strdup(name_);
-  ZALLOCATED(inst->_name);
+  inst->_name = block->_name_arena.add(name_);
   inst->_inst_hdr = inst_hdr->getOID();
-  block->_inst_hash.insert(inst);
+  block->_inst_index.insert(inst);
   inst_hdr->_inst_cnt++;
 
   // create the iterms
@@ -1539,6 +1542,7 @@ void dbInst::destroy(dbInst* inst_)
 {
   _dbInst* inst = (_dbInst*) inst_;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("destroy an instance");
 
   if (inst->_flags._dont_touch) {
     inst->getLogger()->error(utl::ODB,
@@ -1638,7 +1642,9 @@ void dbInst::destroy(dbInst* inst_)
 
   _dbBox* box = block->_box_tbl->getPtr(inst->_bbox);
   block->remove_rect(box->_shape._rect);
-  block->_inst_hash.remove(inst);
+  block->_inst_index.remove(inst);
+  block->_name_arena.remove(inst->_name);
+  inst->_name = nullptr;
   dbProperty::destroyProperties(inst);
   block->_inst_tbl->destroy(inst);
   dbProperty::destroyProperties(box);
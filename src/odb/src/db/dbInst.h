@@ -86,7 +86,6 @@ class _dbInst : public _dbObject
   int _x;
   int _y;
   int _weight;
-  dbId<_dbInst> _next_entry;
   dbId<_dbInstHdr> _inst_hdr;
   dbId<_dbBox> _bbox;
   dbId<_dbRegion> _region;
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbNameArena.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "dbHashTable.hpp"
+#include "odb/ZException.h"
+
+namespace odb {
+
+dbNameArena::~dbNameArena()
+{
+  for (char* chunk : _chunks) {
+    free(chunk);
+  }
+}
+
+char* dbNameArena::add(const char* name)
+{
+  const size_t length = strlen(name) + 1;
+  // Round up so the hash of the next name is aligned.
+  const size_t num_words = words(length);
+  const size_t size = num_words * sizeof(uint);
+
+  char* slot;
+  if (num_words < _free.size() && !_free[num_words].empty()) {
+    slot = _free[num_words].back();
+    _free[num_words].pop_back();
+  } else {
+    if (_next == nullptr || size > size_t(_end - _next)) {
+      const size_t alloc_size = std::max(size, chunk_size);
+      char* chunk = (char*) malloc(alloc_size);
+      ZALLOCATED(chunk);
+      _chunks.push_back(chunk);
+      _next = chunk;
+      _end = chunk + alloc_size;
+    }
+    slot = _next;
+    _next += size;
+  }
+
+  uint* hash = reinterpret_cast<uint*>(slot);
+  *hash = hash_string(name);
+  char* str = slot + sizeof(uint);
+  memcpy(str, name, length);
+  return str;
+}
+
+void dbNameArena::remove(const char* name)
+{
+  if (name == nullptr) {
+    return;
+  }
+
+  const size_t num_words = words(strlen(name) + 1);
+  if (num_words >= _free.size()) {
+    _free.resize(num_words + 1);
+  }
+  _free[num_words].push_back(const_cast<char*>(name) - sizeof(uint));
+}
+
+}  // namespace odb
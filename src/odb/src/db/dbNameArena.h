@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "odb/odb.h"
+
+namespace odb {
+
+//////////////////////////////////////////////////////////
+///
+/// dbNameArena - block level storage for instance and net names.
+///
+/// Names are packed into large chunks instead of being allocated one at
+/// a time, and each is preceded by its hash_string() value so hash
+/// tables can rehash without reading the names. The space of the names
+/// of renamed and destroyed objects is kept on free lists by size and
+/// reused by later names of the same size.  The chunks are freed when
+/// the arena is destroyed with its block.
+///
+//////////////////////////////////////////////////////////
+class dbNameArena
+{
+ public:
+  dbNameArena() = default;
+  ~dbNameArena();
+  dbNameArena(const dbNameArena&) = delete;
+  dbNameArena& operator=(const dbNameArena&) = delete;
+
+  // Copy name into the arena.
+  char* add(const char* name);
+  // Release a name returned by add so its space can be reused.
+  void remove(const char* name);
+  // The hash of a name returned by add.
+  static uint hash(const char* name)
+  {
+    return reinterpret_cast<const uint*>(name)[-1];
+  }
+
+ private:
+  static constexpr size_t chunk_size = 1 << 20;
+
+  // The number of words used by the hash and a name of length bytes,
+  // including the terminator.
+  static size_t words(size_t length)
+  {
+    return (length + sizeof(uint) - 1) / sizeof(uint) + 1;
+  }
+
+  std::vector<char*> _chunks;
+  // Released space indexed by its size in words
+  std::vector<std::vector<char*>> _free;
+  char* _next = nullptr;
+  char* _end = nullptr;
+};
+
+}  // namespace odb
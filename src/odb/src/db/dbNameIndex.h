@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <vector>
+
+#include "odb/odb.h"
+
+namespace odb {
+
+template <class T>
+class dbTable;
+
+//////////////////////////////////////////////////////////
+///
+/// dbNameIndex - open addressing index of named-objects.
+///
+/// Each slot holds the hash of the name with the object id so
+/// probing compares names only when the hashes match. The index is
+/// not persistent; it is built when the block is read.
+///
+/// Each object must have the following "named" field, holding a
+/// name allocated from a dbNameArena:
+///
+///     char *        _name
+///
+//////////////////////////////////////////////////////////
+template <class T>
+class dbNameIndex
+{
+ public:
+  void setTable(dbTable<T>* table) { _obj_tbl = table; }
+  T* find(const char* name) const;
+  // Find the object named by the concatenation of parts.
+  T* find(const std::vector<const char*>& parts) const;
+  void insert(T* object);
+  void remove(T* object);
+  void clear();
+
+ private:
+  struct Slot
+  {
+    uint hash = 0;
+    uint id = 0;  // 0 for an empty slot
+  };
+
+  template <class Match>
+  T* find(uint hash, Match match) const;
+  void grow();
+
+  std::vector<Slot> _slots;
+  uint _num_entries = 0;
+  dbTable<T>* _obj_tbl = nullptr;
+};
+
+}  // namespace odb
@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include "dbCore.h"
+#include "dbHashTable.hpp"
+#include "dbNameArena.h"
+#include "dbNameIndex.h"
+
+namespace odb {
+
+template <class T>
+template <class Match>
+T* dbNameIndex<T>::find(uint hash, Match match) const
+{
+  if (_slots.empty()) {
+    return nullptr;
+  }
+
+  const uint mask = _slots.size() - 1;
+  for (uint i = hash & mask; _slots[i].id != 0; i = (i + 1) & mask) {
+    if (_slots[i].hash == hash) {
+      T* entry = _obj_tbl->getPtr(_slots[i].id);
+      if (match(entry->_name)) {
+        return entry;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+template <class T>
+T* dbNameIndex<T>::find(const char* name) const
+{
+  return find(hash_string(name), [name](const char* entry_name) {
+    return strcmp(entry_name, name) == 0;
+  });
+}
+
+template <class T>
+T* dbNameIndex<T>::find(const std::vector<const char*>& parts) const
+{
+  uint hash = 0;
+  for (const char* part : parts) {
+    hash = hash_string(hash, part);
+  }
+
+  return find(hash, [&parts](const char* entry_name) {
+    for (const char* part : parts) {
+      while (*part != '\0') {
+        if (*entry_name++ != *part++) {
+          return false;
+        }
+      }
+    }
+    return *entry_name == '\0';
+  });
+}
+
+template <class T>
+void dbNameIndex<T>::insert(T* object)
+{
+  // Keep the load factor at or below 1/2 for short probe sequences.
+  if ((_num_entries + 1) * 2 > _slots.size()) {
+    grow();
+  }
+
+  const uint mask = _slots.size() - 1;
+  const uint hash = dbNameArena::hash(object->_name);
+  uint i = hash & mask;
+  while (_slots[i].id != 0) {
+    i = (i + 1) & mask;
+  }
+
+  _slots[i].hash = hash;
+  _slots[i].id = object->getOID();
+  ++_num_entries;
+}
+
+template <class T>
+void dbNameIndex<T>::remove(T* object)
+{
+  if (_slots.empty()) {
+    return;
+  }
+
+  const uint mask = _slots.size() - 1;
+  const uint id = object->getOID();
+  uint i = dbNameArena::hash(object->_name) & mask;
+  while (_slots[i].id != id) {
+    if (_slots[i].id == 0) {
+      return;
+    }
+    i = (i + 1) & mask;
+  }
+
+  // Shift later entries of the probe sequence back into the hole so
+  // no tombstones are needed.
+  for (uint j = (i + 1) & mask; _slots[j].id != 0; j = (j + 1) & mask) {
+    const uint home = _slots[j].hash & mask;
+    if (((j - home) & mask) >= ((j - i) & mask)) {
+      _slots[i] = _slots[j];
+      i = j;
+    }
+  }
+
+  _slots[i] = Slot();
+  --_num_entries;
+}
+
+template <class T>
+void dbNameIndex<T>::clear()
+{
+  _slots.clear();
+  _num_entries = 0;
+}
+
+template <class T>
+void dbNameIndex<T>::grow()
+{
+  std::vector<Slot> slots(std::max(_slots.size() * 2, size_t(16)));
+  const uint mask = slots.size() - 1;
+
+  for (const Slot& slot : _slots) {
+    if (slot.id != 0) {
+      uint i = slot.hash & mask;
+      while (slots[i].id != 0) {
+        i = (i + 1) & mask;
+      }
+      slots[i] = slot;
+    }
+  }
+
+  _slots.swap(slots);
+}
+
+}  // namespace odb
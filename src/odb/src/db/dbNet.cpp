@@ -52,6 +52,7 @@
 #include "dbInst.h"
 #include "dbJournal.h"
 #include "dbMTerm.h"
+#include "dbNameIndex.hpp"
 #include "dbNetTrack.h"
 #include "dbNetTrackItr.h"
 #include "dbRSeg.h"
@@ -83,7 +84,6 @@ static void set_symmetric_diff(dbDiff& diff,
 _dbNet::_dbNet(_dbDatabase* db, const _dbNet& n)
     : _flags(n._flags),
       _name(nullptr),
-      _next_entry(n._next_entry),
       _iterms(n._iterms),
       _bterms(n._bterms),
       _wire(n._wire),
@@ -144,9 +144,7 @@ _dbNet::_dbNet(_dbDatabase* db)
 
 _dbNet::~_dbNet()
 {
-  if (_name) {
-    free((void*) _name);
-  }
+  // _name is owned by the block name arena.
 }
 
 dbOStream& operator<<(dbOStream& stream, const _dbNet& net)
@@ -156,7 +154,6 @@ dbOStream& operator<<(dbOStream& stream, const _dbNet& net)
   stream << net._name;
   stream << net._gndc_calibration_factor;
   stream << net._cc_calibration_factor;
-  stream << net._next_entry;
   stream << net._iterms;
   stream << net._bterms;
   stream << net._wire;
@@ -182,7 +179,11 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
   stream >> net._name;
   stream >> net._gndc_calibration_factor;
   stream >> net._cc_calibration_factor;
-  stream >> net._next_entry;
+  _dbDatabase* db = net.getImpl()->getDatabase();
+  if (!db->isSchema(db_schema_block_name_index)) {
+    dbId<_dbNet> next_entry;  // link of the removed name hash table
+    stream >> next_entry;
+  }
   stream >> net._iterms;
   stream >> net._bterms;
   stream >> net._wire;
@@ -197,7 +198,6 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
   stream >> net._ccAdjustOrder;
   stream >> net._groups;
   stream >> net.guides_;
-  _dbDatabase* db = net.getImpl()->getDatabase();
   if (db->isSchema(db_schema_net_tracks)) {
     stream >> net.tracks_;
   }
@@ -315,10 +315,6 @@ bool _dbNet::operator==(const _dbNet& rhs) const
     return false;
   }
 
-  if (_next_entry != rhs._next_entry) {
-    return false;
-  }
-
   if (_iterms != rhs._iterms) {
     return false;
   }
@@ -415,7 +411,6 @@ void _dbNet::differences(dbDiff& diff,
   DIFF_FIELD(_flags._block_rule);
   DIFF_FIELD_NO_DEEP(_gndc_calibration_factor);
   DIFF_FIELD_NO_DEEP(_cc_calibration_factor);
-  DIFF_FIELD_NO_DEEP(_next_entry);
 
   if (!diff.deepDiff()) {
     DIFF_FIELD(_bterms);
@@ -507,7 +502,6 @@ void _dbNet::out(dbDiff& diff, char side, const char* field) const
   DIFF_OUT_FIELD(_flags._block_rule);
   DIFF_OUT_FIELD_NO_DEEP(_gndc_calibration_factor);
   DIFF_OUT_FIELD_NO_DEEP(_cc_calibration_factor);
-  DIFF_OUT_FIELD_NO_DEEP(_next_entry);
 
   if (!diff.deepDiff()) {
     DIFF_OUT_FIELD(_bterms);
@@ -712,16 +706,20 @@ bool dbNet::rename(const char* name)
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("rename a net");
 
-  if (block->_net_hash.hasMember(name)) {
+  if (block->_net_index.find(name)) {
     return false;
   }
 
-  block->_net_hash.remove(net);
-  free((void*) net->_name);
-  net->_name = strdup(name);
-  ZALLOCATED(net->_name);
-  block->_net_hash.insert(net);
+  block->_net_index.remove(net);
+  block->_name_arena.remove(net->_name);
+  net->_name = block->_name_arena.add(name);
+  block->_net_index.insert(net);
+
+  for (auto callback : block->_callbacks) {
+    callback->inDbNetPostRename(this);
+  }
 
   return true;
 }
@@ -3070,8 +3068,9 @@ void dbNet::destroySWires()
 dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create a net");
 
-  if (!skipExistingCheck && block->_net_hash.hasMember(name_)) {
+  if (!skipExistingCheck && block->_net_index.find(name_)) {
     return nullptr;
   }
 
@@ -3090,9 +3089,8 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
     block->_journal->endAction();
   }
 
-  net->_name = strdup(name_);
-  ZALLOCATED(net->_name);
-  block->_net_hash.insert(net);
+  net->_name = block->_name_arena.add(name_);
+  block->_net_index.insert(net);
 
   std::list<dbBlockCallBackObj*>::iterator cbitr;
   for (cbitr = block->_callbacks.begin(); cbitr != block->_callbacks.end();
@@ -3107,6 +3105,7 @@ void dbNet::destroy(dbNet* net_)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("destroy a net");
 
   if (net->_flags._dont_touch) {
     net->getLogger()->error(
@@ -3174,7 +3173,9 @@ void dbNet::destroy(dbNet* net_)
   }
 
   dbProperty::destroyProperties(net);
-  block->_net_hash.remove(net);
+  block->_net_index.remove(net);
+  block->_name_arena.remove(net->_name);
+  net->_name = nullptr;
   block->_net_tbl->destroy(net);
 }
 
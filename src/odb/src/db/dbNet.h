@@ -111,7 +111,6 @@ class _dbNet : public _dbObject
     float _dbCC;
     float _CcMatchRatio;
   };
-  dbId<_dbNet> _next_entry;
   dbId<_dbITerm> _iterms;
   dbId<_dbBTerm> _bterms;
   dbId<_dbWire> _wire;
@@ -288,6 +288,7 @@ bool dbSBox::hasViaLayerMasks()
 void dbSBox::setViaLayerMask(uint bottom, uint cut, uint top)
 {
   _dbSBox* box = (_dbSBox*) this;
+  ((_dbBlock*) box->getOwner())->checkNotFrozen("change a via mask");
   box->checkMask(bottom);
   box->checkMask(cut);
   box->checkMask(top);
@@ -309,6 +310,7 @@ dbSBox* dbSBox::create(dbSWire* wire_,
 {
   _dbSWire* wire = (_dbSWire*) wire_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("create a special box");
   _dbSBox* box = block->_sbox_tbl->create();
 
   uint dx;
@@ -383,6 +385,7 @@ dbSBox* dbSBox::create(dbSWire* wire_,
   _dbSWire* wire = (_dbSWire*) wire_;
   _dbVia* via = (_dbVia*) via_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("create a special box");
 
   if (via->_bbox == 0) {
     return nullptr;
@@ -416,6 +419,7 @@ dbSBox* dbSBox::create(dbSWire* wire_,
   _dbSWire* wire = (_dbSWire*) wire_;
   _dbTechVia* via = (_dbTechVia*) via_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("create a special box");
 
   if (via->_bbox == 0) {
     return nullptr;
@@ -451,6 +455,7 @@ void dbSBox::destroy(dbSBox* box_)
 {
   _dbSWire* wire = (_dbSWire*) box_->getSWire();
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("destroy a special box");
   _dbSBox* box = (_dbSBox*) box_;
 
   wire->removeSBox(box);
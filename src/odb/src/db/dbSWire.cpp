@@ -247,6 +247,7 @@ dbSWire* dbSWire::create(dbNet* net_, dbWireType type, dbNet* shield_)
   _dbNet* net = (_dbNet*) net_;
   _dbNet* shield = (_dbNet*) shield_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("create a special wire");
 
   _dbSWire* wire = block->_swire_tbl->create();
   wire->_flags._wire_type = type.getValue();
@@ -289,6 +290,7 @@ void dbSWire::destroy(dbSWire* wire_)
 {
   _dbSWire* wire = (_dbSWire*) wire_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("destroy a special wire");
   _dbNet* net = block->_net_tbl->getPtr(wire->_net);
   _dbSWire* prev = nullptr;
   dbId<_dbSWire> id;
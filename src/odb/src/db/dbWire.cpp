@@ -33,6 +33,9 @@
 #include "dbWire.h"
 
 #include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "dbBlock.h"
 #include "dbNet.h"
@@ -44,6 +47,7 @@
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
 #include "odb/dbShape.h"
+#include "odb/dbWireCompact.h"
 #include "utl/Logger.h"
 namespace odb {
 
@@ -140,8 +144,10 @@ dbOStream& operator<<(dbOStream& stream, const _dbWire& wire)
 {
   uint* bit_field = (uint*) &wire._flags;
   stream << *bit_field;
-  stream << wire._data;
-  stream << wire._opcodes;
+  dbWireCompact compact;
+  compact.encode(wire._opcodes, wire._data);
+  stream << compact.size();
+  stream << compact.getBytes();
   stream << wire._net;
   return stream;
 }
@@ -150,8 +156,21 @@ dbIStream& operator>>(dbIStream& stream, _dbWire& wire)
 {
   uint* bit_field = (uint*) &wire._flags;
   stream >> *bit_field;
-  stream >> wire._data;
-  stream >> wire._opcodes;
+  if (wire.getDatabase()->isSchema(db_schema_compact_wire)) {
+    int count;
+    std::vector<unsigned char> bytes;
+    stream >> count;
+    stream >> bytes;
+    dbWireCompact compact;
+    compact.setBytes(std::move(bytes), count);
+    if (!compact.decode(wire._opcodes, wire._data)) {
+      wire.getImpl()->getLogger()->error(
+          utl::ODB, 448, "Corrupt wire data in the database file.");
+    }
+  } else {
+    stream >> wire._data;
+    stream >> wire._opcodes;
+  }
   stream >> wire._net;
   return stream;
 }
@@ -1654,6 +1673,263 @@ bool dbWire::getViaBoxes(int via_shape_id, std::vector<dbShape>& shapes)
   return true;
 }
 
+void dbWire::getShapes(std::vector<dbShape>& shapes)
+{
+  _dbWire* wire = (_dbWire*) this;
+  dbBlock* block = getBlock();
+  dbTech* tech = block->getTech();
+  const int length = wire->length();
+  shapes.clear();
+  // rough estimate of the shape count
+  shapes.reserve(length / 2);
+
+  // Junctions refer back to earlier entries.  The point and layer
+  // getPrevPoint would find at those entries are saved as the wire is
+  // decoded, so a junction is resolved with a lookup instead of a backward
+  // walk.  Only the junction targets are saved, sorted by entry.
+  using Target = std::pair<int, WirePoint>;
+  std::vector<Target> targets;
+  for (int i = 0; i < length; ++i) {
+    if ((wire->_opcodes[i] & WOP_OPCODE_MASK) == WOP_JUNCTION) {
+      targets.emplace_back(wire->_data[i], WirePoint());
+    }
+  }
+  auto entry_less = [](const Target& lhs, const Target& rhs) {
+    return lhs.first < rhs.first;
+  };
+  auto same_entry = [](const Target& lhs, const Target& rhs) {
+    return lhs.first == rhs.first;
+  };
+  std::sort(targets.begin(), targets.end(), entry_less);
+  targets.erase(std::unique(targets.begin(), targets.end(), same_entry),
+                targets.end());
+  constexpr int no_target = std::numeric_limits<int>::max();
+  size_t next_target = 0;
+  int target_entry = targets.empty() ? no_target : targets[0].first;
+  // The point and layer as of the last decoded entry.
+  WirePoint point;
+
+  int idx = 0;
+  auto nextOp = [&](int& value) {
+    // The point of the previous entry is complete once the next is read.
+    if (idx - 1 == target_entry) {
+      targets[next_target++].second = point;
+      target_entry = next_target < targets.size() ? targets[next_target].first
+                                                  : no_target;
+    }
+    value = wire->_data[idx];
+    return wire->_opcodes[idx++];
+  };
+
+  // The same decoding state as dbWireShapeItr
+  int prev_x = 0;
+  int prev_y = 0;
+  int prev_ext = 0;
+  bool has_prev_ext = false;
+  dbTechLayer* layer = nullptr;
+  int dw = 0;
+  int point_cnt = 0;
+  bool has_width = false;
+  dbShape shape;
+
+  while (idx < length) {
+    int operand;
+    unsigned char opcode = nextOp(operand);
+
+    switch (opcode & WOP_OPCODE_MASK) {
+      case WOP_PATH:
+      case WOP_SHORT:
+      case WOP_VWIRE: {
+        layer = dbTechLayer::getTechLayer(tech, operand);
+        if ((opcode & WOP_OPCODE_MASK) != WOP_VWIRE) {
+          point._layer = layer;
+        }
+        point_cnt = 0;
+        dw = layer->getWidth() >> 1;
+        break;
+      }
+
+      case WOP_JUNCTION: {
+        point = std::lower_bound(targets.begin(),
+                                 targets.begin() + next_target,
+                                 Target(operand, WirePoint()),
+                                 entry_less)
+                    ->second;
+        layer = point._layer;
+        prev_x = point._x;
+        prev_y = point._y;
+        prev_ext = 0;
+        has_prev_ext = false;
+        point_cnt = 0;
+        dw = layer->getWidth() >> 1;
+        break;
+      }
+
+      case WOP_RULE: {
+        dbTechLayerRule* rule
+            = (opcode & WOP_BLOCK_RULE)
+                  ? dbTechLayerRule::getTechLayerRule(block, operand)
+                  : dbTechLayerRule::getTechLayerRule(tech, operand);
+        dw = rule->getWidth() >> 1;
+        has_width = true;
+        break;
+      }
+
+      case WOP_X:
+      case WOP_Y: {
+        const bool is_x = (opcode & WOP_OPCODE_MASK) == WOP_X;
+        int cur_x;
+        int cur_y;
+        if (is_x) {
+          cur_x = operand;
+          point._x = cur_x;
+          if (point_cnt == 0) {
+            opcode = nextOp(cur_y);
+            point._y = cur_y;
+          } else {
+            cur_y = prev_y;
+          }
+        } else {
+          ZASSERT(point_cnt != 0);
+          cur_x = prev_x;
+          cur_y = operand;
+          point._y = cur_y;
+        }
+
+        int cur_ext = 0;
+        bool has_cur_ext = false;
+        if (opcode & WOP_EXTENSION) {
+          nextOp(cur_ext);
+          has_cur_ext = true;
+        }
+
+        // The first point of a path only starts it.
+        if (point_cnt++ > 0 || !is_x) {
+          int seg_dw = dw;
+          if (layer->getDirection()
+              == (is_x ? dbTechLayerDir::VERTICAL
+                       : dbTechLayerDir::HORIZONTAL)) {
+            seg_dw = layer->getWrongWayWidth() / 2;
+          }
+          shape.setSegment(prev_x,
+                           prev_y,
+                           prev_ext,
+                           has_prev_ext,
+                           cur_x,
+                           cur_y,
+                           cur_ext,
+                           has_cur_ext,
+                           seg_dw,
+                           dw,
+                           layer);
+          shapes.push_back(shape);
+        }
+        prev_x = cur_x;
+        prev_y = cur_y;
+        prev_ext = cur_ext;
+        has_prev_ext = has_cur_ext;
+        break;
+      }
+
+      case WOP_COLINEAR: {
+        point_cnt++;
+
+        // A colinear-point with an extension begins a new path-segment
+        if (opcode & WOP_EXTENSION) {
+          prev_ext = operand;
+          has_prev_ext = true;
+          break;
+        }
+
+        // A colinear-point following an extension cancels the ext
+        if (has_prev_ext) {
+          prev_ext = 0;
+          has_prev_ext = false;
+          break;
+        }
+
+        if (point_cnt > 1) {
+          shape.setSegment(prev_x,
+                           prev_y,
+                           prev_ext,
+                           has_prev_ext,
+                           prev_x,
+                           prev_y,
+                           0,
+                           false,
+                           dw,
+                           dw,
+                           layer);
+          shapes.push_back(shape);
+        }
+        break;
+      }
+
+      case WOP_VIA:
+      case WOP_TECH_VIA: {
+        const bool exit_top = opcode & WOP_VIA_EXIT_TOP;
+        dbBox* box;
+        if ((opcode & WOP_OPCODE_MASK) == WOP_VIA) {
+          dbVia* via = dbVia::getVia(block, operand);
+          layer = exit_top ? via->getTopLayer() : via->getBottomLayer();
+          box = via->getBBox();
+          if (box != nullptr) {
+            Rect r = box->getBox();
+            r.moveDelta(prev_x, prev_y);
+            shapes.emplace_back(via, r);
+          }
+        } else {
+          dbTechVia* via = dbTechVia::getTechVia(tech, operand);
+          layer = exit_top ? via->getTopLayer() : via->getBottomLayer();
+          box = via->getBBox();
+          if (box != nullptr) {
+            Rect r = box->getBox();
+            r.moveDelta(prev_x, prev_y);
+            shapes.emplace_back(via, r);
+          }
+        }
+        point._layer = layer;
+        if (!has_width) {
+          dw = layer->getWidth() >> 1;
+        }
+        prev_ext = 0;
+        has_prev_ext = false;
+        break;
+      }
+
+      case WOP_RECT: {
+        int deltaX1 = operand;
+        int deltaY1;
+        int deltaX2;
+        int deltaY2;
+        nextOp(deltaY1);
+        nextOp(deltaX2);
+        nextOp(deltaY2);
+        shape.setSegmentFromRect(prev_x + deltaX1,
+                                 prev_y + deltaY1,
+                                 prev_x + deltaX2,
+                                 prev_y + deltaY2,
+                                 layer);
+        shapes.push_back(shape);
+        break;
+      }
+
+      case WOP_ITERM:
+      case WOP_BTERM:
+      case WOP_OPERAND:
+      case WOP_PROPERTY:
+      case WOP_COLOR:
+      case WOP_VIACOLOR:
+      case WOP_NOP:
+        break;
+
+      default:
+        ZASSERT(0);
+        break;
+    }
+  }
+}
+
 void dbWire::append(dbWire* src_, bool singleSegmentWire)
 {
   _dbWire* dst = (_dbWire*) this;
@@ -1788,6 +2064,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
   }
 
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("create a wire");
   _dbWire* wire = block->_wire_tbl->create();
   wire->_net = net->getOID();
 
@@ -1809,6 +2086,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
 dbWire* dbWire::create(dbBlock* block_, bool /* unused: global_wire */)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create a wire");
   _dbWire* wire = block->_wire_tbl->create();
   for (auto callback : block->_callbacks) {
     callback->inDbWireCreate((dbWire*) wire);
@@ -1826,6 +2104,7 @@ void dbWire::destroy(dbWire* wire_)
 {
   _dbWire* wire = (_dbWire*) wire_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("destroy a wire");
   _dbNet* net = (_dbNet*) wire_->getNet();
   for (auto callback : block->_callbacks) {
     callback->inDbWireDestroy(wire_);
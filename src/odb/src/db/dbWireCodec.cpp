@@ -177,6 +177,7 @@ void dbWireEncoder::begin(dbWire* wire)
   _wire = (_dbWire*) wire;
   _block = wire->getBlock();
   _tech = _block->getTech();
+  ((_dbBlock*) _block)->checkNotFrozen("encode a wire");
 }
 
 void dbWireEncoder::clear()
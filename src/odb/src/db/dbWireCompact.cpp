@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "odb/dbWireCompact.h"
+
+#include <cstdint>
+#include <utility>
+
+#include "dbWireOpcode.h"
+
+namespace odb {
+
+namespace {
+
+struct DeltaState
+{
+  int x = 0;
+  int y = 0;
+};
+
+// Map an operand to the value that is stored.  Unsigned arithmetic keeps
+// the transform reversible for any operand.
+inline uint32_t toDelta(const unsigned char opcode,
+                        const int operand,
+                        const int idx,
+                        DeltaState& state)
+{
+  switch (opcode & WOP_OPCODE_MASK) {
+    case WOP_X: {
+      const uint32_t delta = uint32_t(operand) - uint32_t(state.x);
+      state.x = operand;
+      return delta;
+    }
+    case WOP_Y: {
+      const uint32_t delta = uint32_t(operand) - uint32_t(state.y);
+      state.y = operand;
+      return delta;
+    }
+    case WOP_SHORT:
+    case WOP_JUNCTION:
+      return uint32_t(idx) - uint32_t(operand);
+    default:
+      return operand;
+  }
+}
+
+inline int fromDelta(const unsigned char opcode,
+                     const uint32_t delta,
+                     const int idx,
+                     DeltaState& state)
+{
+  switch (opcode & WOP_OPCODE_MASK) {
+    case WOP_X:
+      state.x = int(uint32_t(state.x) + delta);
+      return state.x;
+    case WOP_Y:
+      state.y = int(uint32_t(state.y) + delta);
+      return state.y;
+    case WOP_SHORT:
+    case WOP_JUNCTION:
+      return int(uint32_t(idx) - delta);
+    default:
+      return int(delta);
+  }
+}
+
+inline void putVarint(std::vector<unsigned char>& bytes, const uint32_t delta)
+{
+  // zigzag so small negative deltas stay short
+  uint32_t value = (delta << 1) ^ uint32_t(int32_t(delta) >> 31);
+  while (value >= 0x80) {
+    bytes.push_back((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  bytes.push_back(value);
+}
+
+// Reads a varint from [ptr, end).  Returns false if it runs past end or
+// is longer than a 32 bit value can be.
+inline bool getVarint(const unsigned char*& ptr,
+                      const unsigned char* end,
+                      uint32_t& delta)
+{
+  uint32_t value = 0;
+  int shift = 0;
+  unsigned char byte;
+  do {
+    if (ptr == end || shift > 28) {
+      return false;
+    }
+    byte = *ptr++;
+    value |= uint32_t(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  delta = (value >> 1) ^ (0 - (value & 1));
+  return true;
+}
+
+}  // namespace
+
+void dbWireCompact::encode(const std::vector<unsigned char>& opcodes,
+                           const std::vector<int>& data)
+{
+  count_ = opcodes.size();
+  bytes_.clear();
+  bytes_.reserve(3 * count_);
+
+  DeltaState state;
+  for (int idx = 0; idx < count_; ++idx) {
+    const unsigned char opcode = opcodes[idx];
+    bytes_.push_back(opcode);
+    putVarint(bytes_, toDelta(opcode, data[idx], idx, state));
+  }
+  bytes_.shrink_to_fit();
+}
+
+bool dbWireCompact::decode(std::vector<unsigned char>& opcodes,
+                           std::vector<int>& data) const
+{
+  // Every entry needs at least an opcode and a one byte operand.
+  if (count_ < 0 || size_t(count_) > bytes_.size() / 2) {
+    return false;
+  }
+  opcodes.resize(count_);
+  data.resize(count_);
+
+  const unsigned char* ptr = bytes_.data();
+  const unsigned char* end = ptr + bytes_.size();
+  DeltaState state;
+  for (int idx = 0; idx < count_; ++idx) {
+    if (ptr == end) {
+      return false;
+    }
+    const unsigned char opcode = *ptr++;
+    uint32_t delta;
+    if (!getVarint(ptr, end, delta)) {
+      return false;
+    }
+    opcodes[idx] = opcode;
+    data[idx] = fromDelta(opcode, delta, idx, state);
+  }
+  return ptr == end;
+}
+
+void dbWireCompact::setBytes(std::vector<unsigned char> bytes, const int count)
+{
+  bytes_ = std::move(bytes);
+  count_ = count;
+}
+
+}  // namespace odb
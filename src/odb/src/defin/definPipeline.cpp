@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "definPipeline.h"
+
+#include <utility>
+
+namespace odb {
+
+definPipeline::definPipeline() : _worker([this] { run(); })
+{
+}
+
+definPipeline::~definPipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.clear();
+    _stop = true;
+  }
+  _work_ready.notify_one();
+  _worker.join();
+}
+
+void definPipeline::add(std::function<void()> task)
+{
+  _chunk.push_back(std::move(task));
+  if (_chunk.size() >= chunk_size) {
+    submit();
+  }
+}
+
+void definPipeline::submit()
+{
+  if (_chunk.empty()) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _work_done.wait(lock,
+                    [this] { return _pending.size() < max_pending_chunks; });
+    _pending.push_back(std::move(_chunk));
+  }
+  _chunk.clear();
+  _work_ready.notify_one();
+}
+
+void definPipeline::drain()
+{
+  submit();
+  std::unique_lock<std::mutex> lock(_mutex);
+  _work_done.wait(lock, [this] { return _pending.empty() && !_busy; });
+  if (_error) {
+    std::exception_ptr error = _error;
+    _error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void definPipeline::run()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _work_ready.wait(lock, [this] { return _stop || !_pending.empty(); });
+    if (_pending.empty()) {
+      return;
+    }
+    Chunk chunk = std::move(_pending.front());
+    _pending.pop_front();
+    _busy = true;
+    const bool skip = _error != nullptr;
+    lock.unlock();
+    // Notify here too so a parser waiting on a full queue can go on.
+    _work_done.notify_all();
+
+    std::exception_ptr error;
+    if (!skip) {
+      try {
+        for (auto& task : chunk) {
+          task();
+        }
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+    chunk.clear();
+
+    lock.lock();
+    if (error) {
+      _error = error;
+    }
+    _busy = false;
+    _work_done.notify_all();
+  }
+}
+
+}  // namespace odb
@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace odb {
+
+// The parts of a DEF object that are needed to build it in odb. The DEF
+// parser reuses its objects between callbacks, so a statement is copied
+// into a record before it is handed to another thread.
+
+struct definPropRecord
+{
+  std::string name;
+  char type;  // 'R', 'I' or string
+  double number;
+  std::string value;
+};
+
+struct definComponentRecord
+{
+  std::string id;
+  std::string name;
+  std::optional<std::string> source;
+  std::optional<int> weight;
+  std::optional<std::string> region;
+  std::optional<std::array<int, 4>> halo;
+  int status;
+  int x;
+  int y;
+  int orient;
+  std::vector<definPropRecord> props;
+};
+
+// One step of a routing path, replayed as one call on definNet or
+// definSNet.
+struct definPathRecord
+{
+  enum Op
+  {
+    LAYER,
+    TAPER,
+    TAPER_RULE,
+    VIA,
+    VIA_ROTATED,
+    VIA_ARRAY,
+    POINT,
+    FLUSH_POINT,
+    RECT,
+    SHAPE,
+    COLOR,
+    VIA_COLOR
+  };
+
+  definPathRecord(Op op,
+                  std::string name = {},
+                  std::string rule = {},
+                  std::array<int, 4> values = {})
+      : op(op),
+        name(std::move(name)),
+        rule(std::move(rule)),
+        values(values)
+  {
+  }
+
+  Op op;
+  std::string name;
+  std::string rule;
+  std::array<int, 4> values;
+};
+
+struct definWireRecord
+{
+  std::string type;
+  std::optional<std::string> shield;
+  std::vector<std::vector<definPathRecord>> paths;
+};
+
+struct definConnectionRecord
+{
+  std::string inst;
+  std::string pin;
+  bool must_join;
+  bool synthesized;
+};
+
+struct definRectRecord
+{
+  std::string status;
+  std::string shield;
+  std::string layer;
+  int xl;
+  int yl;
+  int xh;
+  int yh;
+  std::string shape;
+  int mask;
+};
+
+struct definNetRecord
+{
+  std::string name;
+  std::optional<std::string> use;
+  std::optional<std::string> source;
+  bool fixedbump = false;
+  std::optional<int> weight;
+  std::optional<std::string> non_default_rule;
+  std::vector<definConnectionRecord> connections;
+  std::vector<definRectRecord> rects;
+  std::vector<definWireRecord> wires;
+  std::vector<definPropRecord> props;
+};
+
+//////////////////////////////////////////////////////////
+///
+/// definPipeline - builds odb objects on a worker thread while the
+/// DEF parser keeps reading.
+///
+/// Tasks run on the worker one at a time in the order they were added,
+/// so the database is built exactly as the serial reader builds it. The
+/// calling thread must not touch the block between add() and drain().
+///
+//////////////////////////////////////////////////////////
+class definPipeline
+{
+ public:
+  definPipeline();
+  ~definPipeline();
+  definPipeline(const definPipeline&) = delete;
+  definPipeline& operator=(const definPipeline&) = delete;
+
+  void add(std::function<void()> task);
+  // Wait for every task added so far. An exception thrown by a task is
+  // rethrown here and the tasks after it are dropped.
+  void drain();
+
+ private:
+  using Chunk = std::vector<std::function<void()>>;
+
+  // Tasks are handed to the worker in chunks to keep locking rare, and
+  // the parser waits when too many chunks are pending to bound memory.
+  static constexpr size_t chunk_size = 1024;
+  static constexpr size_t max_pending_chunks = 64;
+
+  void run();
+  void submit();
+
+  Chunk _chunk;
+  std::deque<Chunk> _pending;
+  bool _busy = false;
+  bool _stop = false;
+  std::exception_ptr _error;
+  std::mutex _mutex;
+  std::condition_variable _work_ready;
+  std::condition_variable _work_done;
+  std::thread _worker;
+};
+
+}  // namespace odb
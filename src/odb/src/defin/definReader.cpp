@@ -37,6 +37,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include "definBlockage.h"
 #include "definComponent.h"
@@ -48,6 +49,7 @@
 #include "definNonDefaultRule.h"
 #include "definPin.h"
 #include "definPinProps.h"
+#include "definPipeline.h"
 #include "definPropDefs.h"
 #include "definRegion.h"
 #include "definRow.h"
@@ -176,6 +178,7 @@ definReader::definReader(dbDatabase* db, utl::Logger* logger, defin::MODE mode)
   _db = db;
   parent_ = nullptr;
   _continue_on_errors = false;
+  _threads = 1;
   hier_delimeter_ = 0;
   left_bus_delimeter_ = 0;
   right_bus_delimeter_ = 0;
@@ -221,6 +224,7 @@ definReader::definReader(dbDatabase* db, utl::Logger* logger, defin::MODE mode)
 
 definReader::~definReader()
 {
+  _pipeline.reset();
   delete _blockageR;
   delete _componentR;
   delete _componentMaskShift;
@@ -336,6 +340,27 @@ void definReader::setBlock(dbBlock* block)
   }
 }
 
+void definReader::setThreadCount(int threads)
+{
+  _threads = threads;
+}
+
+void definReader::build(std::function<void()> task)
+{
+  if (_pipeline) {
+    _pipeline->add(std::move(task));
+  } else {
+    task();
+  }
+}
+
+void definReader::drain()
+{
+  if (_pipeline) {
+    _pipeline->drain();
+  }
+}
+
 // Generic handler for transfering properties from the
 // Si2 DEF parser object to the OpenDB callback
 template <typename DEF_TYPE, typename CALLBACK>
@@ -358,6 +383,41 @@ static void handle_props(DEF_TYPE* def_obj, CALLBACK* callback)
   }
 }
 
+// Copy the properties of a DEF object for a later apply_props
+template <typename DEF_TYPE>
+static void record_props(DEF_TYPE* def_obj,
+                         std::vector<definPropRecord>& props)
+{
+  for (int i = 0; i < def_obj->numProps(); ++i) {
+    const char* value = def_obj->propValue(i);
+    props.push_back({def_obj->propName(i),
+                     def_obj->propType(i),
+                     def_obj->propNumber(i),
+                     value ? value : ""});
+  }
+}
+
+template <typename CALLBACK>
+static void apply_props(const std::vector<definPropRecord>& props,
+                        CALLBACK* callback)
+{
+  for (const definPropRecord& prop : props) {
+    switch (prop.type) {
+      case 'R':
+        callback->property(prop.name.c_str(), prop.number);
+        break;
+      case 'I':
+        callback->property(prop.name.c_str(), (int) prop.number);
+        break;
+      case 'S': /* fallthru */
+      case 'N': /* fallthru */
+      case 'Q':
+        callback->property(prop.name.c_str(), prop.value.c_str());
+        break;
+    }
+  }
+}
+
 static std::string renameBlock(dbBlock* parent, const char* old_name)
 {
   int cnt = 1;
@@ -556,7 +616,6 @@ int definReader::componentsCallback(defrCallbackType_e /* unused: type */,
 {
   definReader* reader = (definReader*) data;
   CHECKBLOCK
-  definComponent* componentR = reader->_componentR;
   if (reader->_mode != defin::DEFAULT
       && reader->_block->findInst(comp->id()) == nullptr) {
     std::string modeStr
@@ -581,31 +640,69 @@ int definReader::componentsCallback(defrCallbackType_e /* unused: type */,
     UNSUPPORTED("ROUTEHALO on component is unsupported");
   }
 
-  componentR->begin(comp->id(), comp->name());
+  definComponentRecord record;
+  record.id = comp->id();
+  record.name = comp->name();
   if (comp->hasSource()) {
-    componentR->source(dbSourceType(comp->source()));
+    record.source = comp->source();
   }
   if (comp->hasWeight()) {
-    componentR->weight(comp->weight());
+    record.weight = comp->weight();
   }
   if (comp->hasRegionName()) {
-    componentR->region(comp->regionName());
+    record.region = comp->regionName();
   }
   if (comp->hasHalo() > 0) {
-    int left, bottom, right, top;
-    comp->haloEdges(&left, &bottom, &right, &top);
-    componentR->halo(left, bottom, right, top);
+    std::array<int, 4> halo;
+    comp->haloEdges(&halo[0], &halo[1], &halo[2], &halo[3]);
+    record.halo = halo;
   }
 
-  componentR->placement(comp->placementStatus(),
-                        comp->placementX(),
-                        comp->placementY(),
-                        comp->placementOrient());
+  record.status = comp->placementStatus();
+  record.x = comp->placementX();
+  record.y = comp->placementY();
+  record.orient = comp->placementOrient();
 
-  handle_props(comp, componentR);
+  record_props(comp, record.props);
+
+  reader->build([reader, record = std::move(record)] {
+    reader->buildComponent(record);
+  });
+
+  return PARSE_OK;
+}
+
+void definReader::buildComponent(const definComponentRecord& record)
+{
+  definComponent* componentR = _componentR;
+  componentR->begin(record.id.c_str(), record.name.c_str());
+  if (record.source) {
+    componentR->source(dbSourceType(record.source->c_str()));
+  }
+  if (record.weight) {
+    componentR->weight(*record.weight);
+  }
+  if (record.region) {
+    componentR->region(record.region->c_str());
+  }
+  if (record.halo) {
+    const std::array<int, 4>& halo = *record.halo;
+    componentR->halo(halo[0], halo[1], halo[2], halo[3]);
+  }
+
+  componentR->placement(record.status, record.x, record.y, record.orient);
+
+  apply_props(record.props, componentR);
 
   componentR->end();
+}
 
+int definReader::componentsEndCallback(defrCallbackType_e /* unused: type */,
+                                       void* /* unused: v */,
+                                       defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  reader->drain();
   return PARSE_OK;
 }
 
@@ -802,7 +899,6 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
 {
   definReader* reader = (definReader*) data;
   CHECKBLOCK
-  definNet* netR = reader->_netR;
   if (reader->_mode == defin::FLOORPLAN
       && reader->_block->findNet(net->name()) == nullptr) {
     reader->_logger->warn(
@@ -844,26 +940,25 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
     UNSUPPORTED("ESTCAP on net is unsupported");
   }
 
-  netR->begin(net->name());
+  definNetRecord record;
+  record.name = net->name();
 
   if (net->hasUse()) {
-    netR->use(net->use());
+    record.use = net->use();
   }
 
   if (net->hasSource()) {
-    netR->source(net->source());
+    record.source = net->source();
   }
 
-  if (net->hasFixedbump()) {
-    netR->fixedbump();
-  }
+  record.fixedbump = net->hasFixedbump();
 
   if (net->hasWeight()) {
-    netR->weight(net->weight());
+    record.weight = net->weight();
   }
 
   if (net->hasNonDefaultRule()) {
-    netR->nonDefaultRule(net->nonDefaultRule());
+    record.non_default_rule = net->nonDefaultRule();
   }
 
   for (int i = 0; i < net->numConnections(); ++i) {
@@ -871,19 +966,18 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
       UNSUPPORTED("SYNTHESIZED on net's connection is unsupported");
     }
 
-    if (net->pinIsMustJoin(i)) {
-      netR->beginMustjoin(net->instance(i), net->pin(i));
-    } else {
-      netR->connection(net->instance(i), net->pin(i));
-    }
+    record.connections.push_back(
+        {net->instance(i), net->pin(i), (bool) net->pinIsMustJoin(i), false});
   }
 
   for (int i = 0; i < net->numWires(); ++i) {
     defiWire* wire = net->wire(i);
-    netR->wire(wire->wireType());
+    definWireRecord& wire_record = record.wires.emplace_back();
+    wire_record.type = wire->wireType();
 
     for (int j = 0; j < wire->numPaths(); ++j) {
       defiPath* path = wire->path(j);
+      std::vector<definPathRecord>& steps = wire_record.paths.emplace_back();
 
       path->initTraverse();
 
@@ -895,11 +989,12 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
             const char* layer = path->getLayer();
             int nextId = path->next();
             if (nextId == DEFIPATH_TAPER) {
-              netR->pathTaper(layer);
+              steps.push_back({definPathRecord::TAPER, layer});
             } else if (nextId == DEFIPATH_TAPERRULE) {
-              netR->pathTaperRule(layer, path->getTaperRule());
+              steps.push_back(
+                  {definPathRecord::TAPER_RULE, layer, path->getTaperRule()});
             } else {
-              netR->path(layer);
+              steps.push_back({definPathRecord::LAYER, layer});
               path->prev();  // put back the token
             }
             break;
@@ -910,29 +1005,30 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
             const char* viaName = path->getVia();
             int nextId = path->next();
             if (nextId == DEFIPATH_VIAROTATION) {
-              netR->pathVia(viaName,
-                            translate_orientation(path->getViaRotation()));
+              steps.push_back(
+                  {definPathRecord::VIA_ROTATED,
+                   viaName,
+                   "",
+                   {translate_orientation(path->getViaRotation()).getValue()}});
             } else {
-              netR->pathVia(viaName);
+              steps.push_back({definPathRecord::VIA, viaName});
               path->prev();  // put back the token
             }
             break;
           }
 
           case DEFIPATH_POINT: {
-            int x;
-            int y;
-            path->getPoint(&x, &y);
-            netR->pathPoint(x, y);
+            definPathRecord& step
+                = steps.emplace_back(definPathRecord::POINT);
+            path->getPoint(&step.values[0], &step.values[1]);
             break;
           }
 
           case DEFIPATH_FLUSHPOINT: {
-            int x;
-            int y;
-            int ext;
-            path->getFlushPoint(&x, &y, &ext);
-            netR->pathPoint(x, y, ext);
+            definPathRecord& step
+                = steps.emplace_back(definPathRecord::FLUSH_POINT);
+            path->getFlushPoint(
+                &step.values[0], &step.values[1], &step.values[2]);
             break;
           }
 
@@ -941,12 +1037,12 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
             break;
 
           case DEFIPATH_RECT: {
-            int deltaX1;
-            int deltaY1;
-            int deltaX2;
-            int deltaY2;
-            path->getViaRect(&deltaX1, &deltaY1, &deltaX2, &deltaY2);
-            netR->pathRect(deltaX1, deltaY1, deltaX2, deltaY2);
+            definPathRecord& step
+                = steps.emplace_back(definPathRecord::RECT);
+            path->getViaRect(&step.values[0],
+                             &step.values[1],
+                             &step.values[2],
+                             &step.values[3]);
             break;
           }
 
@@ -955,13 +1051,17 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
             break;
 
           case DEFIPATH_MASK:
-            netR->pathColor(path->getMask());
+            steps.push_back(
+                {definPathRecord::COLOR, "", "", {path->getMask()}});
             break;
 
           case DEFIPATH_VIAMASK:
-            netR->pathViaColor(path->getViaBottomMask(),
-                               path->getViaCutMask(),
-                               path->getViaTopMask());
+            steps.push_back({definPathRecord::VIA_COLOR,
+                             "",
+                             "",
+                             {path->getViaBottomMask(),
+                              path->getViaCutMask(),
+                              path->getViaTopMask()}});
             break;
 
           default:
@@ -969,16 +1069,109 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
             break;
         }
       }
+    }
+  }
+
+  record_props(net, record.props);
+
+  reader->build(
+      [reader, record = std::move(record)] { reader->buildNet(record); });
+
+  return PARSE_OK;
+}
+
+void definReader::buildNet(const definNetRecord& record)
+{
+  definNet* netR = _netR;
+  netR->begin(record.name.c_str());
+
+  if (record.use) {
+    netR->use(record.use->c_str());
+  }
+
+  if (record.source) {
+    netR->source(record.source->c_str());
+  }
+
+  if (record.fixedbump) {
+    netR->fixedbump();
+  }
+
+  if (record.weight) {
+    netR->weight(*record.weight);
+  }
+
+  if (record.non_default_rule) {
+    netR->nonDefaultRule(record.non_default_rule->c_str());
+  }
+
+  for (const definConnectionRecord& connection : record.connections) {
+    if (connection.must_join) {
+      netR->beginMustjoin(connection.inst.c_str(), connection.pin.c_str());
+    } else {
+      netR->connection(connection.inst.c_str(), connection.pin.c_str());
+    }
+  }
+
+  for (const definWireRecord& wire : record.wires) {
+    netR->wire(wire.type.c_str());
+
+    for (const std::vector<definPathRecord>& path : wire.paths) {
+      for (const definPathRecord& step : path) {
+        const std::array<int, 4>& v = step.values;
+        switch (step.op) {
+          case definPathRecord::LAYER:
+            netR->path(step.name.c_str());
+            break;
+          case definPathRecord::TAPER:
+            netR->pathTaper(step.name.c_str());
+            break;
+          case definPathRecord::TAPER_RULE:
+            netR->pathTaperRule(step.name.c_str(), step.rule.c_str());
+            break;
+          case definPathRecord::VIA:
+            netR->pathVia(step.name.c_str());
+            break;
+          case definPathRecord::VIA_ROTATED:
+            netR->pathVia(step.name.c_str(),
+                          dbOrientType((dbOrientType::Value) v[0]));
+            break;
+          case definPathRecord::POINT:
+            netR->pathPoint(v[0], v[1]);
+            break;
+          case definPathRecord::FLUSH_POINT:
+            netR->pathPoint(v[0], v[1], v[2]);
+            break;
+          case definPathRecord::RECT:
+            netR->pathRect(v[0], v[1], v[2], v[3]);
+            break;
+          case definPathRecord::COLOR:
+            netR->pathColor(v[0]);
+            break;
+          case definPathRecord::VIA_COLOR:
+            netR->pathViaColor(v[0], v[1], v[2]);
+            break;
+          default:
+            break;
+        }
+      }
       netR->pathEnd();
     }
 
     netR->wireEnd();
   }
 
-  handle_props(net, netR);
+  apply_props(record.props, netR);
 
   netR->end();
+}
 
+int definReader::netsEndCallback(defrCallbackType_e /* unused: type */,
+                                 void* /* unused: v */,
+                                 defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  reader->drain();
   return PARSE_OK;
 }
 
@@ -1674,7 +1867,6 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
 {
   definReader* reader = (definReader*) data;
   CHECKBLOCK
-  definSNet* snetR = reader->_snetR;
   if (reader->_mode == defin::FLOORPLAN
       && reader->_block->findNet(net->name()) == nullptr) {
     reader->_logger->warn(
@@ -1714,58 +1906,63 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
     UNSUPPORTED("VIA in special net is unsupported");
   }
 
-  snetR->begin(net->name());
+  definNetRecord record;
+  record.name = net->name();
 
   if (net->hasUse()) {
-    snetR->use(net->use());
+    record.use = net->use();
   }
 
   if (net->hasSource()) {
-    snetR->source(net->source());
+    record.source = net->source();
   }
 
-  if (net->hasFixedbump()) {
-    snetR->fixedbump();
-  }
+  record.fixedbump = net->hasFixedbump();
 
   if (net->hasWeight()) {
-    snetR->weight(net->weight());
+    record.weight = net->weight();
   }
 
   for (int i = 0; i < net->numConnections(); ++i) {
-    snetR->connection(net->instance(i), net->pin(i), net->pinIsSynthesized(i));
-  }
-
-  if (net->numRectangles()) {
-    for (int i = 0; i < net->numRectangles(); i++) {
-      snetR->wire(net->rectRouteStatus(i), net->rectRouteStatusShieldName(i));
-      snetR->rect(net->rectName(i),
-                  net->xl(i),
-                  net->yl(i),
-                  net->xh(i),
-                  net->yh(i),
-                  net->rectShapeType(i),
-                  net->rectMask(i));
-      snetR->wireEnd();
-    }
+    record.connections.push_back({net->instance(i),
+                                  net->pin(i),
+                                  false,
+                                  (bool) net->pinIsSynthesized(i)});
+  }
+
+  for (int i = 0; i < net->numRectangles(); i++) {
+    record.rects.push_back({net->rectRouteStatus(i),
+                            net->rectRouteStatusShieldName(i),
+                            net->rectName(i),
+                            net->xl(i),
+                            net->yl(i),
+                            net->xh(i),
+                            net->yh(i),
+                            net->rectShapeType(i),
+                            net->rectMask(i)});
   }
 
   for (int i = 0; i < net->numWires(); ++i) {
     defiWire* wire = net->wire(i);
-    snetR->wire(wire->wireType(), wire->wireShieldNetName());
+    definWireRecord& wire_record = record.wires.emplace_back();
+    wire_record.type = wire->wireType();
+    if (wire->wireShieldNetName()) {
+      wire_record.shield = wire->wireShieldNetName();
+    }
 
     for (int j = 0; j < wire->numPaths(); ++j) {
       defiPath* path = wire->path(j);
+      std::vector<definPathRecord>& steps = wire_record.paths.emplace_back();
 
       path->initTraverse();
 
       std::string layerName;
 
       int pathId;
-      uint next_mask = 0;
-      uint next_via_bottom_mask = 0;
-      uint next_via_cut_mask = 0;
-      uint next_via_top_mask = 0;
+      int next_mask = 0;
+      int next_via_bottom_mask = 0;
+      int next_via_cut_mask = 0;
+      int next_via_top_mask = 0;
       while ((pathId = path->next()) != DEFIPATH_DONE) {
         switch (pathId) {
           case DEFIPATH_LAYER:
@@ -1779,17 +1976,20 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
             if (nextId == DEFIPATH_VIAROTATION) {
               UNSUPPORTED("Rotated via in special net is unsupported");
               // TODO: Make this take and store rotation
-              // snetR->pathVia(viaName,
-              //                translate_orientation(path->getViaRotation()));
             } else if (nextId == DEFIPATH_VIADATA) {
-              int numX, numY, stepX, stepY;
-              path->getViaData(&numX, &numY, &stepX, &stepY);
-              snetR->pathViaArray(viaName, numX, numY, stepX, stepY);
+              definPathRecord& step
+                  = steps.emplace_back(definPathRecord::VIA_ARRAY, viaName);
+              path->getViaData(&step.values[0],
+                               &step.values[1],
+                               &step.values[2],
+                               &step.values[3]);
             } else {
-              snetR->pathVia(viaName,
-                             next_via_bottom_mask,
-                             next_via_cut_mask,
-                             next_via_top_mask);
+              steps.push_back({definPathRecord::VIA,
+                               viaName,
+                               "",
+                               {next_via_bottom_mask,
+                                next_via_cut_mask,
+                                next_via_top_mask}});
               path->prev();  // put back the token
             }
             break;
@@ -1797,28 +1997,29 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
 
           case DEFIPATH_WIDTH:
             assert(!layerName.empty());  // always "layerName routeWidth"
-            snetR->path(layerName.c_str(), path->getWidth());
+            steps.push_back(
+                {definPathRecord::LAYER, layerName, "", {path->getWidth()}});
             break;
 
           case DEFIPATH_POINT: {
-            int x;
-            int y;
-            path->getPoint(&x, &y);
-            snetR->pathPoint(x, y, next_mask);
+            definPathRecord& step
+                = steps.emplace_back(definPathRecord::POINT);
+            path->getPoint(&step.values[0], &step.values[1]);
+            step.values[2] = next_mask;
             break;
           }
 
           case DEFIPATH_FLUSHPOINT: {
-            int x;
-            int y;
-            int ext;
-            path->getFlushPoint(&x, &y, &ext);
-            snetR->pathPoint(x, y, ext, next_mask);
+            definPathRecord& step
+                = steps.emplace_back(definPathRecord::FLUSH_POINT);
+            path->getFlushPoint(
+                &step.values[0], &step.values[1], &step.values[2]);
+            step.values[3] = next_mask;
             break;
           }
 
           case DEFIPATH_SHAPE:
-            snetR->pathShape(path->getShape());
+            steps.push_back({definPathRecord::SHAPE, path->getShape()});
             break;
 
           case DEFIPATH_STYLE:
@@ -1848,16 +2049,104 @@ int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
           next_via_top_mask = 0;
         }
       }
+    }
+  }
+
+  record_props(net, record.props);
+
+  reader->build([reader, record = std::move(record)] {
+    reader->buildSpecialNet(record);
+  });
+
+  return PARSE_OK;
+}
+
+void definReader::buildSpecialNet(const definNetRecord& record)
+{
+  definSNet* snetR = _snetR;
+  snetR->begin(record.name.c_str());
+
+  if (record.use) {
+    snetR->use(record.use->c_str());
+  }
+
+  if (record.source) {
+    snetR->source(record.source->c_str());
+  }
+
+  if (record.fixedbump) {
+    snetR->fixedbump();
+  }
+
+  if (record.weight) {
+    snetR->weight(*record.weight);
+  }
+
+  for (const definConnectionRecord& connection : record.connections) {
+    snetR->connection(connection.inst.c_str(),
+                      connection.pin.c_str(),
+                      connection.synthesized);
+  }
+
+  for (const definRectRecord& rect : record.rects) {
+    snetR->wire(rect.status.c_str(), rect.shield.c_str());
+    snetR->rect(rect.layer.c_str(),
+                rect.xl,
+                rect.yl,
+                rect.xh,
+                rect.yh,
+                rect.shape.c_str(),
+                rect.mask);
+    snetR->wireEnd();
+  }
+
+  for (const definWireRecord& wire : record.wires) {
+    snetR->wire(wire.type.c_str(),
+                wire.shield ? wire.shield->c_str() : nullptr);
+
+    for (const std::vector<definPathRecord>& path : wire.paths) {
+      for (const definPathRecord& step : path) {
+        const std::array<int, 4>& v = step.values;
+        switch (step.op) {
+          case definPathRecord::LAYER:
+            snetR->path(step.name.c_str(), v[0]);
+            break;
+          case definPathRecord::VIA:
+            snetR->pathVia(step.name.c_str(), v[0], v[1], v[2]);
+            break;
+          case definPathRecord::VIA_ARRAY:
+            snetR->pathViaArray(step.name.c_str(), v[0], v[1], v[2], v[3]);
+            break;
+          case definPathRecord::POINT:
+            snetR->pathPoint(v[0], v[1], (uint) v[2]);
+            break;
+          case definPathRecord::FLUSH_POINT:
+            snetR->pathPoint(v[0], v[1], v[2], (uint) v[3]);
+            break;
+          case definPathRecord::SHAPE:
+            snetR->pathShape(step.name.c_str());
+            break;
+          default:
+            break;
+        }
+      }
       snetR->pathEnd();
     }
 
     snetR->wireEnd();
   }
 
-  handle_props(net, snetR);
+  apply_props(record.props, snetR);
 
   snetR->end();
+}
 
+int definReader::specialNetsEndCallback(defrCallbackType_e /* unused: type */,
+                                        void* /* unused: v */,
+                                        defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  reader->drain();
   return PARSE_OK;
 }
 
@@ -2050,6 +2339,7 @@ bool definReader::createBlock(const char* file)
   defrSetDesignCbk(designCallback);
   defrSetUnitsCbk(unitsCallback);
   defrSetComponentCbk(componentsCallback);
+  defrSetComponentEndCbk(componentsEndCallback);
   defrSetComponentMaskShiftLayerCbk(componentMaskShiftCallback);
   defrSetPinCbk(pinCallback);
   defrSetPinEndCbk(pinsEndCallback);
@@ -2060,7 +2350,9 @@ bool definReader::createBlock(const char* file)
     defrSetTrackCbk(trackCallback);
     defrSetRowCbk(rowCallback);
     defrSetNetCbk(netCallback);
+    defrSetNetEndCbk(netsEndCallback);
     defrSetSNetCbk(specialNetCallback);
+    defrSetSNetEndCbk(specialNetsEndCallback);
     defrSetViaCbk(viaCallback);
     defrSetBlockageCbk(blockageCallback);
     defrSetNonDefaultCbk(nonDefaultRuleCallback);
@@ -2095,6 +2387,11 @@ bool definReader::createBlock(const char* file)
     defrSetScanchainCbk(scanchainsCallback);
   }
 
+  // Other modes look objects up while parsing so they stay serial.
+  if (_mode == defin::DEFAULT && _threads > 1) {
+    _pipeline = std::make_unique<definPipeline>();
+  }
+
   bool isZipped = hasSuffix(file, ".gz");
   int res;
   if (!isZipped) {
@@ -2117,6 +2414,10 @@ bool definReader::createBlock(const char* file)
     defGZipClose(f);
   }
 
+  // A section left unfinished by a parse error has not been drained.
+  drain();
+  _pipeline.reset();
+
   if (res != 0 || errors() != 0) {
     if (!_continue_on_errors) {
       _logger->error(utl::ODB, 421, "DEF parser returns an error!");
@@ -32,6 +32,11 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "definBase.h"
 #include "defrReader.hpp"
 #include "odb/odb.h"
@@ -58,6 +63,9 @@ class definGroup;
 class definNonDefaultRule;
 class definPropDefs;
 class definPinProps;
+class definPipeline;
+struct definComponentRecord;
+struct definNetRecord;
 
 class definReader : public definBase
 {
@@ -87,6 +95,9 @@ class definReader : public definBase
   char hier_delimeter_;
   char left_bus_delimeter_;
   char right_bus_delimeter_;
+  int _threads;
+  // Builds COMPONENTS, NETS and SPECIALNETS while the parser reads ahead
+  std::unique_ptr<definPipeline> _pipeline;
 
   void init() override;
   void setLibs(std::vector<dbLib*>& lib_names);
@@ -102,6 +113,14 @@ class definReader : public definBase
   void replaceWires();
   int errors();
 
+  // Run task now, or on the pipeline if there is one.
+  void build(std::function<void()> task);
+  // Wait until the pipeline has built everything parsed so far.
+  void drain();
+  void buildComponent(const definComponentRecord& record);
+  void buildNet(const definNetRecord& record);
+  void buildSpecialNet(const definNetRecord& record);
+
   // Parser callbacks
   static int blockageCallback(defrCallbackType_e type,
                               defiBlockage* blockage,
@@ -111,6 +130,10 @@ class definReader : public definBase
                                 defiComponent* comp,
                                 defiUserData data);
 
+  static int componentsEndCallback(defrCallbackType_e type,
+                                   void* v,
+                                   defiUserData data);
+
   static int componentMaskShiftCallback(
       defrCallbackType_e type,
       defiComponentMaskShiftLayer* shiftLayers,
@@ -155,6 +178,10 @@ class definReader : public definBase
                          defiNet* net,
                          defiUserData data);
 
+  static int netsEndCallback(defrCallbackType_e type,
+                             void* v,
+                             defiUserData data);
+
   static int nonDefaultRuleCallback(defrCallbackType_e type,
                                     defiNonDefault* rule,
                                     defiUserData data);
@@ -209,6 +236,10 @@ class definReader : public definBase
                                 defiNet* net,
                                 defiUserData data);
 
+  static int specialNetsEndCallback(defrCallbackType_e type,
+                                    void* v,
+                                    defiUserData data);
+
   static int stylesCallback(defrCallbackType_e type,
                             int count,
                             defiUserData data);
@@ -261,6 +292,7 @@ class definReader : public definBase
   void useBlockName(const char* name);
   void namesAreDBIDs();
   void setAssemblyMode();
+  void setThreadCount(int threads);
   void error(std::string_view msg);
 
   dbChip* createChip(std::vector<dbLib*>& search_libs,
@@ -34,12 +34,23 @@
 
 #include <stdio.h>
 #include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -62,6 +73,118 @@ std::string getPinName(dbITerm* iterm)
 
 static const int max_name_length = 256;
 
+// Objects formatted together by one thread in writeObjects.
+constexpr size_t objects_per_chunk = 256;
+
+// A FILE* that compresses everything written to it into gz.
+#ifdef __APPLE__
+int gzCookieWrite(void* cookie, const char* data, int size)
+{
+  return gzwrite((gzFile) cookie, data, size);
+}
+#else
+ssize_t gzCookieWrite(void* cookie, const char* data, size_t size)
+{
+  return gzwrite((gzFile) cookie, data, size);
+}
+#endif
+
+int gzCookieClose(void* cookie)
+{
+  return gzclose((gzFile) cookie) == Z_OK ? 0 : EOF;
+}
+
+FILE* openGzipStream(FILE* file)
+{
+  const int fd = dup(fileno(file));
+  if (fd < 0) {
+    return nullptr;
+  }
+  gzFile gz = gzdopen(fd, "wb");
+  if (gz == nullptr) {
+    close(fd);
+    return nullptr;
+  }
+#ifdef __APPLE__
+  return funopen(gz, nullptr, gzCookieWrite, nullptr, gzCookieClose);
+#else
+  cookie_io_functions_t functions{};
+  functions.write = gzCookieWrite;
+  functions.close = gzCookieClose;
+  return fopencookie(gz, "w", functions);
+#endif
+}
+
+// Closes the gzip stream if writing the DEF throws before it is closed.
+class GzipStreamGuard
+{
+ public:
+  explicit GzipStreamGuard(FILE* stream) : stream_(stream) {}
+  ~GzipStreamGuard()
+  {
+    if (stream_) {
+      fclose(stream_);
+    }
+  }
+
+  // Flushes and closes the stream; returns false if that fails.
+  bool close()
+  {
+    FILE* stream = stream_;
+    stream_ = nullptr;
+    return stream == nullptr || fclose(stream) == 0;
+  }
+
+  GzipStreamGuard(const GzipStreamGuard&) = delete;
+  GzipStreamGuard& operator=(const GzipStreamGuard&) = delete;
+
+ private:
+  FILE* stream_;
+};
+
+// Wire points are most of a routed DEF, and printf spends most of its time
+// there parsing the format, so points are formatted with these into a
+// local buffer and written with one fwrite.
+char* appendInt(char* pos, const int value)
+{
+  return std::to_chars(pos, pos + std::numeric_limits<int>::digits10 + 2, value)
+      .ptr;
+}
+
+char* appendStr(char* pos, const std::string_view str)
+{
+  memcpy(pos, str.data(), str.size());
+  return pos + str.size();
+}
+
+bool hasSuffix(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size()
+         && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Freezes a block for the lifetime of the guard and restores its previous
+// state afterwards, even if writing throws.
+class FrozenBlockGuard
+{
+ public:
+  FrozenBlockGuard(dbBlock* block, const bool freeze)
+      : block_(block), was_frozen_(block->isFrozen())
+  {
+    if (freeze) {
+      block_->setFrozen(true);
+    }
+  }
+  ~FrozenBlockGuard() { block_->setFrozen(was_frozen_); }
+
+  FrozenBlockGuard(const FrozenBlockGuard&) = delete;
+  FrozenBlockGuard& operator=(const FrozenBlockGuard&) = delete;
+
+ private:
+  dbBlock* block_;
+  const bool was_frozen_;
+};
+
 template <typename T>
 std::vector<T*> sortedSet(dbSet<T>& to_sort)
 {
@@ -187,6 +310,22 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   fstat(fileno(_out), &stats);
   setvbuf(_out, nullptr, _IOFBF, stats.st_blksize);
 
+  const bool gzip = hasSuffix(def_file, ".gz");
+  if (gzip) {
+    _out = openGzipStream(_out);
+    if (_out == nullptr) {
+      _logger->warn(utl::ODB,
+                    449,
+                    "Cannot open gzip stream for DEF file ({})",
+                    def_file);
+      return false;
+    }
+  }
+  GzipStreamGuard gzip_guard(gzip ? _out : nullptr);
+
+  // Sections formatted on several threads only read the block.
+  FrozenBlockGuard frozen_guard(block, _threads > 1);
+
   if (_version == defout::DEF_5_3) {
     fprintf(_out, "VERSION 5.3 ;\n");
   } else if (_version == defout::DEF_5_4) {
@@ -258,6 +397,11 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   writeScanChains(block);
 
   fprintf(_out, "END DESIGN\n");
+  _out = nullptr;
+  if (!gzip_guard.close()) {
+    _logger->warn(
+        utl::ODB, 450, "Error compressing DEF file ({})", def_file);
+  }
   {
     delete _select_net_map;
   }
@@ -531,16 +675,102 @@ void defout_impl::writeInsts(dbBlock* block)
   fprintf(_out, "COMPONENTS %u ;\n", insts.size());
 
   // Sort the components for consistent output
+  std::vector<dbInst*> selected;
   for (dbInst* inst : sortedSet(insts)) {
     if (_select_inst_map && !(*_select_inst_map)[inst]) {
       continue;
     }
-    writeInst(inst);
+    selected.push_back(inst);
   }
+  writeObjects(selected, &defout_impl::writeInst);
 
   fprintf(_out, "END COMPONENTS\n");
 }
 
+// Objects are formatted in chunks on _threads threads, each into its own
+// memory buffer by its own copy of the writer, and the buffers are written
+// out in order. A batch of chunks is formatted at a time to bound memory.
+template <typename T>
+void defout_impl::writeObjects(const std::vector<T*>& objects,
+                               void (defout_impl::*write)(T*))
+{
+  if (_threads <= 1 || objects.size() <= objects_per_chunk) {
+    for (T* object : objects) {
+      (this->*write)(object);
+    }
+    return;
+  }
+
+  struct Buffer
+  {
+    char* data = nullptr;
+    size_t size = 0;
+  };
+
+  const size_t chunk_count
+      = (objects.size() + objects_per_chunk - 1) / objects_per_chunk;
+  const size_t batch_size = 4 * _threads;
+  std::vector<Buffer> buffers(batch_size);
+
+  for (size_t first = 0; first < chunk_count; first += batch_size) {
+    const size_t last = std::min(first + batch_size, chunk_count);
+    std::atomic<size_t> next_chunk = first;
+    // The first error stops the other threads and is rethrown once they
+    // have all finished.
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto format = [&]() {
+      defout_impl writer(*this);
+      writer._out = nullptr;
+      try {
+        for (size_t chunk = next_chunk++; chunk < last;
+             chunk = next_chunk++) {
+          Buffer& buffer = buffers[chunk - first];
+          writer._out = open_memstream(&buffer.data, &buffer.size);
+          const size_t end
+              = std::min((chunk + 1) * objects_per_chunk, objects.size());
+          for (size_t i = chunk * objects_per_chunk; i < end; ++i) {
+            (writer.*write)(objects[i]);
+          }
+          fclose(writer._out);
+          writer._out = nullptr;
+        }
+      } catch (...) {
+        if (writer._out) {
+          fclose(writer._out);
+        }
+        next_chunk = last;
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    const size_t thread_count = std::min<size_t>(_threads, last - first);
+    for (size_t i = 1; i < thread_count; ++i) {
+      threads.emplace_back(format);
+    }
+    format();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    for (size_t chunk = first; chunk < last; ++chunk) {
+      Buffer& buffer = buffers[chunk - first];
+      if (!error) {
+        fwrite(buffer.data, 1, buffer.size, _out);
+      }
+      free(buffer.data);
+      buffer = Buffer();
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
 void defout_impl::writeNonDefaultRules(dbBlock* block)
 {
   dbSet<dbTechNonDefaultRule> rules = block->getNonDefaultRules();
@@ -1447,29 +1677,33 @@ void defout_impl::writeNets(dbBlock* block)
   if (snet_cnt > 0) {
     fprintf(_out, "SPECIALNETS %d ;\n", snet_cnt);
 
+    std::vector<dbNet*> snets;
     for (dbNet* net : sorted_nets) {
       if (_select_net_map && !(*_select_net_map)[net]) {
         continue;
       }
       if (net->isSpecial()) {
-        writeSNet(net);
+        snets.push_back(net);
       }
     }
+    writeObjects(snets, &defout_impl::writeSNet);
 
     fprintf(_out, "END SPECIALNETS\n");
   }
 
   fprintf(_out, "NETS %d ;\n", net_cnt);
 
+  std::vector<dbNet*> signal_nets;
   for (dbNet* net : sorted_nets) {
     if (_select_net_map && !(*_select_net_map)[net]) {
       continue;
     }
 
     if (regular_net[net] == 1) {
-      writeNet(net);
+      signal_nets.push_back(net);
     }
   }
+  writeObjects(signal_nets, &defout_impl::writeNet);
 
   fprintf(_out, "END NETS\n");
 }
@@ -1649,13 +1883,26 @@ void defout_impl::writeWire(dbWire* wire)
           mask_statement = fmt::format("MASK {}", color.value());
         }
 
+        char buffer[64];
+        char* pos = buffer;
         if (point_cnt == 1) {
-          fprintf(_out, " ( %d %d )", x, y);
+          pos = appendStr(pos, " ( ");
+          pos = appendInt(pos, x);
+          pos = appendStr(pos, " ");
+          pos = appendInt(pos, y);
+          pos = appendStr(pos, " )");
         } else if (x == prev_x) {
-          fprintf(_out, "%s ( * %d )", mask_statement.c_str(), y);
+          pos = appendStr(pos, mask_statement);
+          pos = appendStr(pos, " ( * ");
+          pos = appendInt(pos, y);
+          pos = appendStr(pos, " )");
         } else if (y == prev_y) {
-          fprintf(_out, "%s ( %d * )", mask_statement.c_str(), x);
+          pos = appendStr(pos, mask_statement);
+          pos = appendStr(pos, " ( ");
+          pos = appendInt(pos, x);
+          pos = appendStr(pos, " * )");
         }
+        fwrite(buffer, 1, pos - buffer, _out);
 
         prev_x = x;
         prev_y = y;
@@ -1673,15 +1920,34 @@ void defout_impl::writeWire(dbWire* wire)
           fprintf(_out, "\n    ");
         }
 
+        char buffer[64];
+        char* pos = buffer;
         if (point_cnt == 1) {
-          fprintf(_out, " ( %d %d %d )", x, y, ext);
+          pos = appendStr(pos, " ( ");
+          pos = appendInt(pos, x);
+          pos = appendStr(pos, " ");
+          pos = appendInt(pos, y);
+          pos = appendStr(pos, " ");
+          pos = appendInt(pos, ext);
+          pos = appendStr(pos, " )");
         } else if ((x == prev_x) && (y == prev_y)) {
-          fprintf(_out, " ( * * %d )", ext);
+          pos = appendStr(pos, " ( * * ");
+          pos = appendInt(pos, ext);
+          pos = appendStr(pos, " )");
         } else if (x == prev_x) {
-          fprintf(_out, " ( * %d %d )", y, ext);
+          pos = appendStr(pos, " ( * ");
+          pos = appendInt(pos, y);
+          pos = appendStr(pos, " ");
+          pos = appendInt(pos, ext);
+          pos = appendStr(pos, " )");
         } else if (y == prev_y) {
-          fprintf(_out, " ( %d * %d )", x, ext);
+          pos = appendStr(pos, " ( ");
+          pos = appendInt(pos, x);
+          pos = appendStr(pos, " * ");
+          pos = appendInt(pos, ext);
+          pos = appendStr(pos, " )");
         }
+        fwrite(buffer, 1, pos - buffer, _out);
 
         prev_x = x;
         prev_y = y;
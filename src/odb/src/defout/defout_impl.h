@@ -35,6 +35,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -78,6 +79,7 @@ class defout_impl
   dbMap<dbInst, char>* _select_inst_map;
   dbTechNonDefaultRule* _non_default_rule;
   int _version;
+  int _threads;
   std::map<std::string, bool> _prop_defs[9];
   utl::Logger* _logger;
 
@@ -97,6 +99,9 @@ class defout_impl
   void writeNonDefaultRule(dbTechNonDefaultRule* rule);
   void writeLayerRule(dbTechLayerRule* rule);
   void writeInst(dbInst* inst);
+  template <typename T>
+  void writeObjects(const std::vector<T*>& objects,
+                    void (defout_impl::*write)(T*));
   void writeBTerms(dbBlock* block);
   void writeBTerm(dbBTerm* bterm);
   void writeBPin(dbBPin* bpin, int n);
@@ -128,6 +133,7 @@ class defout_impl
     _select_inst_map = nullptr;
     _non_default_rule = nullptr;
     _version = defout::DEF_5_8;
+    _threads = 1;
     _logger = logger;
   }
 
@@ -143,6 +149,7 @@ class defout_impl
 
   void selectInst(dbInst* inst);
   void setVersion(int v) { _version = v; }
+  void setThreadCount(int threads) { _threads = threads; }
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
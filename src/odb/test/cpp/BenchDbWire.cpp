@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compares the memory and decode time of the dbWire opcode/operand arrays
+// with dbWireCompact, and dbWireShapeItr with dbWire::getShapes, on randomly
+// routed nets.
+//
+// Usage (from src/odb/test): BenchDbWire [num_nets]
+// It exits with an error if a decoded wire differs from its arrays or the
+// shape walks disagree, so ctest runs it on a small net count.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbShape.h"
+#include "odb/dbWireCodec.h"
+#include "odb/dbWireCompact.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+using odb::dbWire;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// A net with a few alternating met1/met2 segments and a short branch
+// from its first segment, so junction lookups walk back over the wire.
+void routeNet(odb::dbNet* net,
+              odb::dbTechLayer* met1,
+              odb::dbTechVia* via12,
+              std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> coord(0, 1000000);
+  std::uniform_int_distribution<int> step(-20000, 20000);
+  std::uniform_int_distribution<int> segments(2, 8);
+
+  dbWire* wire = dbWire::create(net);
+  odb::dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, odb::dbWireType::ROUTED);
+  int x = coord(rng);
+  int y = coord(rng);
+  encoder.addPoint(x, y);
+  int junction = -1;
+  int junction_x = 0;
+  int junction_y = 0;
+  const int num_segments = segments(rng);
+  for (int i = 0; i < num_segments; ++i) {
+    x += step(rng);
+    const int id = encoder.addPoint(x, y);
+    if (junction < 0) {
+      junction = id;
+      junction_x = x;
+      junction_y = y;
+    }
+    encoder.addTechVia(via12);
+    y += step(rng);
+    encoder.addPoint(x, y);
+    encoder.addTechVia(via12);
+  }
+  encoder.newPath(junction);
+  encoder.addPoint(junction_x, junction_y + step(rng));
+  encoder.end();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const int num_nets = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+  utl::Logger logger;
+  odb::dbDatabase* db = odb::dbDatabase::create();
+  odb::lefin lef_reader(db, &logger, /*ignore_non_routing_layers=*/false);
+  odb::dbLib* lib = lef_reader.createTechAndLib(
+      "bench", "bench", "data/sky130hd/sky130_fd_sc_hd.tlef");
+  odb::dbTech* tech = lib->getTech();
+  odb::dbChip* chip = odb::dbChip::create(db);
+  odb::dbBlock* block = odb::dbBlock::create(chip, "top");
+  block->setDefUnits(tech->getLefUnits());
+  block->setDieArea(odb::Rect(0, 0, 1000000, 1000000));
+
+  odb::dbTechLayer* met1 = tech->findLayer("met1");
+  odb::dbTechVia* via12 = tech->findVia("M1M2_PR");
+  std::mt19937 rng(42);
+  std::vector<dbWire*> wires;
+  for (int i = 0; i < num_nets; ++i) {
+    odb::dbNet* net
+        = odb::dbNet::create(block, ("net" + std::to_string(i)).c_str());
+    routeNet(net, met1, via12, rng);
+    wires.push_back(net->getWire());
+  }
+
+  // Copy out the raw arrays; this is what _dbWire keeps in memory.
+  size_t num_entries = 0;
+  std::vector<std::vector<unsigned char>> raw_opcodes(wires.size());
+  std::vector<std::vector<int>> raw_data(wires.size());
+  for (size_t i = 0; i < wires.size(); ++i) {
+    const int length = wires[i]->length();
+    for (int j = 0; j < length; ++j) {
+      raw_opcodes[i].push_back(wires[i]->getOpcode(j));
+      raw_data[i].push_back(wires[i]->getData(j));
+    }
+    num_entries += length;
+  }
+
+  auto start = Clock::now();
+  std::vector<odb::dbWireCompact> compacts(wires.size());
+  size_t compact_bytes = 0;
+  for (size_t i = 0; i < wires.size(); ++i) {
+    compacts[i].encode(raw_opcodes[i], raw_data[i]);
+    compact_bytes += compacts[i].byteSize();
+  }
+  const double encode_time = secondsSince(start);
+
+  start = Clock::now();
+  size_t num_ops = 0;
+  odb::dbWireDecoder decoder;
+  for (dbWire* wire : wires) {
+    decoder.begin(wire);
+    while (decoder.next() != odb::dbWireDecoder::END_DECODE) {
+      ++num_ops;
+    }
+  }
+  const double decoder_time = secondsSince(start);
+
+  // Both shape walks copy the shapes into a reused buffer, so they are
+  // timed doing the same work.
+  start = Clock::now();
+  size_t num_shapes = 0;
+  odb::dbWireShapeItr itr;
+  odb::dbShape shape;
+  std::vector<odb::dbShape> shapes;
+  for (dbWire* wire : wires) {
+    shapes.clear();
+    for (itr.begin(wire); itr.next(shape);) {
+      shapes.push_back(shape);
+    }
+    num_shapes += shapes.size();
+  }
+  const double shape_itr_time = secondsSince(start);
+
+  start = Clock::now();
+  size_t num_bulk_shapes = 0;
+  for (dbWire* wire : wires) {
+    wire->getShapes(shapes);
+    num_bulk_shapes += shapes.size();
+  }
+  const double get_shapes_time = secondsSince(start);
+
+  bool same_shapes = num_bulk_shapes == num_shapes;
+  for (dbWire* wire : wires) {
+    wire->getShapes(shapes);
+    size_t idx = 0;
+    for (itr.begin(wire); itr.next(shape); ++idx) {
+      same_shapes &= idx < shapes.size()
+                     && shapes[idx].getType() == shape.getType()
+                     && shapes[idx].getBox() == shape.getBox()
+                     && shapes[idx].getTechLayer() == shape.getTechLayer()
+                     && shapes[idx].getTechVia() == shape.getTechVia();
+    }
+    same_shapes &= idx == shapes.size();
+  }
+
+  start = Clock::now();
+  std::vector<unsigned char> opcodes;
+  std::vector<int> data;
+  bool round_trip = true;
+  for (size_t i = 0; i < compacts.size(); ++i) {
+    round_trip &= compacts[i].decode(opcodes, data);
+    round_trip &= opcodes == raw_opcodes[i] && data == raw_data[i];
+  }
+  const double compact_decode_time = secondsSince(start);
+
+  const size_t raw_bytes = num_entries * (sizeof(unsigned char) + sizeof(int));
+  std::printf("nets %d entries %zu decoder ops %zu shapes %zu\n",
+              num_nets,
+              num_entries,
+              num_ops,
+              num_shapes);
+  std::printf("memory: arrays %zu bytes, compact %zu bytes (%.2f%%)\n",
+              raw_bytes,
+              compact_bytes,
+              100.0 * compact_bytes / raw_bytes);
+  std::printf("dbWireDecoder walk      %8.4f s\n", decoder_time);
+  std::printf("dbWireShapeItr walk     %8.4f s\n", shape_itr_time);
+  std::printf("dbWire::getShapes       %8.4f s\n", get_shapes_time);
+  std::printf("dbWireCompact::encode   %8.4f s\n", encode_time);
+  std::printf("dbWireCompact::decode   %8.4f s\n", compact_decode_time);
+
+  odb::dbDatabase::destroy(db);
+  if (!round_trip) {
+    std::printf("dbWireCompact::decode does not match the encoded wires\n");
+    return 1;
+  }
+  if (!same_shapes) {
+    std::printf("dbWire::getShapes does not match dbWireShapeItr\n");
+    return 1;
+  }
+  return 0;
+}
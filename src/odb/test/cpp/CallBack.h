@@ -97,6 +97,12 @@ class CallBack : public dbBlockCallBackObj
       events.push_back("PostMove inst " + inst->getName());
     }
   }
+  void inDbInstPostRename(dbInst* inst) override
+  {
+    if (!_pause) {
+      events.push_back("PostRename inst " + inst->getName());
+    }
+  }
   // dbInst End
 
   // dbNet Start
@@ -112,6 +118,12 @@ class CallBack : public dbBlockCallBackObj
       events.push_back("Destroy net " + net->getName());
     }
   }
+  void inDbNetPostRename(dbNet* net) override
+  {
+    if (!_pause) {
+      events.push_back("PostRename net " + net->getName());
+    }
+  }
   // dbNet End
 
   // dbITerm Start
@@ -76,6 +76,12 @@ BOOST_AUTO_TEST_CASE(test_inst_and_iterm)
   cb->clearEvents();
   i1->findITerm("a")->disconnect();
   BOOST_TEST(cb->events.size() == 0);
+  i1->rename("i3");
+  i1->rename("i1");
+  BOOST_TEST(cb->events.size() == 2);
+  BOOST_TEST(cb->events[0] == "PostRename inst i3");
+  BOOST_TEST(cb->events[1] == "PostRename inst i1");
+  cb->clearEvents();
 
   dbInst::destroy(i1);
 
@@ -96,6 +102,12 @@ BOOST_AUTO_TEST_CASE(test_net)
   BOOST_TEST(cb->events.size() == 1);
   BOOST_TEST(cb->events[0] == "Create net n1");
   cb->clearEvents();
+  n1->rename("n2");
+  n1->rename("n1");
+  BOOST_TEST(cb->events.size() == 2);
+  BOOST_TEST(cb->events[0] == "PostRename net n2");
+  BOOST_TEST(cb->events[1] == "PostRename net n1");
+  cb->clearEvents();
   dbNet::destroy(n1);
   BOOST_TEST(cb->events.size() == 1);
   BOOST_TEST(cb->events[0] == "Destroy net n1");
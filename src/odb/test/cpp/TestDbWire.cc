@@ -6,11 +6,16 @@
 
 #include <unistd.h>
 
+#include <climits>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "odb/db.h"
+#include "odb/dbShape.h"
 #include "odb/dbWireCodec.h"
+#include "odb/dbWireCompact.h"
 #include "odb/lefin.h"
 #include "utl/Logger.h"
 
@@ -25,6 +30,8 @@ class OdbMultiPatternedTest : public ::testing::Test
   {
     db_ = OdbUniquePtr<odb::dbDatabase>(odb::dbDatabase::create(),
                                         &odb::dbDatabase::destroy);
+    // Writing the database reports the stream sizes through the logger.
+    db_->setLogger(&logger_);
     odb::lefin lef_reader(
         db_.get(), &logger_, /*ignore_non_routing_layers=*/false);
     lib_ = OdbUniquePtr<odb::dbLib>(
@@ -130,4 +137,151 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST(OdbWireCompactTest, RoundTripsEveryEntry)
+{
+  // Coordinates, a junction reference and operands at the int limits.
+  const std::vector<unsigned char> opcodes
+      = {0, 4, 5, 4, 5, 8, 2, 4, 5, 11, 11, 14, 11, 11, 11};
+  const std::vector<int> data = {3,
+                                 1000,
+                                 2000,
+                                 -5000,
+                                 2000,
+                                 7,
+                                 2,
+                                 INT_MAX,
+                                 INT_MIN,
+                                 INT_MIN,
+                                 INT_MAX,
+                                 -1,
+                                 0,
+                                 1,
+                                 123456789};
+  dbWireCompact compact;
+  compact.encode(opcodes, data);
+  EXPECT_EQ(compact.size(), static_cast<int>(opcodes.size()));
+
+  std::vector<unsigned char> decoded_opcodes;
+  std::vector<int> decoded_data;
+  EXPECT_TRUE(compact.decode(decoded_opcodes, decoded_data));
+  EXPECT_EQ(decoded_opcodes, opcodes);
+  EXPECT_EQ(decoded_data, data);
+
+  dbWireCompact copy;
+  copy.setBytes(compact.getBytes(), compact.size());
+  EXPECT_TRUE(copy.decode(decoded_opcodes, decoded_data));
+  EXPECT_EQ(decoded_opcodes, opcodes);
+  EXPECT_EQ(decoded_data, data);
+
+  // Truncated bytes, trailing bytes and a wrong entry count are rejected.
+  std::vector<unsigned char> bytes = compact.getBytes();
+  bytes.pop_back();
+  copy.setBytes(bytes, compact.size());
+  EXPECT_FALSE(copy.decode(decoded_opcodes, decoded_data));
+
+  bytes = compact.getBytes();
+  bytes.push_back(0);
+  copy.setBytes(bytes, compact.size());
+  EXPECT_FALSE(copy.decode(decoded_opcodes, decoded_data));
+
+  copy.setBytes(compact.getBytes(), compact.size() + 1);
+  EXPECT_FALSE(copy.decode(decoded_opcodes, decoded_data));
+
+  // An operand whose continuation bits never end.
+  bytes = {0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01};
+  copy.setBytes(bytes, 1);
+  EXPECT_FALSE(copy.decode(decoded_opcodes, decoded_data));
+}
+
+TEST_F(OdbMultiPatternedTest, GetShapesMatchesShapeItr)
+{
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechLayer* met2 = tech->findLayer("met2");
+  dbTechVia* met1_met2 = tech->findVia("M1M2_PR_MR");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50, 10);
+  encoder.addPoint(50, 50, 20);
+  const int junction = encoder.addPoint(400, 50);
+  encoder.addTechVia(met1_met2);
+  encoder.addPoint(400, 900, 0);
+  encoder.addPoint(1200, 900);
+  encoder.addRect(-10, -20, 30, 40);
+  encoder.newPath(junction);
+  encoder.addPoint(400, 10);
+  encoder.addPoint(10, 10);
+  encoder.newPathShort(junction, met2, dbWireType::ROUTED);
+  encoder.addPoint(400, 700);
+  encoder.end();
+
+  std::vector<dbShape> expected;
+  dbWireShapeItr itr;
+  dbShape shape;
+  for (itr.begin(wire); itr.next(shape);) {
+    expected.push_back(shape);
+  }
+
+  std::vector<dbShape> shapes(3);
+  wire->getShapes(shapes);
+  ASSERT_EQ(shapes.size(), expected.size());
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    EXPECT_EQ(shapes[i].getType(), expected[i].getType());
+    EXPECT_EQ(shapes[i].getBox(), expected[i].getBox());
+    EXPECT_EQ(shapes[i].getTechLayer(), expected[i].getTechLayer());
+    EXPECT_EQ(shapes[i].getTechVia(), expected[i].getTechVia());
+  }
+}
+
+TEST_F(OdbMultiPatternedTest, WireSurvivesDatabaseRoundTrip)
+{
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechVia* met1_met2 = tech->findVia("M1M2_PR_MR");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  const int junction = encoder.addPoint(100, 50);
+  encoder.addTechVia(met1_met2);
+  encoder.addPoint(100, 900);
+  encoder.newPath(junction);
+  encoder.addPoint(100, 10);
+  encoder.end();
+
+  auto get_shapes = [](dbWire* wire) {
+    std::vector<dbShape> shapes;
+    dbWireShapeItr itr;
+    dbShape shape;
+    for (itr.begin(wire); itr.next(shape);) {
+      shapes.push_back(shape);
+    }
+    return shapes;
+  };
+  const std::vector<dbShape> shapes = get_shapes(wire);
+
+  std::stringstream stream;
+  db_->write(stream);
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  db->setLogger(&logger_);
+  db->read(stream);
+
+  dbNet* read_net = db->getChip()->getBlock()->findNet("net0");
+  ASSERT_NE(read_net, nullptr);
+  const std::vector<dbShape> read_shapes = get_shapes(read_net->getWire());
+
+  ASSERT_EQ(read_shapes.size(), shapes.size());
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    EXPECT_EQ(read_shapes[i].getBox(), shapes[i].getBox());
+    EXPECT_EQ(read_shapes[i].isVia(), shapes[i].isVia());
+  }
+}
+
 }  // namespace odb
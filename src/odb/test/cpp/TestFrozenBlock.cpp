@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE TestFrozenBlock
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+constexpr int num_insts = 2000;
+constexpr int num_threads = 8;
+
+struct F_FROZEN
+{
+  F_FROZEN()
+  {
+    db = createSimpleDB();
+    block = db->getChip()->getBlock();
+    dbMaster* and2 = db->findMaster("and2");
+    for (int i = 0; i < num_insts; i++) {
+      const std::string idx = std::to_string(i);
+      dbInst* inst = dbInst::create(block, and2, ("inst" + idx).c_str());
+      inst->setLocation(i * 1000, (i % 50) * 2000);
+      inst->setPlacementStatus(dbPlacementStatus::PLACED);
+      dbNet* net = dbNet::create(block, ("net" + idx).c_str());
+      inst->findITerm("o")->connect(net);
+      if (i > 0) {
+        block->findInst(("inst" + std::to_string(i - 1)).c_str())
+            ->findITerm("a")
+            ->connect(net);
+      }
+    }
+  }
+  ~F_FROZEN() { dbDatabase::destroy(db); }
+
+  // A summary of the block that a reader thread can reproduce.
+  int64_t summarize()
+  {
+    int64_t sum = 0;
+    for (dbInst* inst : block->getInsts()) {
+      int x, y;
+      inst->getLocation(x, y);
+      sum += x + y + inst->getITerms().size();
+    }
+    for (dbNet* net : block->getNets()) {
+      for (dbITerm* iterm : net->getITerms()) {
+        sum += iterm->getId();
+      }
+    }
+    for (int i = 0; i < num_insts; i++) {
+      const std::string idx = std::to_string(i);
+      sum += block->findInst(("inst" + idx).c_str())->getId();
+      sum += block->findNet(("net" + idx).c_str())->getId();
+    }
+    sum += block->getBBox()->getBox().area();
+    return sum;
+  }
+
+  dbDatabase* db;
+  dbBlock* block;
+};
+
+BOOST_FIXTURE_TEST_CASE(test_concurrent_readers, F_FROZEN)
+{
+  block->setFrozen(true);
+  BOOST_TEST(block->isFrozen());
+
+  const int64_t expected = summarize();
+  std::vector<int64_t> results(num_threads, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t] {
+      for (int rep = 0; rep < 5; rep++) {
+        results[t] = summarize();
+        if (results[t] != expected) {
+          break;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int64_t result : results) {
+    BOOST_TEST(result == expected);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(test_mutation_while_frozen, F_FROZEN)
+{
+  dbInst* inst = block->findInst("inst0");
+  block->setFrozen(true);
+
+  BOOST_CHECK_THROW(dbNet::create(block, "extra"), std::exception);
+  BOOST_CHECK_THROW(inst->setLocation(5, 5), std::exception);
+  BOOST_CHECK_THROW(inst->findITerm("b")->connect(block->findNet("net1")),
+                    std::exception);
+  BOOST_CHECK_THROW(dbInst::destroy(inst), std::exception);
+  BOOST_CHECK_THROW(inst->rename("renamed"), std::exception);
+  BOOST_CHECK_THROW(block->findNet("net0")->rename("renamed"),
+                    std::exception);
+  BOOST_CHECK_THROW(
+      dbSWire::create(block->findNet("net0"), dbWireType::ROUTED),
+      std::exception);
+  BOOST_TEST(block->findNet("extra") == nullptr);
+  BOOST_TEST(block->findInst("inst0") == inst);
+
+  block->setFrozen(false);
+  BOOST_TEST(!block->isFrozen());
+  BOOST_TEST(dbNet::create(block, "extra") != nullptr);
+  inst->setLocation(5, 5);
+  int x, y;
+  inst->getLocation(x, y);
+  BOOST_TEST(x == 5);
+  BOOST_TEST(y == 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
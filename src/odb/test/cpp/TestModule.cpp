@@ -1,6 +1,7 @@
 #define BOOST_TEST_MODULE TestModule
 #include <boost/test/included/unit_test.hpp>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "helper.h"
@@ -297,6 +298,61 @@ BOOST_FIXTURE_TEST_CASE(test_find_modinst, F_DEFAULT)
   auto minst2 = odb::dbModInst::create(master1, master2, "minst2");
   BOOST_TEST(block->findModInst("minst1/minst2") == minst2);
 }
+BOOST_FIXTURE_TEST_CASE(test_find_hierarchical_names, F_DEFAULT)
+{
+  auto top = block->getTopModule();
+  auto master1 = odb::dbModule::create(block, "master1");
+  auto minst1 = odb::dbModInst::create(top, master1, "minst1");
+  auto master2 = odb::dbModule::create(block, "master2");
+  auto minst2 = odb::dbModInst::create(master1, master2, "minst2");
+  auto and2 = lib->findMaster("and2");
+  auto inst1 = dbInst::create(block, and2, "minst1/inst1");
+  auto inst2 = dbInst::create(block, and2, "minst1/minst2/inst2");
+  auto net2 = dbNet::create(block, "minst1/minst2/net2");
+  BOOST_TEST(block->findInst(minst1, "inst1") == inst1);
+  BOOST_TEST(block->findInst(minst2, "inst2") == inst2);
+  BOOST_TEST(block->findInst(minst1, "inst2") == nullptr);
+  BOOST_TEST(block->findInst(minst2, "inst") == nullptr);
+  BOOST_TEST(block->findNet(minst2, "net2") == net2);
+  BOOST_TEST(block->findNet(minst1, "net2") == nullptr);
+  // Renamed and destroyed objects are no longer found by their old names.
+  BOOST_TEST(inst2->rename("minst1/minst2/inst3"));
+  BOOST_TEST(block->findInst("minst1/minst2/inst2") == nullptr);
+  BOOST_TEST(block->findInst(minst2, "inst3") == inst2);
+  dbInst::destroy(inst1);
+  BOOST_TEST(block->findInst("minst1/inst1") == nullptr);
+  BOOST_TEST(block->findInst("minst1/minst2/inst3") == inst2);
+}
+BOOST_FIXTURE_TEST_CASE(test_name_arena_reuse, F_DEFAULT)
+{
+  auto and2 = lib->findMaster("and2");
+  auto inst1 = dbInst::create(block, and2, "inst1");
+  auto net1 = dbNet::create(block, "net1");
+  // The space of a replaced name is reused by the next name of its size.
+  const char* name1 = inst1->getConstName();
+  BOOST_TEST(inst1->rename("inst2"));
+  BOOST_TEST(inst1->getConstName() == name1);
+  const char* net_name1 = net1->getConstName();
+  dbNet::destroy(net1);
+  auto net2 = dbNet::create(block, "net2");
+  BOOST_TEST(net2->getConstName() == net_name1);
+  BOOST_TEST(std::string(net2->getName()) == "net2");
+  BOOST_TEST(block->findInst("inst1") == nullptr);
+  BOOST_TEST(block->findInst("inst2") == inst1);
+  BOOST_TEST(block->findNet("net1") == nullptr);
+  BOOST_TEST(block->findNet("net2") == net2);
+
+  // The name indexes are rebuilt when the block is read.
+  std::stringstream stream;
+  db->write(stream);
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(stream);
+  dbBlock* block2 = db2->getChip()->getBlock();
+  BOOST_TEST(block2->findInst("inst2") != nullptr);
+  BOOST_TEST(block2->findNet("net2") != nullptr);
+  BOOST_TEST(block2->findNet("net1") == nullptr);
+  dbDatabase::destroy(db2);
+}
 struct F_DETAILED
 {
   F_DETAILED()
@@ -30,6 +30,8 @@ record_tests {
   check_routing_tracks
   polygon
   def_parser
+  def_parser_threads
+  write_def_threads
   ndr
   gcd_abstract_lef
   gcd_abstract_lef_with_power
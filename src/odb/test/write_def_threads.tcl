@@ -0,0 +1,25 @@
+# Writing a DEF with threads, plain or gzipped, matches the serial writer
+source "helpers.tcl"
+
+read_lef "data/Nangate45/NangateOpenCellLibrary.mod.lef"
+read_def "data/gcd/gcd_nangate45_route.def"
+
+set serial_def [make_result_file write_def_threads_serial.def]
+write_def $serial_def
+
+set_thread_count 4
+
+set threads_def [make_result_file write_def_threads.def]
+write_def $threads_def
+diff_files $serial_def $threads_def
+
+set gzip_def [make_result_file write_def_threads.def.gz]
+write_def $gzip_def
+set stream [open $gzip_def rb]
+zlib push gunzip $stream
+set unzipped_def [make_result_file write_def_threads_unzipped.def]
+set out [open $unzipped_def w]
+puts -nonewline $out [read $stream]
+close $stream
+close $out
+diff_files $serial_def $unzipped_def
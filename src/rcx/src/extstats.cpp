@@ -165,9 +165,9 @@ uint extMain::getExtStats(odb::dbNet* net,
     return 0;
   }
 
-  odb::dbWireShapeItr shapes;
-  odb::dbShape s;
-  for (shapes.begin(wire); shapes.next(s);) {
+  std::vector<odb::dbShape> shapes;
+  wire->getShapes(shapes);
+  for (const odb::dbShape& s : shapes) {
     if (s.isVia()) {
       via_cnt++;
 
@@ -38,6 +38,7 @@
 #include <array>
 #include <optional>
 #include <string>
+#include <unordered_map>
 
 #include "db_sta/dbSta.hh"
 #include "dpl/Opendp.h"
@@ -166,6 +167,19 @@ struct ParasiticsCapacitance
   double v_cap;
 };
 
+// Reduced parasitic of a driver saved before a virtual repair scales it.
+struct SavedPiElmore
+{
+  const Pin* drvr_pin;
+  const RiseFall* rf;
+  const ParasiticAnalysisPt* ap;
+  float c2;
+  float rpi;
+  float c1;
+  // (load pin, elmore delay)
+  std::vector<std::pair<const Pin*, float>> elmores;
+};
+
 struct BufferData
 {
   // Need to use strings because object pointers may not be persistent after
@@ -381,9 +395,15 @@ class Resizer : public dbStaState
   //  save slacks
   //  remove inserted buffers
   //  restore resized gates
+  // In virtual mode repair design is replaced by scaling the parasitics
+  // of long wires as if they were buffered, so the netlist is not touched.
   // resizeSlackPreamble must be called before the first findResizeSlacks.
   void resizeSlackPreamble();
   void findResizeSlacks();
+  void setVirtualResizeSlacks(bool virtual_repair);
+  // Nets whose pins moved less than distance (meters) since the last
+  // findResizeSlacks keep their parasitics in virtual mode.
+  void setResizeSlacksReuseDistance(double distance);
   // Return nets with worst slack.
   NetSeq& resizeWorstSlackNets();
   // Return net slack, if any (indicated by the bool).
@@ -577,9 +597,17 @@ class Resizer : public dbStaState
   void updateParasitics(bool save_guides = false);
   void ensureWireParasitic(const Pin* drvr_pin);
   void ensureWireParasitic(const Pin* drvr_pin, const Net* net);
+  void estimateWireParasiticsParallel(int thread_count,
+                                      SpefWriter* spef_writer);
+  bool needsWireParasitic(const Pin* drvr_pin, const Net* net);
   void estimateWireParasiticSteiner(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer);
+  void makeWireParasitic(const Net* net,
+                         SteinerTree* tree,
+                         SpefWriter* spef_writer,
+                         double res_scale = 1.0,
+                         double cap_scale = 1.0);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -600,6 +628,16 @@ class Resizer : public dbStaState
                    bool journal);
 
   void findResizeSlacks1();
+  void findResizeSlacksVirtual();
+  void updateResizeSlackParasitics();
+  int virtualBufferLongWires(NetSeq& unsaved_nets,
+                             VertexSeq& annotated_loads,
+                             std::vector<SavedPiElmore>& saved_parasitics);
+  bool saveReducedParasitics(Vertex* drvr,
+                             std::vector<SavedPiElmore>& saved_parasitics);
+  void restoreVirtualRepair(const NetSeq& unsaved_nets,
+                            const VertexSeq& annotated_loads,
+                            const std::vector<SavedPiElmore>& saved_parasitics);
   bool removeBuffer(Instance* buffer,
                     bool honorDontTouchFixed = true,
                     bool recordJournal = false);
@@ -730,6 +768,10 @@ class Resizer : public dbStaState
   // drive cell (because larger ones would give us a longer length).
   float max_wire_length_ = 0;
   float worst_slack_nets_percent_ = 10;
+  bool virtual_resize_slacks_ = false;
+  double resize_slacks_reuse_distance_ = 0.0;  // meters
+  // Pin bounding box of each net when its parasitics were last estimated.
+  std::unordered_map<const Net*, Rect> resize_slack_net_bboxes_;
   Map<const Net*, Slack> net_slack_map_;
   NetSeq worst_slack_nets_;
 
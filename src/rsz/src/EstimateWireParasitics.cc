@@ -407,18 +407,74 @@ void Resizer::estimateWireParasitics(SpefWriter* spef_writer)
     // Make separate parasitics for each corner, same for min/max.
     sta_->setParasiticAnalysisPts(true);
 
-    NetIterator* net_iter = network_->netIterator(network_->topInstance());
-    while (net_iter->hasNext()) {
-      Net* net = net_iter->next();
-      estimateWireParasitic(net, spef_writer);
+    const int thread_count = sta_->threadCount();
+    if (thread_count > 1 && !logger_->debugCheck(RSZ, "steiner", 1)) {
+      estimateWireParasiticsParallel(thread_count, spef_writer);
+    } else {
+      NetIterator* net_iter = network_->netIterator(network_->topInstance());
+      while (net_iter->hasNext()) {
+        Net* net = net_iter->next();
+        estimateWireParasitic(net, spef_writer);
+      }
+      delete net_iter;
     }
-    delete net_iter;
 
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
   }
 }
 
+// The Steiner trees are built on worker threads a batch of nets at a time.
+// The STA parasitics are not thread safe so they are made from the trees
+// in net order on the calling thread, matching the serial results.
+void Resizer::estimateWireParasiticsParallel(int thread_count,
+                                             SpefWriter* spef_writer)
+{
+  struct NetDriver
+  {
+    const Pin* drvr_pin;
+    const Net* net;
+    bool is_pad;
+  };
+  std::vector<NetDriver> nets;
+  NetIterator* net_iter = network_->netIterator(network_->topInstance());
+  while (net_iter->hasNext()) {
+    Net* net = net_iter->next();
+    PinSet* drivers = network_->drivers(net);
+    if (drivers && !drivers->empty()) {
+      PinSet::Iterator drvr_iter(drivers);
+      const Pin* drvr_pin = drvr_iter.next();
+      if (needsWireParasitic(drvr_pin, net)) {
+        nets.push_back({drvr_pin, net, isPadNet(net)});
+      }
+    }
+  }
+  delete net_iter;
+
+  // Bounds the number of trees held in memory at once.
+  const int batch_size = 1024 * thread_count;
+  std::vector<SteinerTree*> trees;
+  for (int begin = 0; begin < nets.size(); begin += batch_size) {
+    const int end = std::min(begin + batch_size, (int) nets.size());
+    trees.assign(end - begin, nullptr);
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 64)
+    for (int i = begin; i < end; i++) {
+      if (!nets[i].is_pad) {
+        trees[i - begin] = makeSteinerTree(nets[i].drvr_pin);
+      }
+    }
+
+    for (int i = begin; i < end; i++) {
+      const NetDriver& net = nets[i];
+      if (net.is_pad) {
+        makePadParasitic(net.net, spef_writer);
+      } else if (trees[i - begin]) {
+        makeWireParasitic(net.net, trees[i - begin], spef_writer);
+      }
+    }
+  }
+}
+
 void Resizer::estimateWireParasitic(const Net* net, SpefWriter* spef_writer)
 {
   PinSet* drivers = network_->drivers(net);
@@ -433,9 +489,7 @@ void Resizer::estimateWireParasitic(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer)
 {
-  if (!network_->isPower(net) && !network_->isGround(net)
-      && !sta_->isIdealClock(drvr_pin)
-      && !db_network_->staToDb(net)->isSpecial()) {
+  if (needsWireParasitic(drvr_pin, net)) {
     if (isPadNet(net)) {
       // When an input port drives a pad instance with huge input
       // cap the elmore delay is gigantic. Annotate with zero
@@ -447,6 +501,13 @@ void Resizer::estimateWireParasitic(const Pin* drvr_pin,
   }
 }
 
+bool Resizer::needsWireParasitic(const Pin* drvr_pin, const Net* net)
+{
+  return !network_->isPower(net) && !network_->isGround(net)
+         && !sta_->isIdealClock(drvr_pin)
+         && !db_network_->staToDb(net)->isSpecial();
+}
+
 bool Resizer::isPadNet(const Net* net) const
 {
   const Pin *pin1, *pin2;
@@ -487,89 +548,100 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin,
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    makeWireParasitic(net, tree, spef_writer);
+  }
+}
+
+// Takes ownership of tree.
+// res_scale and cap_scale multiply the wire resistance and capacitance.
+void Resizer::makeWireParasitic(const Net* net,
+                                SteinerTree* tree,
+                                SpefWriter* spef_writer,
+                                double res_scale,
+                                double cap_scale)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      if (spef_writer) {
-        spef_writer->writeNet(corner, net, parasitic);
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap * cap_scale;
+        double res = length * wire_res * res_scale;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    if (spef_writer) {
+      spef_writer->writeNet(corner, net, parasitic);
+    }
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
+  delete tree;
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
@@ -51,6 +51,7 @@
 #include "sta/Search.hh"
 #include "sta/SearchPred.hh"
 #include "sta/Units.hh"
+#include "utl/Tracer.h"
 
 namespace rsz {
 
@@ -93,6 +94,7 @@ void RepairDesign::repairDesign(double max_wire_length,
                                 double buffer_gain,
                                 bool verbose)
 {
+  utl::TraceZone zone("rsz.repair_design");
   init();
   int repaired_net_count, slew_violations, cap_violations;
   int fanout_violations, length_violations;
@@ -198,17 +200,21 @@ void RepairDesign::repairDesign(
     printProgress(print_iteration, false, false, repaired_net_count);
   }
   int max_length = resizer_->metersToDbu(max_wire_length);
+  const int thread_count = sta_->threadCount();
+  const bool plan_nets
+      = thread_count > 1 && !logger_->debugCheck(RSZ, "steiner", 1);
+  int planned_first = resizer_->level_drvr_vertices_.size();
   for (int i = resizer_->level_drvr_vertices_.size() - 1; i >= 0; i--) {
     print_iteration++;
     if (verbose) {
       printProgress(print_iteration, false, false, repaired_net_count);
     }
+    if (plan_nets && i < planned_first) {
+      planned_first = planRepairs(i, thread_count);
+    }
     Vertex* drvr = resizer_->level_drvr_vertices_[i];
     Pin* drvr_pin = drvr->pin();
-    Net* net = network_->isTopLevelPort(drvr_pin)
-                   ? network_->net(network_->term(drvr_pin))
-                   : network_->net(drvr_pin);
-    dbNet* net_db = db_network_->staToDb(net);
+    Net* net = repairableNet(drvr);
     bool debug = (drvr_pin == resizer_->debug_pin_);
     if (debug) {
       logger_->setDebugLevel(RSZ, "repair_net", 3);
@@ -216,10 +222,7 @@ void RepairDesign::repairDesign(
     if (gain_buffering) {
       search_->findRequireds(drvr->level() + 1);
     }
-    if (net && !resizer_->dontTouch(net) && !net_db->isConnectedByAbutment()
-        && !sta_->isClock(drvr_pin)
-        // Exclude tie hi/low cells and supply nets.
-        && !drvr->isConstant()) {
+    if (net) {
       repairNet(net,
                 drvr_pin,
                 drvr,
@@ -250,6 +253,7 @@ void RepairDesign::repairDesign(
       }
     }
   }
+  planned_nets_.clear();
   resizer_->updateParasitics();
   if (verbose) {
     printProgress(print_iteration, true, true, repaired_net_count);
@@ -261,6 +265,112 @@ void RepairDesign::repairDesign(
   }
 }
 
+// Return the net of drvr if it is a candidate for repair.
+Net* RepairDesign::repairableNet(Vertex* drvr)
+{
+  Pin* drvr_pin = drvr->pin();
+  Net* net = network_->isTopLevelPort(drvr_pin)
+                 ? network_->net(network_->term(drvr_pin))
+                 : network_->net(drvr_pin);
+  if (net && !resizer_->dontTouch(net)
+      && !db_network_->staToDb(net)->isConnectedByAbutment()
+      && !sta_->isClock(drvr_pin)
+      // Exclude tie hi/low cells and supply nets.
+      && !drvr->isConstant()) {
+    return net;
+  }
+  return nullptr;
+}
+
+// Build the buffered nets for the drivers at the level of driver index
+// last on worker threads. Drivers at the same level do not drive each
+// other so repairing one does not change the others' nets, except for
+// the rare load that is resized (a register driven at the level of its
+// output). Planned nets are checked against the net pins when they are
+// used and rebuilt if the net changed, so the repairs match the serial
+// ones. Returns the index of the first driver planned.
+int RepairDesign::planRepairs(int last, int thread_count)
+{
+  const vector<Vertex*>& drvrs = resizer_->level_drvr_vertices_;
+  // Bounds the number of buffered nets held in memory at once.
+  const int max_count = 1024 * thread_count;
+  const sta::Level level = drvrs[last]->level();
+  int first = last;
+  while (first > 0 && last - first + 1 < max_count
+         && drvrs[first - 1]->level() == level) {
+    first--;
+  }
+
+  vector<const Pin*> drvr_pins;
+  for (int i = first; i <= last; i++) {
+    Vertex* drvr = drvrs[i];
+    Net* net = repairableNet(drvr);
+    if (net && !db_network_->isSpecial(net)
+        && !resizer_->isTristateDriver(drvr->pin())) {
+      drvr_pins.push_back(drvr->pin());
+    }
+  }
+
+  const Corner* corner = sta_->cmdCorner();
+  vector<PlannedNet> plans(drvr_pins.size());
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 16)
+  for (int i = 0; i < drvr_pins.size(); i++) {
+    plans[i].bnet = resizer_->makeBufferedNetSteiner(drvr_pins[i], corner);
+    plannedNetPins(drvr_pins[i], plans[i].pins);
+  }
+
+  planned_nets_.clear();
+  for (int i = 0; i < drvr_pins.size(); i++) {
+    planned_nets_[drvr_pins[i]] = std::move(plans[i]);
+  }
+  debugPrint(logger_,
+             RSZ,
+             "repair_net",
+             2,
+             "planned {} nets at level {}",
+             drvr_pins.size(),
+             level);
+  return first;
+}
+
+void RepairDesign::plannedNetPins(const Pin* drvr_pin,
+                                  vector<PlannedNet::NetPin>& pins)
+{
+  const Net* net = network_->isTopLevelPort(drvr_pin)
+                       ? network_->net(network_->term(drvr_pin))
+                       : network_->net(drvr_pin);
+  NetConnectedPinIterator* pin_iter = network_->connectedPinIterator(net);
+  while (pin_iter->hasNext()) {
+    const Pin* pin = pin_iter->next();
+    pins.push_back(
+        {pin, db_network_->location(pin), network_->libertyPort(pin)});
+  }
+  delete pin_iter;
+}
+
+// Use the planned buffered net for drvr_pin if its net is unchanged.
+BufferedNetPtr RepairDesign::makePlannedBufferedNet(const Pin* drvr_pin,
+                                                    const Corner* corner)
+{
+  auto plan_iter = planned_nets_.find(drvr_pin);
+  if (plan_iter != planned_nets_.end()) {
+    PlannedNet plan = std::move(plan_iter->second);
+    planned_nets_.erase(plan_iter);
+    vector<PlannedNet::NetPin> pins;
+    plannedNetPins(drvr_pin, pins);
+    if (pins == plan.pins) {
+      return plan.bnet;
+    }
+    debugPrint(logger_,
+               RSZ,
+               "repair_net",
+               2,
+               "net of {} changed since planned",
+               sdc_network_->pathName(drvr_pin));
+  }
+  return resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+}
+
 // Repair long wires from clock input pins to clock tree root buffer
 // because CTS ignores the issue.
 // no max_fanout/max_cap checks.
@@ -711,7 +821,7 @@ void RepairDesign::repairNet(Net* net,
     }
     // For tristate nets all we can do is resize the driver.
     if (!resizer_->isTristateDriver(drvr_pin)) {
-      BufferedNetPtr bnet = resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+      BufferedNetPtr bnet = makePlannedBufferedNet(drvr_pin, corner);
       if (bnet) {
         resizer_->ensureWireParasitic(drvr_pin, net);
         graph_delay_calc_->findDelays(drvr);
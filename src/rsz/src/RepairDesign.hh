@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "BufferedNet.hh"
 #include "PreChecks.hh"
 #include "db_sta/dbSta.hh"
@@ -80,6 +82,24 @@ class LoadRegion
   vector<LoadRegion> regions_;
 };
 
+// Buffered net planned ahead of its repair from the net pins at the time.
+struct PlannedNet
+{
+  struct NetPin
+  {
+    const Pin* pin;
+    Point loc;
+    LibertyPort* port;
+    bool operator==(const NetPin& other) const
+    {
+      return pin == other.pin && loc == other.loc && port == other.port;
+    }
+  };
+
+  BufferedNetPtr bnet;
+  vector<NetPin> pins;
+};
+
 class RepairDesign : dbStaState
 {
  public:
@@ -239,10 +259,16 @@ class RepairDesign : dbStaState
                     Pin*& repeater_in_pin,
                     Pin*& repeater_out_pin);
   LibertyCell* findBufferUnderSlew(float max_slew, float load_cap);
+  Net* repairableNet(Vertex* drvr);
+  int planRepairs(int last, int thread_count);
+  BufferedNetPtr makePlannedBufferedNet(const Pin* drvr_pin,
+                                        const Corner* corner);
   bool hasInputPort(const Net* net);
   double dbuToMeters(int dist) const;
   int metersToDbu(double dist) const;
 
+  void plannedNetPins(const Pin* drvr_pin, vector<PlannedNet::NetPin>& pins);
+
   void printProgress(int iteration,
                      bool force,
                      bool end,
@@ -267,6 +293,10 @@ class RepairDesign : dbStaState
   double buffer_gain_ = 0;
   const Corner* corner_ = nullptr;
 
+  // Buffered nets of the driver level being repaired, built on worker
+  // threads by planRepairs.
+  std::unordered_map<const Pin*, PlannedNet> planned_nets_;
+
   int resize_count_ = 0;
   int inserted_buffer_count_ = 0;
   const MinMax* min_ = MinMax::min();
@@ -55,6 +55,7 @@
 #include "sta/TimingArc.hh"
 #include "sta/Units.hh"
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
 
 namespace rsz {
 
@@ -92,6 +93,7 @@ void RepairHold::repairHold(
     const int max_passes,
     const bool verbose)
 {
+  utl::TraceZone zone("rsz.repair_hold");
   init();
   sta_->checkSlewLimitPreamble();
   sta_->checkCapacitanceLimitPreamble();
@@ -54,6 +54,7 @@
 #include "sta/TimingArc.hh"
 #include "sta/Units.hh"
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
 
 namespace rsz {
 
@@ -95,6 +96,7 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                               const bool skip_buffering,
                               const bool skip_buffer_removal)
 {
+  utl::TraceZone zone("rsz.repair_setup");
   init();
   constexpr int digits = 3;
   inserted_buffer_count_ = 0;
@@ -478,6 +480,7 @@ bool RepairSetup::repairPath(PathRef& path,
                              const bool skip_buffer_removal,
                              const float setup_slack_margin)
 {
+  utl::TraceZone zone("rsz.repair_path");
   PathExpanded expanded(&path, sta_);
   bool changed = false;
 
@@ -35,6 +35,7 @@
 
 #include "rsz/Resizer.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <optional>
@@ -1254,12 +1255,27 @@ void Resizer::resizeSlackPreamble()
   resizePreamble();
   // Save max_wire_length for multiple repairDesign calls.
   max_wire_length_ = findMaxWireLength1();
+  resize_slack_net_bboxes_.clear();
+}
+
+void Resizer::setVirtualResizeSlacks(bool virtual_repair)
+{
+  virtual_resize_slacks_ = virtual_repair;
+}
+
+void Resizer::setResizeSlacksReuseDistance(double distance)
+{
+  resize_slacks_reuse_distance_ = distance;
 }
 
 // Run repair_design to repair long wires and max slew, capacitance and fanout
 // violations. Find the slacks, and then undo all changes to the netlist.
 void Resizer::findResizeSlacks()
 {
+  if (virtual_resize_slacks_) {
+    findResizeSlacksVirtual();
+    return;
+  }
   journalBegin();
   estimateWireParasitics();
   int repaired_net_count, slew_violations, cap_violations;
@@ -1281,6 +1297,239 @@ void Resizer::findResizeSlacks()
                  removed_buffer_count_);
 }
 
+// Estimate the slacks repair_design would leave without changing the
+// netlist. Wires longer than max_wire_length_ get parasitics scaled to
+// look like a buffered wire. The reduced parasitics and load slews they
+// replace are saved first and put back once the slacks are found.
+void Resizer::findResizeSlacksVirtual()
+{
+  initBlock();
+  ensureLevelDrvrVertices();
+  updateResizeSlackParasitics();
+
+  NetSeq unsaved_nets;
+  VertexSeq annotated_loads;
+  std::vector<SavedPiElmore> saved_parasitics;
+  const int buffered_count = virtualBufferLongWires(
+      unsaved_nets, annotated_loads, saved_parasitics);
+  debugPrint(logger_,
+             RSZ,
+             "resize_slacks",
+             1,
+             "virtually buffered {} nets",
+             buffered_count);
+  findResizeSlacks1();
+  if (buffered_count > 0) {
+    restoreVirtualRepair(unsaved_nets, annotated_loads, saved_parasitics);
+  }
+}
+
+void Resizer::restoreVirtualRepair(
+    const NetSeq& unsaved_nets,
+    const VertexSeq& annotated_loads,
+    const std::vector<SavedPiElmore>& saved_parasitics)
+{
+  for (Vertex* load : annotated_loads) {
+    for (auto mm : sta::MinMaxAll::all()->range()) {
+      const DcalcAnalysisPt* dcalc_ap
+          = tgt_slew_corner_->findDcalcAnalysisPt(mm);
+      for (auto rf : sta::RiseFallBoth::riseFall()->range()) {
+        load->setSlewAnnotated(false, rf, dcalc_ap->index());
+      }
+    }
+  }
+  for (const SavedPiElmore& saved : saved_parasitics) {
+    Parasitic* pi_elmore = parasitics_->makePiElmore(
+        saved.drvr_pin, saved.rf, saved.ap, saved.c2, saved.rpi, saved.c1);
+    for (const auto& [load_pin, elmore] : saved.elmores) {
+      parasitics_->setElmore(pi_elmore, load_pin, elmore);
+    }
+  }
+  // Parasitics that could not be saved are estimated again at the
+  // current placement, which is also what they are now reused from.
+  for (const Net* net : unsaved_nets) {
+    estimateWireParasitic(net);
+    resize_slack_net_bboxes_[net] = db_network_->staToDb(net)->getTermBBox();
+  }
+  // The parasitics were changed behind the delay calculator's back.
+  graph_delay_calc_->delaysInvalid();
+  search_->arrivalsInvalid();
+}
+
+// Only re-estimate the nets whose pins moved farther than
+// resize_slacks_reuse_distance_ since their parasitics were made.
+void Resizer::updateResizeSlackParasitics()
+{
+  const bool reuse = parasitics_src_ == ParasiticsSrc::placement
+                     && !resize_slack_net_bboxes_.empty();
+  const int reuse_dist = metersToDbu(resize_slacks_reuse_distance_);
+  int reused_count = 0;
+  NetIterator* net_iter = network_->netIterator(network_->topInstance());
+  while (net_iter->hasNext()) {
+    const Net* net = net_iter->next();
+    const Rect bbox = db_network_->staToDb(net)->getTermBBox();
+    auto [itr, inserted] = resize_slack_net_bboxes_.emplace(net, bbox);
+    if (!inserted) {
+      const Rect& prev = itr->second;
+      const int moved = std::max({std::abs(bbox.xMin() - prev.xMin()),
+                                  std::abs(bbox.yMin() - prev.yMin()),
+                                  std::abs(bbox.xMax() - prev.xMax()),
+                                  std::abs(bbox.yMax() - prev.yMax())});
+      if (moved <= reuse_dist) {
+        reused_count++;
+        continue;
+      }
+      itr->second = bbox;
+    }
+    if (reuse) {
+      parasiticsInvalid(net);
+    }
+  }
+  delete net_iter;
+
+  if (reuse) {
+    debugPrint(logger_,
+               RSZ,
+               "resize_slacks",
+               1,
+               "reused parasitics for {} nets",
+               reused_count);
+    updateParasitics();
+  } else {
+    estimateWireParasitics();
+  }
+}
+
+// A wire of length L split by buffers every Lmax has the delay
+//   L / Lmax * (d_buf + r * c * Lmax^2 / 2)
+// and its driver only sees the capacitance of the first segment. The
+// Elmore delay of the unbuffered wire is r * c * L^2 / 2, so scaling
+// the capacitance by Lmax / L and the resistance by
+//   1 + 2 * d_buf / (r * c * Lmax^2)
+// gives the buffered delay at the far end. The loads are annotated with
+// the target slew because a buffer drives them.
+//
+// Returns the number of wires buffered. Their previous reduced parasitics
+// go to saved_parasitics, or their net to unsaved_nets if they are not
+// pi/elmore models.
+int Resizer::virtualBufferLongWires(NetSeq& unsaved_nets,
+                                    VertexSeq& annotated_loads,
+                                    std::vector<SavedPiElmore>& saved_parasitics)
+{
+  if (max_wire_length_ <= 0.0 || buffer_lowest_drive_ == nullptr
+      || wire_signal_cap_.empty()) {
+    return 0;
+  }
+  const double wire_res = wireSignalResistance(tgt_slew_corner_);
+  const double wire_cap = wireSignalCapacitance(tgt_slew_corner_);
+  if (wire_res <= 0.0 || wire_cap <= 0.0) {
+    return 0;
+  }
+  LibertyPort *input, *output;
+  buffer_lowest_drive_->bufferPorts(input, output);
+  const double segment_cap = wire_cap * max_wire_length_;
+  const double buffer_delay
+      = bufferDelay(buffer_lowest_drive_,
+                    segment_cap + input->capacitance(),
+                    tgt_slew_dcalc_ap_);
+  const double res_scale
+      = 1.0 + 2.0 * buffer_delay / (wire_res * segment_cap * max_wire_length_);
+
+  const int max_length = metersToDbu(max_wire_length_);
+  int buffered_count = 0;
+  for (Vertex* drvr : level_drvr_vertices_) {
+    const Pin* drvr_pin = drvr->pin();
+    const Net* net = network_->isTopLevelPort(drvr_pin)
+                         ? network_->net(network_->term(drvr_pin))
+                         : network_->net(drvr_pin);
+    if (net == nullptr || drvr->isConstant() || sta_->isClock(drvr_pin)
+        || !needsWireParasitic(drvr_pin, net) || isPadNet(net)) {
+      continue;
+    }
+    const int length = maxLoadManhattenDistance(drvr);
+    if (length <= max_length) {
+      continue;
+    }
+    SteinerTree* tree = makeSteinerTree(drvr_pin);
+    if (tree == nullptr) {
+      continue;
+    }
+    if (!saveReducedParasitics(drvr, saved_parasitics)) {
+      unsaved_nets.emplace_back(net);
+    }
+    const double cap_scale = static_cast<double>(max_length) / length;
+    makeWireParasitic(net, tree, nullptr, res_scale, cap_scale);
+    buffered_count++;
+
+    VertexOutEdgeIterator edge_iter(drvr, graph_);
+    while (edge_iter.hasNext()) {
+      Vertex* load = edge_iter.next()->to(graph_);
+      bool user_annotated = false;
+      for (auto rf : {RiseFall::rise(), RiseFall::fall()}) {
+        user_annotated |= load->slewAnnotated(rf, min_)
+                          || load->slewAnnotated(rf, max_);
+      }
+      if (!user_annotated) {
+        for (auto rf : {RiseFall::rise(), RiseFall::fall()}) {
+          sta_->setAnnotatedSlew(load,
+                                 tgt_slew_corner_,
+                                 sta::MinMaxAll::all(),
+                                 rf->asRiseFallBoth(),
+                                 tgt_slews_[rf->index()]);
+        }
+        annotated_loads.emplace_back(load);
+      }
+    }
+  }
+  return buffered_count;
+}
+
+// Saves the pi/elmore parasitics of every analysis point for drvr.
+// Returns false and saves nothing if any of them is missing.
+bool Resizer::saveReducedParasitics(Vertex* drvr,
+                                    std::vector<SavedPiElmore>& saved_parasitics)
+{
+  const Pin* drvr_pin = drvr->pin();
+  std::vector<const ParasiticAnalysisPt*> parasitic_aps;
+  for (Corner* corner : *sta_->corners()) {
+    for (auto mm : sta::MinMaxAll::all()->range()) {
+      const ParasiticAnalysisPt* ap = corner->findParasiticAnalysisPt(mm);
+      if (std::find(parasitic_aps.begin(), parasitic_aps.end(), ap)
+          == parasitic_aps.end()) {
+        parasitic_aps.push_back(ap);
+      }
+    }
+  }
+
+  const size_t saved_count = saved_parasitics.size();
+  for (const ParasiticAnalysisPt* ap : parasitic_aps) {
+    for (auto rf : sta::RiseFallBoth::riseFall()->range()) {
+      Parasitic* pi_elmore = parasitics_->findPiElmore(drvr_pin, rf, ap);
+      if (pi_elmore == nullptr) {
+        saved_parasitics.resize(saved_count);
+        return false;
+      }
+      SavedPiElmore saved;
+      saved.drvr_pin = drvr_pin;
+      saved.rf = rf;
+      saved.ap = ap;
+      parasitics_->piModel(pi_elmore, saved.c2, saved.rpi, saved.c1);
+      VertexOutEdgeIterator edge_iter(drvr, graph_);
+      while (edge_iter.hasNext()) {
+        const Pin* load_pin = edge_iter.next()->to(graph_)->pin();
+        float elmore;
+        bool exists;
+        parasitics_->findElmore(pi_elmore, load_pin, elmore, exists);
+        if (exists) {
+          saved.elmores.emplace_back(load_pin, elmore);
+        }
+      }
+      saved_parasitics.push_back(std::move(saved));
+    }
+  }
+  return true;
+}
+
 void Resizer::findResizeSlacks1()
 {
   // Use driver pin slacks rather than Sta::netSlack to save visiting
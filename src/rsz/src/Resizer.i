@@ -806,6 +806,20 @@ set_worst_slack_nets_percent(float percent)
   resizer->setWorstSlackNetsPercent(percent);
 }
 
+void
+set_virtual_resize_slacks(bool virtual_repair)
+{
+  Resizer *resizer = getResizer();
+  resizer->setVirtualResizeSlacks(virtual_repair);
+}
+
+void
+set_resize_slacks_reuse_distance(double distance)
+{
+  Resizer *resizer = getResizer();
+  resizer->setResizeSlacksReuseDistance(distance);
+}
+
 } // namespace
 
 %} // inline
@@ -0,0 +1,20 @@
+# estimate_parasitics -placement with threads matches the serial estimate
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def gcd_nangate45_placed.def
+read_sdc gcd_nangate45.sdc
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+
+set serial_spef [make_result_file make_parasitics7_serial.spef]
+estimate_parasitics -placement -spef_file $serial_spef
+report_worst_slack
+
+set_thread_count 2
+set parallel_spef [make_result_file make_parasitics7_parallel.spef]
+estimate_parasitics -placement -spef_file $parallel_spef
+report_worst_slack
+
+diff_files $serial_spef $parallel_spef
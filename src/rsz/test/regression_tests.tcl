@@ -19,6 +19,7 @@ record_tests {
   make_parasitics4
   make_parasitics5
   make_parasitics6
+  make_parasitics7
   pin_swap1
   resize1
   resize4
@@ -27,6 +28,7 @@ record_tests {
   resize_slack1
   resize_slack2
   resize_slack3
+  resize_slack4
   remove_buffers1
   remove_buffers2
   remove_buffers3
@@ -40,6 +42,7 @@ record_tests {
   repair_design3
   repair_design4
   repair_design5
+  repair_design6
   repair_fanout1
   repair_fanout2
   repair_fanout3
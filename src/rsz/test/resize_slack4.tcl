@@ -0,0 +1,26 @@
+# virtual resize slacks restore the parasitics and slews they change
+# in1--u1--u2--------u3-out1
+#             2000u
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_wire1.def
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+# zero estimated parasitics to output port
+set_load 0 [get_net out1]
+
+report_checks -unconstrained -fields {input slew cap} -digits 3 -rise_to out1
+
+rsz::set_virtual_resize_slacks 1
+rsz::resize_slack_preamble
+rsz::find_resize_slacks
+report_checks -unconstrained -fields {input slew cap} -digits 3 -rise_to out1
+
+# second pass reuses the parasitics of nets that did not move
+rsz::set_resize_slacks_reuse_distance 1e-6
+rsz::find_resize_slacks
+report_checks -unconstrained -fields {input slew cap} -digits 3 -rise_to out1
@@ -33,12 +33,14 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 
 // Use flute LUT file reader.
@@ -215,7 +217,10 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+// Trees may be built from several threads so the tables are filled in
+// under lut_mutex and published through lut_valid_d.
+static std::atomic<int> lut_valid_d = 0;
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -231,6 +236,7 @@ static void readLUT()
 #elif LUT_SOURCE == LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
   initLUT(lut_initial_d, LUT, numsoln);
+  lut_valid_d = lut_initial_d;
 
 #elif LUT_SOURCE == LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
@@ -240,6 +246,7 @@ static void readLUT()
   makeLUT(LUT_, numsoln_);
   initLUT(FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
+  lut_valid_d = FLUTE_D;
 #endif
 }
 
@@ -373,16 +380,30 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
       }
     }
   }
-  lut_valid_d = to_d;
 }
 
 static void ensureLUT(int d)
 {
+  if (lut_valid_d >= std::min(d, FLUTE_D)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }
   if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+    // Other threads may be using the lower degree tables so the new ones
+    // are built on the side and swapped in.
+    LUT_TYPE lut;
+    NUMSOLN_TYPE num;
+    makeLUT(lut, num);
+    initLUT(FLUTE_D, lut, num);
+    for (int i = lut_valid_d + 1; i <= FLUTE_D; i++) {
+      std::swap(LUT[i], lut[i]);
+      std::swap(numsoln[i], num[i]);
+    }
+    deleteLUT(lut, num);
+    lut_valid_d = FLUTE_D;
   }
 }
 
@@ -40,6 +40,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -103,6 +104,8 @@ enum ToolId
       SIZE  // the number of tools, do not put anything after this
 };
 
+class BufferSink;
+
 class Logger
 {
  public:
@@ -224,6 +227,15 @@ class Logger
   void suppressMessage(ToolId tool, int id);
   void unsuppressMessage(ToolId tool, int id);
 
+  // Make a logger that holds its messages and metrics instead of writing
+  // them, for work done on another thread. It uses the debug settings,
+  // message suppressions and metrics stage of this logger.
+  std::unique_ptr<Logger> makeBufferedLogger() const;
+  // Write the messages held by a buffered logger as if they had been
+  // logged here, applying this logger's message limits, and move its
+  // metrics and warning and error counts to this logger.
+  void reportBuffered(Logger& buffered);
+
   void addSink(spdlog::sink_ptr sink);
   void removeSink(spdlog::sink_ptr sink);
   void addMetricsSink(const char* metrics_filename);
@@ -235,6 +247,8 @@ class Logger
   std::string popMetricsStage();
 
  private:
+  Logger(const Logger& parent, std::shared_ptr<BufferSink> buffer_sink);
+
   std::vector<std::string> metrics_sinks_;
   std::list<MetricsEntry> metrics_entries_;
   std::vector<MetricsPolicy> metrics_policies_;
@@ -256,21 +270,37 @@ class Logger
                    tool_names_[tool],
                    id,
                    args...);
+      if (buffer_sink_) {
+        tagBuffered(tool, id, false);
+      }
       return;
     }
 
     if (count == max_message_print) {
-      logger_->log(level,
-                   "[{} {}-{:04d}] message limit reached, "
-                   "this message will no longer print",
-                   level_names[level],
-                   tool_names_[tool],
-                   id);
+      logLimitReached(tool, level, id);
+      if (buffer_sink_) {
+        tagBuffered(tool, id, true);
+      }
     } else {
       counter--;  // to avoid counter overflow
     }
   }
 
+  inline void logLimitReached(ToolId tool,
+                              spdlog::level::level_enum level,
+                              int id)
+  {
+    logger_->log(level,
+                 "[{} {}-{:04d}] message limit reached, "
+                 "this message will no longer print",
+                 level_names[level],
+                 tool_names_[tool],
+                 id);
+  }
+
+  // Record the message id of the last message held by a buffered logger.
+  void tagBuffered(ToolId tool, int id, bool limit_reached);
+
   inline void log_metric(const std::string metric, const std::string value)
   {
     std::string key;
@@ -303,6 +333,8 @@ class Logger
 
   std::vector<spdlog::sink_ptr> sinks_;
   std::shared_ptr<spdlog::logger> logger_;
+  // Messages held by a buffered logger.
+  std::shared_ptr<BufferSink> buffer_sink_;
   std::stack<std::string> metrics_stages_;
 
   // This matrix is pre-allocated so it can be safely updated
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace utl {
+
+class Logger;
+
+// Process wide hierarchical profiler.  Zones are opened with TraceZone and
+// nest per thread.  Each thread records into its own buffer so zones on
+// worker threads do not contend.  When tracing is disabled a zone costs a
+// single relaxed atomic load.
+//
+// Recorded zones can be written as a Chrome trace (chrome://tracing or
+// Perfetto) or summarized per zone path into the logger's metrics.  Both
+// exports and clear() must be called while no zones are open on other
+// threads.
+class Tracer
+{
+ public:
+  // With track_memory each zone also records the process RSS and, where
+  // the C library reports it, the change in allocated heap bytes.
+  static void enable(bool track_memory = false);
+  static void disable();
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static bool trackMemory()
+  {
+    return track_memory_.load(std::memory_order_relaxed);
+  }
+  // Discard all recorded zones.
+  static void clear();
+
+  static void writeChromeTrace(const std::string& filename, Logger* logger);
+  // Adds trace__<path>__count, __runtime (seconds) and, with memory
+  // tracking, __peak_rss (KB) and __alloc (bytes) metrics per zone path.
+  static void reportMetrics(Logger* logger);
+
+ private:
+  static std::atomic<bool> enabled_;
+  static std::atomic<bool> track_memory_;
+};
+
+// Records the time from construction to destruction (or end()) as a zone.
+class TraceZone
+{
+ public:
+  explicit TraceZone(const char* name)
+  {
+    if (Tracer::enabled()) {
+      begin(name);
+    }
+  }
+  ~TraceZone() { end(); }
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+
+  // Close the zone before the end of the scope.
+  void end()
+  {
+    if (event_ >= 0) {
+      finish();
+    }
+  }
+
+ private:
+  void begin(const char* name);
+  void finish();
+
+  int64_t event_ = -1;
+};
+
+}  // namespace utl
@@ -39,6 +39,7 @@
 #include <fstream>
 #include <mutex>
 
+#include "spdlog/sinks/base_sink.h"
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/spdlog.h"
@@ -71,9 +72,104 @@ Logger::Logger(const char* log_filename, const char* metrics_filename)
   }
 }
 
+// Holds the formatted messages of a buffered logger with their levels and
+// the ids of the tool messages.
+class BufferSink : public spdlog::sinks::base_sink<std::mutex>
+{
+ public:
+  struct Message
+  {
+    spdlog::level::level_enum level;
+    std::string text;
+    // id is -1 for reports and debug messages
+    ToolId tool = UKN;
+    int id = -1;
+    bool limit_reached = false;
+  };
+  std::vector<Message> messages;
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override
+  {
+    Message message;
+    message.level = msg.level;
+    message.text = std::string(msg.payload.data(), msg.payload.size());
+    messages.push_back(std::move(message));
+  }
+  void flush_() override {}
+};
+
+Logger::Logger(const Logger& parent, std::shared_ptr<BufferSink> buffer_sink)
+    : buffer_sink_(std::move(buffer_sink)),
+      debug_group_level_(parent.debug_group_level_),
+      debug_on_(parent.debug_on_),
+      warning_count_(0),
+      error_count_(0)
+{
+  metrics_stages_ = parent.metrics_stages_;
+  sinks_.push_back(buffer_sink_);
+  logger_ = std::make_shared<spdlog::logger>(
+      "logger", sinks_.begin(), sinks_.end());
+  logger_->set_pattern(pattern_);
+  logger_->set_level(spdlog::level::level_enum::debug);
+
+  for (int tool = 0; tool < ToolId::SIZE; tool++) {
+    for (int id = 0; id <= max_message_id; id++) {
+      message_counters_[tool][id] = parent.message_counters_[tool][id].load();
+    }
+  }
+}
+
+std::unique_ptr<Logger> Logger::makeBufferedLogger() const
+{
+  return std::unique_ptr<Logger>(
+      new Logger(*this, std::make_shared<BufferSink>()));
+}
+
+void Logger::tagBuffered(ToolId tool, int id, bool limit_reached)
+{
+  BufferSink::Message& message = buffer_sink_->messages.back();
+  message.tool = tool;
+  message.id = id;
+  message.limit_reached = limit_reached;
+}
+
+void Logger::reportBuffered(Logger& buffered)
+{
+  // The buffered logger started from this logger's message counts so it
+  // only dropped messages that would have been dropped here.  Messages from
+  // several buffered loggers may still exceed the limit together.
+  for (const BufferSink::Message& message : buffered.buffer_sink_->messages) {
+    if (message.id < 0) {
+      logger_->log(message.level, "{}", message.text);
+      continue;
+    }
+    if (message.limit_reached) {
+      continue;
+    }
+    auto& counter = message_counters_[message.tool][message.id];
+    const auto count = counter++;
+    if (count < max_message_print) {
+      logger_->log(message.level, "{}", message.text);
+    } else if (count == max_message_print) {
+      logLimitReached(message.tool, message.level, message.id);
+    } else {
+      counter--;  // to avoid counter overflow
+    }
+  }
+  logger_->flush();
+  buffered.buffer_sink_->messages.clear();
+  metrics_entries_.splice(metrics_entries_.end(), buffered.metrics_entries_);
+  warning_count_ += buffered.warning_count_.exchange(0);
+  error_count_ += buffered.error_count_.exchange(0);
+}
+
 Logger::~Logger()
 {
-  finalizeMetrics();
+  // The metrics of a buffered logger are reported by its parent.
+  if (!buffer_sink_) {
+    finalizeMetrics();
+  }
 }
 
 void Logger::addMetricsSink(const char* metrics_filename)
@@ -36,6 +36,7 @@
 #include "LoggerCommon.h"
 
 #include "utl/Logger.h"
+#include "utl/Tracer.h"
 
 namespace ord {
 // Defined in OpenRoad.i
@@ -130,6 +131,33 @@ std::string pop_metrics_stage()
   return logger->popMetricsStage();
 }
 
+void start_tracing(bool track_memory)
+{
+  Tracer::enable(track_memory);
+}
+
+void stop_tracing()
+{
+  Tracer::disable();
+}
+
+void clear_tracing()
+{
+  Tracer::clear();
+}
+
+void write_trace(const char* filename)
+{
+  Logger* logger = getLogger();
+  Tracer::writeChromeTrace(filename, logger);
+}
+
+void trace_metrics()
+{
+  Logger* logger = getLogger();
+  Tracer::reportMetrics(logger);
+}
+
 void suppress_message(utl::ToolId tool, int id)
 {
   Logger* logger = getLogger();
@@ -51,6 +51,11 @@ void set_metrics_stage(const char* fmt);
 void clear_metrics_stage();
 void push_metrics_stage(const char* fmt);
 std::string pop_metrics_stage();
+void start_tracing(bool track_memory);
+void stop_tracing();
+void clear_tracing();
+void write_trace(const char* filename);
+void trace_metrics();
 void suppress_message(utl::ToolId tool, int id);
 void unsuppress_message(utl::ToolId tool, int id);
 
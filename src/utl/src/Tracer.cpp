@@ -0,0 +1,306 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "utl/Tracer.h"
+
+#include <sys/resource.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utl/Logger.h"
+
+namespace utl {
+
+std::atomic<bool> Tracer::enabled_{false};
+std::atomic<bool> Tracer::track_memory_{false};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct TraceEvent
+{
+  std::string name;
+  int64_t parent;    // index of the enclosing zone, -1 for a root zone
+  int64_t start;     // ns since the trace epoch
+  int64_t duration;  // ns, -1 while the zone is open
+  int64_t peak_rss;  // KB, -1 without memory tracking
+  int64_t peak_rss_growth;
+  int64_t alloc;  // heap bytes, -1 if unavailable
+};
+
+struct ThreadTrace
+{
+  int tid = 0;
+  std::vector<TraceEvent> events;
+  std::vector<int64_t> open_zones;
+};
+
+struct TraceRegistry
+{
+  std::mutex mutex;
+  const Clock::time_point epoch = Clock::now();
+  // Kept alive here so zones outlive the threads that recorded them.
+  std::vector<std::shared_ptr<ThreadTrace>> threads;
+};
+
+TraceRegistry& registry()
+{
+  static TraceRegistry registry;
+  return registry;
+}
+
+ThreadTrace& threadTrace()
+{
+  thread_local std::shared_ptr<ThreadTrace> trace;
+  if (!trace) {
+    trace = std::make_shared<ThreadTrace>();
+    TraceRegistry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    trace->tid = reg.threads.size();
+    reg.threads.push_back(trace);
+  }
+  return *trace;
+}
+
+int64_t now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now() - registry().epoch)
+      .count();
+}
+
+int64_t peakRss()
+{
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+int64_t heapBytes()
+{
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#endif
+#endif
+  return -1;
+}
+
+std::string escape(const std::string& name)
+{
+  std::string escaped;
+  for (const char c : name) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+}  // namespace
+
+void Tracer::enable(const bool track_memory)
+{
+  // Register the epoch before the first zone.
+  registry();
+  track_memory_ = track_memory;
+  enabled_ = true;
+}
+
+void Tracer::disable()
+{
+  enabled_ = false;
+}
+
+void Tracer::clear()
+{
+  TraceRegistry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for (auto& thread : reg.threads) {
+    thread->events.clear();
+    thread->open_zones.clear();
+  }
+}
+
+void Tracer::writeChromeTrace(const std::string& filename, Logger* logger)
+{
+  std::ofstream out(filename);
+  if (!out) {
+    logger->error(UTL, 10, "Unable to open {} to write the trace.", filename);
+  }
+
+  TraceRegistry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  for (const auto& thread : reg.threads) {
+    for (const TraceEvent& event : thread->events) {
+      if (event.duration < 0) {
+        continue;
+      }
+      out << (first ? "\n" : ",\n");
+      first = false;
+      out << fmt::format(
+          "{{\"name\": \"{}\", \"ph\": \"X\", \"pid\": 0, \"tid\": {}, "
+          "\"ts\": {:.3f}, \"dur\": {:.3f}",
+          escape(event.name),
+          thread->tid,
+          event.start / 1e3,
+          event.duration / 1e3);
+      if (event.peak_rss >= 0) {
+        out << fmt::format(
+            ", \"args\": {{\"peak_rss_kb\": {}, \"peak_rss_growth_kb\": {}",
+            event.peak_rss,
+            event.peak_rss_growth);
+        if (event.alloc >= 0) {
+          out << fmt::format(", \"alloc_bytes\": {}", event.alloc);
+        }
+        out << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "\n]}\n";
+}
+
+void Tracer::reportMetrics(Logger* logger)
+{
+  struct ZoneSummary
+  {
+    int64_t count = 0;
+    int64_t duration = 0;
+    int64_t peak_rss = -1;
+    int64_t alloc = 0;
+    bool has_alloc = false;
+  };
+
+  // Sorted by path so the metrics come out in a stable order.
+  std::map<std::string, ZoneSummary> summaries;
+  TraceRegistry& reg = registry();
+  {
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& thread : reg.threads) {
+      std::vector<std::string> paths(thread->events.size());
+      for (size_t i = 0; i < thread->events.size(); i++) {
+        const TraceEvent& event = thread->events[i];
+        paths[i] = event.parent < 0
+                       ? event.name
+                       : paths[event.parent] + "/" + event.name;
+        if (event.duration < 0) {
+          continue;
+        }
+        ZoneSummary& summary = summaries[paths[i]];
+        summary.count++;
+        summary.duration += event.duration;
+        summary.peak_rss = std::max(summary.peak_rss, event.peak_rss);
+        if (event.alloc >= 0) {
+          summary.alloc += event.alloc;
+          summary.has_alloc = true;
+        }
+      }
+    }
+  }
+
+  for (const auto& [path, summary] : summaries) {
+    logger->metric(fmt::format("trace__{}__count", path), summary.count);
+    logger->metric(fmt::format("trace__{}__runtime", path),
+                   summary.duration / 1e9);
+    if (summary.peak_rss >= 0) {
+      logger->metric(fmt::format("trace__{}__peak_rss", path),
+                     summary.peak_rss);
+    }
+    if (summary.has_alloc) {
+      logger->metric(fmt::format("trace__{}__alloc", path), summary.alloc);
+    }
+  }
+}
+
+//////////////////////////
+
+void TraceZone::begin(const char* name)
+{
+  ThreadTrace& trace = threadTrace();
+  TraceEvent event;
+  event.name = name;
+  event.parent = trace.open_zones.empty() ? -1 : trace.open_zones.back();
+  event.duration = -1;
+  event.peak_rss = -1;
+  event.peak_rss_growth = 0;
+  event.alloc = -1;
+  if (Tracer::trackMemory()) {
+    event.peak_rss = peakRss();
+    event.alloc = heapBytes();
+  }
+  event_ = trace.events.size();
+  trace.events.push_back(std::move(event));
+  trace.open_zones.push_back(event_);
+  // Sample the clock last so the bookkeeping is not charged to the zone.
+  trace.events.back().start = now();
+}
+
+void TraceZone::finish()
+{
+  const int64_t end = now();
+  ThreadTrace& trace = threadTrace();
+  // The zone is gone if the trace was cleared while it was open.
+  if (!trace.open_zones.empty() && trace.open_zones.back() == event_) {
+    trace.open_zones.pop_back();
+    TraceEvent& event = trace.events[event_];
+    event.duration = end - event.start;
+    if (event.peak_rss >= 0) {
+      const int64_t peak_rss = peakRss();
+      event.peak_rss_growth = peak_rss - event.peak_rss;
+      event.peak_rss = peak_rss;
+      if (event.alloc >= 0) {
+        event.alloc = heapBytes() - event.alloc;
+      }
+    }
+  }
+  event_ = -1;
+}
+
+}  // namespace utl
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "spdlog/sinks/ostream_sink.h"
+#include "utl/Logger.h"
+
+namespace utl {
+
+static std::string readFile(const std::string& filename)
+{
+  std::ifstream in(filename);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+static int countLines(const std::string& text, const std::string& pattern)
+{
+  int count = 0;
+  std::istringstream in(text);
+  for (std::string line; std::getline(in, line);) {
+    if (line == pattern) {
+      count++;
+    }
+  }
+  return count;
+}
+
+TEST(Logger, buffered_messages_are_reported_in_order)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+
+  auto first = logger.makeBufferedLogger();
+  auto second = logger.makeBufferedLogger();
+  std::thread t1([&] { first->warn(UTL, 100, "first {}", 1); });
+  std::thread t2([&] {
+    second->info(UTL, 101, "second");
+    second->report("report");
+  });
+  t1.join();
+  t2.join();
+  EXPECT_TRUE(out.str().empty());
+
+  logger.reportBuffered(*first);
+  logger.reportBuffered(*second);
+  EXPECT_EQ(out.str(),
+            "[WARNING UTL-0100] first 1\n"
+            "[INFO UTL-0101] second\n"
+            "report\n");
+}
+
+TEST(Logger, buffered_messages_share_the_message_limit)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+
+  // Each buffered logger is under the limit but together they are not.
+  std::vector<std::unique_ptr<Logger>> buffered;
+  for (int i = 0; i < 2; i++) {
+    buffered.push_back(logger.makeBufferedLogger());
+    for (int j = 0; j < 600; j++) {
+      buffered.back()->info(UTL, 102, "message");
+    }
+  }
+  for (auto& b : buffered) {
+    logger.reportBuffered(*b);
+  }
+  logger.info(UTL, 102, "message");
+
+  EXPECT_EQ(countLines(out.str(), "[INFO UTL-0102] message"), 1000);
+  EXPECT_EQ(countLines(out.str(),
+                       "[INFO UTL-0102] message limit reached, "
+                       "this message will no longer print"),
+            1);
+}
+
+TEST(Logger, buffered_suppressed_messages_are_dropped)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+  logger.suppressMessage(UTL, 103);
+
+  auto buffered = logger.makeBufferedLogger();
+  buffered->warn(UTL, 103, "suppressed");
+  buffered->warn(UTL, 104, "shown");
+  logger.reportBuffered(*buffered);
+
+  EXPECT_EQ(out.str(), "[WARNING UTL-0104] shown\n");
+}
+
+TEST(Logger, buffered_metrics_and_counts_are_merged)
+{
+  const std::string metrics = testing::TempDir() + "/buffered_metrics.json";
+  {
+    Logger logger(nullptr, metrics.c_str());
+    logger.setMetricsStage("stage__{}");
+    auto buffered = logger.makeBufferedLogger();
+    std::thread t([&] {
+      buffered->metric("buffered__value", 42);
+      buffered->warn(UTL, 105, "warning");
+    });
+    t.join();
+    logger.reportBuffered(*buffered);
+    logger.clearMetricsStage();
+  }
+
+  const std::string json = readFile(metrics);
+  EXPECT_NE(json.find("\"stage__buffered__value\": 42"), std::string::npos);
+  EXPECT_NE(json.find("\"flow__warnings__count\": 1"), std::string::npos);
+}
+
+}  // namespace utl
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+#include "utl/Tracer.h"
+
+namespace utl {
+
+static std::string readFile(const std::string& filename)
+{
+  std::ifstream in(filename);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+static std::string tempFilename(const std::string& name)
+{
+  return testing::TempDir() + "/" + name;
+}
+
+TEST(Tracer, disabled_zones_are_not_recorded)
+{
+  Logger logger;
+  Tracer::disable();
+  Tracer::clear();
+  {
+    TraceZone zone("ignored");
+  }
+  const std::string trace_file = tempFilename("disabled.json");
+  Tracer::writeChromeTrace(trace_file, &logger);
+  EXPECT_EQ(readFile(trace_file).find("ignored"), std::string::npos);
+}
+
+TEST(Tracer, nested_zones_report_paths)
+{
+  const std::string metrics_file = tempFilename("nested_metrics.json");
+  {
+    Logger logger(nullptr, metrics_file.c_str());
+    Tracer::clear();
+    Tracer::enable(true);
+    {
+      TraceZone outer("outer");
+      for (int i = 0; i < 3; i++) {
+        TraceZone inner("inner");
+      }
+      TraceZone early("early");
+      early.end();
+    }
+    Tracer::disable();
+    Tracer::reportMetrics(&logger);
+  }
+
+  const std::string metrics = readFile(metrics_file);
+  EXPECT_NE(metrics.find("\"trace__outer__count\": 1"), std::string::npos);
+  EXPECT_NE(metrics.find("\"trace__outer/inner__count\": 3"),
+            std::string::npos);
+  EXPECT_NE(metrics.find("\"trace__outer/early__count\": 1"),
+            std::string::npos);
+  EXPECT_NE(metrics.find("trace__outer__runtime"), std::string::npos);
+  EXPECT_NE(metrics.find("trace__outer__peak_rss"), std::string::npos);
+}
+
+TEST(Tracer, chrome_trace_has_a_track_per_thread)
+{
+  Logger logger;
+  Tracer::clear();
+  Tracer::enable();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([] { TraceZone zone("worker"); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  Tracer::disable();
+
+  const std::string trace_file = tempFilename("threads.json");
+  Tracer::writeChromeTrace(trace_file, &logger);
+  const std::string trace = readFile(trace_file);
+  EXPECT_EQ(trace.rfind("{\"displayTimeUnit\"", 0), 0);
+  int zones = 0;
+  for (size_t pos = trace.find("\"worker\""); pos != std::string::npos;
+       pos = trace.find("\"worker\"", pos + 1)) {
+    zones++;
+  }
+  EXPECT_EQ(zones, 4);
+}
+
+}  // namespace utl